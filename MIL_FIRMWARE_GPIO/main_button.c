@@ -15,15 +15,9 @@
 //includes
 #include <stdbool.h>
 #include <stdint.h>
-#include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
 #include "driverlib/gpio.h"
-#include "driverlib/interrupt.h"
-#include "driverlib/pin_map.h"
 #include "driverlib/sysctl.h"
-#include "driverlib/timer.h"
-#include "driverlib/uart.h"
-#include "utils/uartstdio.h"
 
 //mil includes
 #include "MIL_CLK.h"
@@ -0,0 +1,392 @@
+/*
+ * Name: MIL_TIMER
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Input capture functions for measuring pulse widths
+ *       and frequencies using the general purpose timers
+ *
+ * Implementation Notes:
+ *       Every channel has a small ring buffer. The capture ISR
+ *       is the only writer of head and the main loop is the only
+ *       writer of tail, so no interrupts need to be disabled
+ *       to move samples between them
+ *
+ *       The buffer length is a power of 2 so the indices can
+ *       be wrapped with a mask instead of a divide
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_gpio.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+#include "MIL_TIMER.h"
+
+#define CAP_PRESCALE 0xFF
+#define CAP_LOAD     0xFFFF
+
+//PC0-PC3 are the JTAG pins, their commit register starts locked
+#define JTAG_PORT GPIO_PORTC_BASE
+#define JTAG_PINS (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+/*
+ * Desc: Everything needed to set up and service one timer half
+ */
+typedef struct{
+
+    uint32_t base;
+    uint32_t timer;       //TIMER_A or TIMER_B
+    uint32_t timer_periph;
+    uint32_t gpio_periph;
+    uint32_t port;
+    uint8_t  pin;
+    uint32_t pin_config;
+    uint32_t cap_event;   //TIMER_CAPA_EVENT or TIMER_CAPB_EVENT
+
+}CaptureHW;
+
+/*
+ * Desc: Runtime state of one capture channel
+ */
+typedef struct{
+
+    //last edge timestamps
+    uint32_t last_rise;
+    uint32_t last_high;
+    bool     have_rise;
+
+    //ISR -> main loop buffer
+    MIL_TIMER_Sample buf[MIL_TIMER_BUF_LEN];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+
+    MIL_TIMER_Stats stats;
+
+}CaptureChannel;
+
+//channel index = timer number * 2 + (0 for A, 1 for B)
+static const CaptureHW CAPTURE_HW[MIL_TIMER_NUM_CHANNELS] = {
+
+    //A : PB6
+    //B : PB7
+    {TIMER0_BASE, TIMER_A, SYSCTL_PERIPH_TIMER0, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_6, GPIO_PB6_T0CCP0, TIMER_CAPA_EVENT},
+    {TIMER0_BASE, TIMER_B, SYSCTL_PERIPH_TIMER0, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_7, GPIO_PB7_T0CCP1, TIMER_CAPB_EVENT},
+
+    //A : PF2
+    //B : PF3
+    {TIMER1_BASE, TIMER_A, SYSCTL_PERIPH_TIMER1, SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_2, GPIO_PF2_T1CCP0, TIMER_CAPA_EVENT},
+    {TIMER1_BASE, TIMER_B, SYSCTL_PERIPH_TIMER1, SYSCTL_PERIPH_GPIOF, GPIO_PORTF_BASE, GPIO_PIN_3, GPIO_PF3_T1CCP1, TIMER_CAPB_EVENT},
+
+    //A : PB0
+    //B : PB1
+    {TIMER2_BASE, TIMER_A, SYSCTL_PERIPH_TIMER2, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_0, GPIO_PB0_T2CCP0, TIMER_CAPA_EVENT},
+    {TIMER2_BASE, TIMER_B, SYSCTL_PERIPH_TIMER2, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_1, GPIO_PB1_T2CCP1, TIMER_CAPB_EVENT},
+
+    //A : PB2
+    //B : PB3
+    {TIMER3_BASE, TIMER_A, SYSCTL_PERIPH_TIMER3, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_2, GPIO_PB2_T3CCP0, TIMER_CAPA_EVENT},
+    {TIMER3_BASE, TIMER_B, SYSCTL_PERIPH_TIMER3, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_3, GPIO_PB3_T3CCP1, TIMER_CAPB_EVENT},
+
+    //A : PC0
+    //B : PC1
+    {TIMER4_BASE, TIMER_A, SYSCTL_PERIPH_TIMER4, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_0, GPIO_PC0_T4CCP0, TIMER_CAPA_EVENT},
+    {TIMER4_BASE, TIMER_B, SYSCTL_PERIPH_TIMER4, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_1, GPIO_PC1_T4CCP1, TIMER_CAPB_EVENT},
+
+    //A : PC2
+    //B : PC3
+    {TIMER5_BASE, TIMER_A, SYSCTL_PERIPH_TIMER5, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_2, GPIO_PC2_T5CCP0, TIMER_CAPA_EVENT},
+    {TIMER5_BASE, TIMER_B, SYSCTL_PERIPH_TIMER5, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_3, GPIO_PC3_T5CCP1, TIMER_CAPB_EVENT},
+
+};
+
+static CaptureChannel CHANNELS[MIL_TIMER_NUM_CHANNELS];
+
+//TimerConfigure touches both halves so it only runs once per timer
+static bool TIMER_CONFIGURED[MIL_TIMER_NUM_CHANNELS / 2];
+
+/************************PRIVATE FUNCTIONS******************************/
+
+/*
+ * Desc: maps a timer base and half to a channel index
+ *       returns MIL_TIMER_NUM_CHANNELS for an invalid base
+ */
+static uint32_t ChannelIndex(uint32_t base, uint32_t timer){
+
+    uint32_t index;
+
+    switch(base){
+
+        case TIMER0_BASE: index = 0;  break;
+        case TIMER1_BASE: index = 2;  break;
+        case TIMER2_BASE: index = 4;  break;
+        case TIMER3_BASE: index = 6;  break;
+        case TIMER4_BASE: index = 8;  break;
+        case TIMER5_BASE: index = 10; break;
+        default: return MIL_TIMER_NUM_CHANNELS;
+
+    };
+
+    return (timer == TIMER_B) ? (index + 1) : index;
+
+}
+
+static void StatsClear(MIL_TIMER_Stats *pStats){
+
+    pStats->count = 0;
+    pStats->dropped = 0;
+    pStats->period_min = UINT32_MAX;
+    pStats->period_max = 0;
+    pStats->high_min = UINT32_MAX;
+    pStats->high_max = 0;
+    pStats->jitter = 0;
+
+}
+
+/*
+ * Desc: shared capture handler, every channel ISR lands here
+ *
+ *       A rising edge closes out one period, so that is the only
+ *       time a sample is produced. A falling edge just records
+ *       how long the signal was high
+ */
+static void CaptureISR(uint32_t index){
+
+    const CaptureHW *pHW = &CAPTURE_HW[index];
+    CaptureChannel *pCh = &CHANNELS[index];
+
+    TimerIntClear(pHW->base, pHW->cap_event);
+
+    uint32_t now = TimerValueGet(pHW->base, pHW->timer) & MIL_TIMER_CAP_MASK;
+    bool rising = (GPIOPinRead(pHW->port, pHW->pin) != 0);
+
+    if(!rising){
+
+        if(pCh->have_rise){ pCh->last_high = (now - pCh->last_rise) & MIL_TIMER_CAP_MASK; }
+        return;
+
+    }
+
+    if(pCh->have_rise){
+
+        MIL_TIMER_Sample sample;
+        sample.period = (now - pCh->last_rise) & MIL_TIMER_CAP_MASK;
+        sample.high = pCh->last_high;
+
+        //statistics
+        MIL_TIMER_Stats *pStats = &pCh->stats;
+        pStats->count++;
+        if(sample.period < pStats->period_min){ pStats->period_min = sample.period; }
+        if(sample.period > pStats->period_max){ pStats->period_max = sample.period; }
+        if(sample.high < pStats->high_min){ pStats->high_min = sample.high; }
+        if(sample.high > pStats->high_max){ pStats->high_max = sample.high; }
+        pStats->jitter = pStats->period_max - pStats->period_min;
+
+        //push to buffer, drop the new sample if the main loop fell behind
+        uint32_t head = pCh->head;
+        if((head - pCh->tail) < MIL_TIMER_BUF_LEN){
+
+            pCh->buf[head & (MIL_TIMER_BUF_LEN - 1)] = sample;
+            pCh->head = head + 1;
+
+        }
+        else{
+
+            pStats->dropped++;
+
+        }
+
+    }
+
+    pCh->last_rise = now;
+    pCh->have_rise = true;
+
+}
+
+//one vector per timer half, these just forward to the shared handler
+static void Timer0AISR(void){ CaptureISR(0); }
+static void Timer0BISR(void){ CaptureISR(1); }
+static void Timer1AISR(void){ CaptureISR(2); }
+static void Timer1BISR(void){ CaptureISR(3); }
+static void Timer2AISR(void){ CaptureISR(4); }
+static void Timer2BISR(void){ CaptureISR(5); }
+static void Timer3AISR(void){ CaptureISR(6); }
+static void Timer3BISR(void){ CaptureISR(7); }
+static void Timer4AISR(void){ CaptureISR(8); }
+static void Timer4BISR(void){ CaptureISR(9); }
+static void Timer5AISR(void){ CaptureISR(10); }
+static void Timer5BISR(void){ CaptureISR(11); }
+
+static void (* const CAPTURE_ISRS[MIL_TIMER_NUM_CHANNELS])(void) = {
+
+    Timer0AISR, Timer0BISR,
+    Timer1AISR, Timer1BISR,
+    Timer2AISR, Timer2BISR,
+    Timer3AISR, Timer3BISR,
+    Timer4AISR, Timer4BISR,
+    Timer5AISR, Timer5BISR,
+
+};
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Configures one half of a timer for edge time
+ *       capture on its CCP pin(see pin map) and starts it
+ *
+ * Parameters:
+ *            base: TIVA timer base TIMERx_BASE(where x is 0 to 5)
+ *            timer: TIMER_A or TIMER_B
+ */
+void MIL_TIMER_InitCapture(uint32_t base, uint32_t timer){
+
+    uint32_t index = ChannelIndex(base, timer);
+    if(index >= MIL_TIMER_NUM_CHANNELS){ return; }
+
+    const CaptureHW *pHW = &CAPTURE_HW[index];
+    CaptureChannel *pCh = &CHANNELS[index];
+
+    pCh->have_rise = false;
+    pCh->last_high = 0;
+    pCh->head = 0;
+    pCh->tail = 0;
+    StatsClear(&pCh->stats);
+
+    //clocks
+    SysCtlPeripheralEnable(pHW->timer_periph);
+    SysCtlPeripheralEnable(pHW->gpio_periph);
+    while(!SysCtlPeripheralReady(pHW->timer_periph));
+    while(!SysCtlPeripheralReady(pHW->gpio_periph));
+
+    //pin, AFSEL and PCTL writes are ignored on a JTAG pin until it is committed
+    if(pHW->port == JTAG_PORT && (pHW->pin & JTAG_PINS)){
+
+        HWREG(JTAG_PORT + GPIO_O_LOCK) = GPIO_LOCK_KEY;
+        HWREG(JTAG_PORT + GPIO_O_CR) |= pHW->pin;
+        HWREG(JTAG_PORT + GPIO_O_LOCK) = 0;
+
+    }
+
+    GPIOPinConfigure(pHW->pin_config);
+    GPIOPinTypeTimer(pHW->port, pHW->pin);
+
+    /*
+     * TimerConfigure sets up both halves at once and stops them,
+     * so it must not run again once the other half is capturing.
+     * Both halves are put in edge time mode, an unused half
+     * simply never gets enabled
+     */
+    if(!TIMER_CONFIGURED[index / 2]){
+
+        TimerConfigure(base, TIMER_CFG_SPLIT_PAIR |
+                             TIMER_CFG_A_CAP_TIME_UP |
+                             TIMER_CFG_B_CAP_TIME_UP);
+        TIMER_CONFIGURED[index / 2] = true;
+
+    }
+    else{
+
+        TimerDisable(base, timer);
+
+    }
+
+    //full 24 bit range
+    TimerPrescaleSet(base, timer, CAP_PRESCALE);
+    TimerLoadSet(base, timer, CAP_LOAD);
+    TimerControlEvent(base, timer, TIMER_EVENT_BOTH_EDGES);
+
+    /*INTERRUPTS*/
+    TimerIntRegister(base, timer, CAPTURE_ISRS[index]);
+    TimerIntClear(base, pHW->cap_event);
+    TimerIntEnable(base, pHW->cap_event);
+
+    TimerEnable(base, timer);
+
+}
+
+/*
+ * Desc: Pulls the oldest completed sample out of the channel
+ *       buffer. Never blocks
+ *
+ * Returns: true if a sample was available
+ */
+bool MIL_TIMER_CaptureGet(uint32_t base, uint32_t timer, MIL_TIMER_Sample *pSample){
+
+    uint32_t index = ChannelIndex(base, timer);
+    if(index >= MIL_TIMER_NUM_CHANNELS){ return false; }
+
+    CaptureChannel *pCh = &CHANNELS[index];
+    uint32_t tail = pCh->tail;
+
+    if(tail == pCh->head){ return false; }
+
+    *pSample = pCh->buf[tail & (MIL_TIMER_BUF_LEN - 1)];
+    pCh->tail = tail + 1;
+
+    return true;
+
+}
+
+/*
+ * Desc: Copies the channel statistics
+ *
+ *       The capture interrupt is masked for the copy so the
+ *       min/max values are from the same moment in time
+ */
+void MIL_TIMER_StatsGet(uint32_t base, uint32_t timer, MIL_TIMER_Stats *pStats){
+
+    uint32_t index = ChannelIndex(base, timer);
+    if(index >= MIL_TIMER_NUM_CHANNELS){ return; }
+
+    const CaptureHW *pHW = &CAPTURE_HW[index];
+
+    TimerIntDisable(base, pHW->cap_event);
+    *pStats = CHANNELS[index].stats;
+    TimerIntEnable(base, pHW->cap_event);
+
+}
+
+/*
+ * Desc: Clears the channel statistics(buffered samples are kept)
+ */
+void MIL_TIMER_StatsReset(uint32_t base, uint32_t timer){
+
+    uint32_t index = ChannelIndex(base, timer);
+    if(index >= MIL_TIMER_NUM_CHANNELS){ return; }
+
+    const CaptureHW *pHW = &CAPTURE_HW[index];
+
+    TimerIntDisable(base, pHW->cap_event);
+    StatsClear(&CHANNELS[index].stats);
+    TimerIntEnable(base, pHW->cap_event);
+
+}
+
+/*
+ * Desc: Converts a tick count from a sample into microseconds
+ *       using the current system clock
+ */
+uint32_t MIL_TIMER_TicksToUs(uint32_t ticks){
+
+    uint32_t ticks_per_us = SysCtlClockGet() / 1000000;
+
+    return ticks / ticks_per_us;
+
+}
+
+/*
+ * Desc: Converts a period in ticks into a frequency in Hz
+ *       returns 0 for a 0 period
+ */
+uint32_t MIL_TIMER_TicksToHz(uint32_t period){
+
+    if(period == 0){ return 0; }
+
+    return SysCtlClockGet() / period;
+
+}
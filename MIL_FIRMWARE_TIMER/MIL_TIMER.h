@@ -0,0 +1,176 @@
+/*
+ * Name: MIL_TIMER
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Input capture functions for measuring pulse widths
+ *       and frequencies(RC receivers, encoders, tachometers)
+ *       using the general purpose timers
+ *
+ * What to understand: Instead of polling a pin and counting loops,
+ *                     the timer hardware latches its own count the
+ *                     moment an edge arrives on the CCP pin. The ISR
+ *                     only has to subtract two latched values, so the
+ *                     measurement does not depend on how busy the CPU is
+ *
+ *                     Every 16/32 bit timer is split into two 16 bit
+ *                     halves(A and B) and each half gets its own CCP pin,
+ *                     so all six timers give us 12 capture channels
+ *
+ *                     The 8 bit prescaler is used as a timer extension
+ *                     in edge time mode which gives a 24 bit timestamp
+ *                     at the system clock rate
+ *
+ * Resolution Note:
+ *      At 16MHz one tick is 62.5ns and the 24 bit counter wraps
+ *      every ~1.05s, so any signal slower than about 1Hz will alias
+ *
+ * Hardware Notes:
+ *       Each channel captures BOTH edges. The ISR reads the pin level
+ *       to tell rising from falling, so pulses shorter than the ISR
+ *       latency(a few us) will be misread as the wrong edge
+ *
+ *       TIMER4 and TIMER5 CCP pins are on PC0-PC3 which are
+ *       also the JTAG pins. Their GPIOCR commit bits are locked at
+ *       reset, so MIL_TIMER_InitCapture unlocks the pin(GPIO_LOCK)
+ *       and commits it before muxing it to the timer. Using them will
+ *       lock out the debugger until the board is recovered with an
+ *       unlock, so only use them if you really need all 12 channels
+ *
+ *       T1CCP0/T1CCP1 are on the launchpad RGB LED pins and
+ *       T2CCP0/T2CCP1 share PB0/PB1 with UART1
+ *
+ * MIL_TIMER PIN MAP:
+ *      TIMER0:
+ *          A :  PB6
+ *          B :  PB7
+ *      TIMER1:
+ *          A :  PF2
+ *          B :  PF3
+ *      TIMER2:
+ *          A :  PB0
+ *          B :  PB1
+ *      TIMER3:
+ *          A :  PB2
+ *          B :  PB3
+ *      TIMER4:
+ *          A :  PC0 (JTAG TCK)
+ *          B :  PC1 (JTAG TMS)
+ *      TIMER5:
+ *          A :  PC2 (JTAG TDI)
+ *          B :  PC3 (JTAG TDO)
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/timer.h"
+
+#ifndef MIL_TIMER_H_
+#define MIL_TIMER_H_
+
+//6 timers with an A and B half each
+#define MIL_TIMER_NUM_CHANNELS 12
+
+//samples buffered per channel between ISR and main loop
+//must be a power of 2
+#define MIL_TIMER_BUF_LEN 16
+
+//24 bit timestamp(16 bit count + 8 bit prescale extension)
+#define MIL_TIMER_CAP_MASK 0x00FFFFFF
+
+/*
+ * Desc: One full period of the measured signal
+ *
+ *       period: ticks from rising edge to the next rising edge
+ *       high:   ticks the signal was high during that period
+ *               (this is the pulse width for RC receivers)
+ */
+typedef struct{
+
+    uint32_t period;
+    uint32_t high;
+
+}MIL_TIMER_Sample;
+
+/*
+ * Desc: Running statistics for a channel since the last reset
+ *
+ *       jitter is the peak to peak variation of the period
+ *       (period_max - period_min) which is what we care about
+ *       for encoder and RC signal quality
+ *
+ *       dropped counts samples lost because the main loop
+ *       did not read the buffer fast enough
+ */
+typedef struct{
+
+    uint32_t count;
+    uint32_t dropped;
+    uint32_t period_min;
+    uint32_t period_max;
+    uint32_t high_min;
+    uint32_t high_max;
+    uint32_t jitter;
+
+}MIL_TIMER_Stats;
+
+/*
+ * Desc: Configures one half of a timer for edge time
+ *       capture on its CCP pin(see pin map) and starts it
+ *
+ *       Capture interrupts are registered internally so
+ *       you do not need to write an ISR
+ *
+ * Parameters:
+ *            base: TIVA timer base TIMERx_BASE(where x is 0 to 5)
+ *            timer: TIMER_A or TIMER_B
+ *
+ * NOTE: Call MIL_TIMER_InitCapture once per channel you need,
+ *       the other half of the same timer keeps working independently
+ */
+void MIL_TIMER_InitCapture(uint32_t base, uint32_t timer);
+
+/*
+ * Desc: Pulls the oldest completed sample out of the channel
+ *       buffer. Never blocks
+ *
+ * Parameters:
+ *            base: TIMERx_BASE
+ *            timer: TIMER_A or TIMER_B
+ *            pSample: where to store the sample
+ *
+ * Returns: true if a sample was available
+ */
+bool MIL_TIMER_CaptureGet(uint32_t base, uint32_t timer, MIL_TIMER_Sample *pSample);
+
+/*
+ * Desc: Copies the channel statistics
+ *
+ * Parameters:
+ *            base: TIMERx_BASE
+ *            timer: TIMER_A or TIMER_B
+ *            pStats: where to store the statistics
+ */
+void MIL_TIMER_StatsGet(uint32_t base, uint32_t timer, MIL_TIMER_Stats *pStats);
+
+/*
+ * Desc: Clears the channel statistics(buffered samples are kept)
+ *
+ * Parameters:
+ *            base: TIMERx_BASE
+ *            timer: TIMER_A or TIMER_B
+ */
+void MIL_TIMER_StatsReset(uint32_t base, uint32_t timer);
+
+/*
+ * Desc: Converts a tick count from a sample into microseconds
+ *       using the current system clock
+ */
+uint32_t MIL_TIMER_TicksToUs(uint32_t ticks);
+
+/*
+ * Desc: Converts a period in ticks into a frequency in Hz
+ *       returns 0 for a 0 period
+ */
+uint32_t MIL_TIMER_TicksToHz(uint32_t period);
+
+#endif /* MIL_TIMER_H_ */
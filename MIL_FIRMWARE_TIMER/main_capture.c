@@ -0,0 +1,89 @@
+/*
+ * Name: MIL_TIMER_Capture_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate measuring an RC receiver
+ *       channel with timer input capture
+ *
+ *       RC servo signals are a 1ms to 2ms high pulse
+ *       repeated every ~20ms. Stick centered is 1.5ms
+ *
+ *       This demo turns the blue LED on when the stick is
+ *       past center. The CPU never polls the pin, the timer
+ *       latches every edge and the main loop only reads results
+ *
+ * Hardware Notes:
+ * TIMER0 A on Port B
+ * PB6 - RC receiver signal
+ * PF2 - Blue LED
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_TIMER.h"
+
+/************************DEFINES******************************/
+
+#define BLUE_LED_PIN GPIO_PIN_2
+
+//RC pulse center in microseconds
+#define RC_CENTER_US 1500
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitBlueLED(void);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+
+    InitBlueLED();
+
+    //start measuring PB6
+    MIL_TIMER_InitCapture(TIMER0_BASE, TIMER_A);
+
+    MIL_TIMER_Sample sample;
+
+    while(1){
+
+        //only does work when a new pulse has been measured
+        if(MIL_TIMER_CaptureGet(TIMER0_BASE, TIMER_A, &sample)){
+
+            if(MIL_TIMER_TicksToUs(sample.high) > RC_CENTER_US){
+
+                GPIOPinWrite(GPIO_PORTF_BASE, BLUE_LED_PIN, BLUE_LED_PIN);
+
+            }
+            else{
+
+                GPIOPinWrite(GPIO_PORTF_BASE, BLUE_LED_PIN, 0x00);
+
+            }
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitBlueLED(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, BLUE_LED_PIN);
+
+}
@@ -0,0 +1,537 @@
+/*
+ * Name: MIL_ARQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Selective repeat ARQ for MIL_LINK
+ *
+ * Implementation Notes:
+ *       Sequence numbers are 8 bits and wrap. A window slot is seq & (WINDOW - 1),
+ *       which only works because the window is a power of 2 and never holds
+ *       more than WINDOW sequence numbers
+ *
+ *       Send times are when a frame finishes leaving the UART, worked out
+ *       from the byte time and everything queued ahead of it. Timing from
+ *       when a frame was queued would make the round trip swing with the
+ *       queue depth, and a burst after a stall would look like loss
+ *
+ *       Round trip time is measured only on messages that were sent once,
+ *       an ack for a resent message can't say which copy it was for(Karn's
+ *       rule). Every timeout doubles the retry timeout, any ack that
+ *       acknowledges something new puts it back to the measured value
+ *
+ *       Fast retransmit: the link never reorders, so if the receiver has
+ *       seen a message, every message last sent before it that is still
+ *       missing was lost. Those go out again right away instead of waiting
+ *       for the timeout, which is what keeps a lossy link near line rate
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "MIL_CRC.h"
+#include "MIL_ARQ.h"
+
+#define SLOT_MASK (MIL_ARQ_WINDOW - 1)
+#define RAW_MAX   (MIL_ARQ_HEADER_LEN + MIL_ARQ_MAX_PAYLOAD + MIL_ARQ_CRC_LEN)
+
+#if (MIL_ARQ_WINDOW & SLOT_MASK) || MIL_ARQ_WINDOW > 16 || MIL_ARQ_WINDOW < 2
+#error "MIL_ARQ: MIL_ARQ_WINDOW must be a power of 2 from 2 to 16"
+#endif
+
+#if MIL_ARQ_MAX_PAYLOAD > 240
+#error "MIL_ARQ: MIL_ARQ_MAX_PAYLOAD must be 240 or less"
+#endif
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//true if seq is one of the n sequence numbers starting at base
+static bool SeqIn(uint8_t seq, uint8_t base, uint8_t n){
+
+    return (uint8_t)(seq - base) < n;
+
+}
+
+/*
+ * Desc: COBS encode, removes every 0x00 from the frame so 0x00 can
+ *       mark the end. Frames are under 254 bytes so there is one block
+ *
+ * Returns: encoded length(len + 1)
+ */
+static uint16_t CobsEncode(const uint8_t *pIn, uint16_t len, uint8_t *pOut){
+
+    uint16_t code_at = 0;
+    uint16_t o = 1;
+    uint8_t code = 1;
+
+    for(uint16_t i = 0; i < len; i++){
+
+        if(pIn[i] == 0){
+
+            pOut[code_at] = code;
+            code_at = o++;
+            code = 1;
+
+        }
+        else{
+
+            pOut[o++] = pIn[i];
+            code++;
+
+        }
+
+    }
+
+    pOut[code_at] = code;
+
+    return o;
+
+}
+
+/*
+ * Returns: decoded length, 0 if the data is not valid COBS
+ */
+static uint16_t CobsDecode(const uint8_t *pIn, uint16_t len, uint8_t *pOut, uint16_t max){
+
+    uint16_t i = 0;
+    uint16_t o = 0;
+
+    while(i < len){
+
+        uint8_t code = pIn[i++];
+        if(code == 0 || i + code - 1 > len || o + code - 1 > max){ return 0; }
+
+        for(uint8_t j = 1; j < code; j++){ pOut[o++] = pIn[i++]; }
+
+        //every block but the last ends in a 0 that was taken out
+        if(code != 0xFF && i < len){
+
+            if(o == max){ return 0; }
+            pOut[o++] = 0;
+
+        }
+
+    }
+
+    return o;
+
+}
+
+static uint16_t Sack(const MIL_ARQ *pArq){
+
+    uint16_t sack = 0;
+
+    for(uint8_t i = 0; i < MIL_ARQ_WINDOW - 1; i++){
+
+        if(pArq->rx_have[(uint8_t)(pArq->rx_next + 1 + i) & SLOT_MASK]){ sack |= (1u << i); }
+
+    }
+
+    return sack;
+
+}
+
+/*
+ * Desc: builds, encodes and sends one frame, the current ack always rides along
+ *
+ * Returns: when the frame will have finished leaving, counting the frames
+ *          still queued ahead of it
+ */
+static uint32_t SendFrame(MIL_ARQ *pArq, uint8_t type, uint8_t seq, const uint8_t *pData,
+                          uint8_t len, uint32_t now){
+
+    uint8_t raw[RAW_MAX];
+    uint8_t wire[MIL_ARQ_MAX_WIRE];
+    uint16_t sack = Sack(pArq);
+
+    raw[0] = type;
+    raw[1] = seq;
+    raw[2] = pArq->rx_next;
+    raw[3] = (uint8_t)sack;
+    raw[4] = (uint8_t)(sack >> 8);
+    if(len){ memcpy(&raw[MIL_ARQ_HEADER_LEN], pData, len); }
+
+    uint16_t n = MIL_ARQ_HEADER_LEN + len;
+    uint32_t crc = MIL_CRC32(MIL_CRC32_INIT, raw, n);
+
+    raw[n++] = (uint8_t)crc;
+    raw[n++] = (uint8_t)(crc >> 8);
+    raw[n++] = (uint8_t)(crc >> 16);
+    raw[n++] = (uint8_t)(crc >> 24);
+
+    n = CobsEncode(raw, n, wire);
+    wire[n++] = 0;
+
+    pArq->ack_due = false;
+
+    pArq->pOut(pArq->pCtx, wire, n);
+
+    if((int32_t)(pArq->wire_free - now) < 0){ pArq->wire_free = now; }
+    pArq->wire_free += n * pArq->byte_ticks;
+
+    return pArq->wire_free;
+
+}
+
+static void Resend(MIL_ARQ *pArq, uint8_t seq, uint32_t now){
+
+    uint8_t slot = seq & SLOT_MASK;
+
+    pArq->tx_tries[slot]++;
+    pArq->stats.retransmits++;
+
+    pArq->tx_time[slot] = SendFrame(pArq, MIL_ARQ_TYPE_DATA, seq, pArq->tx_data[slot],
+                                    pArq->tx_len[slot], now);
+
+}
+
+//retry timeout from the smoothed round trip time, drops any backoff
+static void RtoUpdate(MIL_ARQ *pArq){
+
+    if(pArq->srtt == 0){ return; }
+
+    /*
+     * A full window queued on the UART makes every round trip nearly the
+     * same, so rttvar drops to almost 0. One resend then delays the rest
+     * of the window past the timeout and they all go again. Half the
+     * round trip as a minimum margin stops that from snowballing
+     */
+    uint32_t margin = 4 * pArq->rttvar;
+    if(margin < pArq->srtt / 2){ margin = pArq->srtt / 2; }
+
+    uint32_t rto = pArq->srtt + margin;
+
+    if(rto < pArq->rto_min){ rto = pArq->rto_min; }
+    if(rto > pArq->rto_max){ rto = pArq->rto_max; }
+
+    pArq->rto = rto;
+
+}
+
+//RFC 6298 smoothing
+static void RttSample(MIL_ARQ *pArq, uint32_t rtt){
+
+    if(pArq->srtt == 0){
+
+        pArq->srtt = rtt;
+        pArq->rttvar = rtt / 2;
+
+    }
+    else{
+
+        uint32_t delta = (pArq->srtt > rtt) ? pArq->srtt - rtt : rtt - pArq->srtt;
+
+        pArq->rttvar = (3 * pArq->rttvar + delta) / 4;
+        pArq->srtt = (7 * pArq->srtt + rtt) / 8;
+
+    }
+
+}
+
+static void HandleAck(MIL_ARQ *pArq, uint8_t ack, uint16_t sack, uint32_t now){
+
+    uint8_t in_flight = pArq->tx_next - pArq->tx_base;
+
+    //ack must land between the oldest unacked and the next new seq
+    if((uint8_t)(ack - pArq->tx_base) > in_flight){ return; }
+
+    bool progress = false;
+    bool have_rtt = false;
+    uint32_t rtt = 0;
+    bool have_seen = false;
+    uint32_t seen_time = 0;     //latest send time of anything the receiver has
+
+    for(uint8_t i = 0; i < in_flight; i++){
+
+        uint8_t seq = pArq->tx_base + i;
+        uint8_t slot = seq & SLOT_MASK;
+
+        bool acked = SeqIn(seq, pArq->tx_base, (uint8_t)(ack - pArq->tx_base));
+
+        if(!acked){
+
+            uint8_t bit = (uint8_t)(seq - ack) - 1;
+            acked = (seq != ack) && bit < 16 && (sack & (1u << bit));
+
+            if(acked && (!have_seen || (int32_t)(pArq->tx_time[slot] - seen_time) > 0)){
+
+                seen_time = pArq->tx_time[slot];
+                have_seen = true;
+
+            }
+
+        }
+
+        if(acked && !pArq->tx_acked[slot]){
+
+            pArq->tx_acked[slot] = true;
+            progress = true;
+
+            if(pArq->tx_tries[slot] == 1){
+
+                int32_t sample = (int32_t)(now - pArq->tx_time[slot]);
+
+                //the most recently sent fresh message gives the best sample
+                if(sample > 0 && (!have_rtt || (uint32_t)sample < rtt)){ rtt = sample; have_rtt = true; }
+
+            }
+
+        }
+
+    }
+
+    if(have_rtt){ RttSample(pArq, rtt); }
+
+    //the link is clearly working again, stop backing off
+    if(progress){ RtoUpdate(pArq); }
+
+    //slide the window past everything acked
+    while(pArq->tx_base != pArq->tx_next && pArq->tx_acked[pArq->tx_base & SLOT_MASK]){
+
+        pArq->tx_acked[pArq->tx_base & SLOT_MASK] = false;
+        pArq->tx_base++;
+
+    }
+
+    if(!have_seen){ return; }
+
+    //fast retransmit, anything last sent before something that arrived is lost
+    in_flight = pArq->tx_next - pArq->tx_base;
+
+    for(uint8_t i = 0; i < in_flight; i++){
+
+        uint8_t seq = pArq->tx_base + i;
+        uint8_t slot = seq & SLOT_MASK;
+
+        if(!pArq->tx_acked[slot] && (int32_t)(seen_time - pArq->tx_time[slot]) > 0){
+
+            Resend(pArq, seq, now);
+
+        }
+
+    }
+
+}
+
+static void HandleData(MIL_ARQ *pArq, uint8_t seq, const uint8_t *pData, uint8_t len, uint32_t now){
+
+    bool in_order = (seq == pArq->rx_next);
+
+    if(SeqIn(seq, pArq->rx_next, MIL_ARQ_WINDOW)){
+
+        uint8_t slot = seq & SLOT_MASK;
+
+        if(pArq->rx_have[slot]){
+
+            pArq->stats.duplicates++;
+
+        }
+        else{
+
+            memcpy(pArq->rx_data[slot], pData, len);
+            pArq->rx_len[slot] = len;
+            pArq->rx_have[slot] = true;
+
+        }
+
+    }
+    else{
+
+        //already delivered, our ack for it must have been lost
+        pArq->stats.duplicates++;
+        in_order = false;
+
+    }
+
+    if(!pArq->ack_due){
+
+        pArq->ack_due = true;
+        pArq->ack_due_time = now;
+
+    }
+
+    //anything unusual gets acked right away so the sender can react
+    if(!in_order){ pArq->ack_due_time = now - pArq->ack_delay; }
+
+    //hand over everything that is now in order
+    while(pArq->rx_have[pArq->rx_next & SLOT_MASK]){
+
+        uint8_t slot = pArq->rx_next & SLOT_MASK;
+
+        //rx_next moves first so a reply sent from pDeliver acks this message
+        pArq->rx_have[slot] = false;
+        pArq->rx_next++;
+        pArq->stats.delivered++;
+
+        pArq->pDeliver(pArq->pCtx, pArq->rx_data[slot], pArq->rx_len[slot]);
+
+    }
+
+}
+
+static void HandleFrame(MIL_ARQ *pArq, uint32_t now){
+
+    uint8_t raw[RAW_MAX];
+    uint16_t len = CobsDecode(pArq->in_buf, pArq->in_len, raw, RAW_MAX);
+
+    if(len < MIL_ARQ_HEADER_LEN + MIL_ARQ_CRC_LEN){ pArq->stats.bad_frames++; return; }
+
+    uint16_t body = len - MIL_ARQ_CRC_LEN;
+    uint32_t crc = (uint32_t)raw[body] | ((uint32_t)raw[body + 1] << 8) |
+                   ((uint32_t)raw[body + 2] << 16) | ((uint32_t)raw[body + 3] << 24);
+
+    if(MIL_CRC32(MIL_CRC32_INIT, raw, body) != crc){ pArq->stats.bad_frames++; return; }
+
+    uint8_t type = raw[0];
+    uint8_t payload_len = (uint8_t)(body - MIL_ARQ_HEADER_LEN);
+
+    if(type == MIL_ARQ_TYPE_DATA && payload_len == 0){ pArq->stats.bad_frames++; return; }
+    if(type != MIL_ARQ_TYPE_DATA && type != MIL_ARQ_TYPE_ACK){ pArq->stats.bad_frames++; return; }
+
+    HandleAck(pArq, raw[2], (uint16_t)raw[3] | ((uint16_t)raw[4] << 8), now);
+
+    if(type == MIL_ARQ_TYPE_DATA){
+
+        HandleData(pArq, raw[1], &raw[MIL_ARQ_HEADER_LEN], payload_len, now);
+
+    }
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts one end of a link
+ */
+void MIL_ARQ_Init(MIL_ARQ *pArq, uint32_t ticks_per_ms, uint32_t byte_ticks,
+                  MIL_ARQ_OutFn pOut, MIL_ARQ_DeliverFn pDeliver, void *pCtx){
+
+    memset(pArq, 0, sizeof(*pArq));
+
+    pArq->byte_ticks = byte_ticks;
+
+    pArq->rto = MIL_ARQ_RTO_INIT_MS * ticks_per_ms;
+    pArq->rto_min = MIL_ARQ_RTO_MIN_MS * ticks_per_ms;
+    pArq->rto_max = MIL_ARQ_RTO_MAX_MS * ticks_per_ms;
+    pArq->ack_delay = MIL_ARQ_ACK_DELAY_MS * ticks_per_ms;
+
+    pArq->pOut = pOut;
+    pArq->pDeliver = pDeliver;
+    pArq->pCtx = pCtx;
+
+}
+
+/*
+ * Desc: Sends a message
+ *
+ * Returns: false if the window is full or len is out of range
+ */
+bool MIL_ARQ_Send(MIL_ARQ *pArq, const uint8_t *pData, uint8_t len, uint32_t now){
+
+    if(len == 0 || len > MIL_ARQ_MAX_PAYLOAD || !MIL_ARQ_CanSend(pArq)){ return false; }
+
+    uint8_t seq = pArq->tx_next++;
+    uint8_t slot = seq & SLOT_MASK;
+
+    memcpy(pArq->tx_data[slot], pData, len);
+    pArq->tx_len[slot] = len;
+    pArq->tx_tries[slot] = 1;
+    pArq->tx_acked[slot] = false;
+    pArq->stats.sent++;
+
+    pArq->tx_time[slot] = SendFrame(pArq, MIL_ARQ_TYPE_DATA, seq, pArq->tx_data[slot], len, now);
+
+    return true;
+
+}
+
+/*
+ * Desc: true if MIL_ARQ_Send has room for another message
+ */
+bool MIL_ARQ_CanSend(const MIL_ARQ *pArq){
+
+    return (uint8_t)(pArq->tx_next - pArq->tx_base) < MIL_ARQ_WINDOW;
+
+}
+
+/*
+ * Desc: Feeds in bytes received from the wire
+ */
+void MIL_ARQ_Rx(MIL_ARQ *pArq, const uint8_t *pBytes, uint16_t len, uint32_t now){
+
+    for(uint16_t i = 0; i < len; i++){
+
+        uint8_t b = pBytes[i];
+
+        if(b == 0){
+
+            if(pArq->in_overflow){ pArq->stats.bad_frames++; }
+            else if(pArq->in_len){ HandleFrame(pArq, now); }
+
+            pArq->in_len = 0;
+            pArq->in_overflow = false;
+
+        }
+        else if(pArq->in_len < MIL_ARQ_MAX_WIRE){
+
+            pArq->in_buf[pArq->in_len++] = b;
+
+        }
+        else{
+
+            //two frames ran together after a lost 0x00
+            pArq->in_overflow = true;
+
+        }
+
+    }
+
+}
+
+/*
+ * Desc: Resends timed out messages and sends acks that are due
+ */
+void MIL_ARQ_Poll(MIL_ARQ *pArq, uint32_t now){
+
+    bool timed_out = false;
+    uint8_t in_flight = pArq->tx_next - pArq->tx_base;
+
+    for(uint8_t i = 0; i < in_flight; i++){
+
+        uint8_t seq = pArq->tx_base + i;
+        uint8_t slot = seq & SLOT_MASK;
+
+        if(!pArq->tx_acked[slot] && (int32_t)(now - pArq->tx_time[slot]) >= (int32_t)pArq->rto){
+
+            Resend(pArq, seq, now);
+            timed_out = true;
+
+        }
+
+    }
+
+    //back off until a fresh round trip time comes in
+    if(timed_out){
+
+        pArq->rto = (pArq->rto > pArq->rto_max / 2) ? pArq->rto_max : pArq->rto * 2;
+
+    }
+
+    if(pArq->ack_due && (now - pArq->ack_due_time) >= pArq->ack_delay){
+
+        pArq->stats.acks++;
+        SendFrame(pArq, MIL_ARQ_TYPE_ACK, 0, 0, 0, now);
+
+    }
+
+}
+
+/*
+ * Desc: copies out the counters
+ */
+void MIL_ARQ_StatsGet(const MIL_ARQ *pArq, MIL_ARQ_Stats *pStats){
+
+    *pStats = pArq->stats;
+    pStats->srtt = pArq->srtt;
+    pStats->rto = pArq->rto;
+
+}
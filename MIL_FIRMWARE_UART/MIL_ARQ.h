@@ -0,0 +1,212 @@
+/*
+ * Name: MIL_ARQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Reliable delivery of messages over a link that loses bytes,
+ *       the protocol half of MIL_LINK
+ *
+ * What to understand: Every message goes out with a sequence number and
+ *                     stays in the sender's window until the other side
+ *                     acknowledges it. Anything not acknowledged in time
+ *                     is sent again(ARQ, automatic repeat request)
+ *
+ *                     Up to MIL_ARQ_WINDOW messages can be in flight at
+ *                     once, so the sender keeps the wire busy instead of
+ *                     waiting for each ack. Only the messages that were
+ *                     actually lost are sent again(selective repeat),
+ *                     and the receiver puts everything back in order
+ *
+ *                     Acks ride along in the header of normal messages
+ *                     going the other way(piggybacking). A separate ack
+ *                     only goes out when there is nothing to piggyback on
+ *
+ *                     The retry timeout follows the measured round trip
+ *                     time(same math as TCP), so a long tether gets a long
+ *                     timeout and a short one recovers quickly
+ *
+ *                     tools/link_sim.c runs this code on both ends of a simulated
+ *                     UART that drops and damages bytes, and measures goodput(in
+ *                     order, intact payload per second) against the loss rate
+ *
+ * Time Note:
+ *      Every function takes now, a free running 32 bit tick count.
+ *      On the board that is MIL_TIME cycles
+ *
+ * Frame Format(before COBS):
+ *      [type][seq][ack][sack u16][payload 0 to MIL_ARQ_MAX_PAYLOAD][crc u32]
+ *
+ *      ack is the next sequence number the sender of the frame expects,
+ *      bit i of sack means seq ack + 1 + i was received too
+ *
+ *      Frames are COBS encoded and end in a 0x00, so a lost byte only
+ *      costs the one frame it was in
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_ARQ_H_
+#define MIL_ARQ_H_
+
+//messages in flight, power of 2 and at most 16(the sack field)
+#ifndef MIL_ARQ_WINDOW
+#define MIL_ARQ_WINDOW 8
+#endif
+
+//largest message, at most 240 so a frame is one COBS block
+#ifndef MIL_ARQ_MAX_PAYLOAD
+#define MIL_ARQ_MAX_PAYLOAD 64
+#endif
+
+//retry timeout before the first round trip is measured, and its limits
+#ifndef MIL_ARQ_RTO_INIT_MS
+#define MIL_ARQ_RTO_INIT_MS 200
+#endif
+#define MIL_ARQ_RTO_MIN_MS 10
+#define MIL_ARQ_RTO_MAX_MS 2000
+
+//how long an ack waits for a message to ride along on
+#define MIL_ARQ_ACK_DELAY_MS 1
+
+#define MIL_ARQ_HEADER_LEN 5
+#define MIL_ARQ_CRC_LEN    4
+
+//largest frame on the wire: COBS code byte + frame + 0x00
+#define MIL_ARQ_MAX_WIRE (MIL_ARQ_HEADER_LEN + MIL_ARQ_MAX_PAYLOAD + MIL_ARQ_CRC_LEN + 2)
+
+#define MIL_ARQ_TYPE_DATA 0x01
+#define MIL_ARQ_TYPE_ACK  0x02
+
+/*
+ * Desc: counters for tuning a link
+ *
+ *       sent:        new messages sent
+ *       retransmits: messages sent again
+ *       delivered:   messages handed to the application
+ *       bad_frames:  frames thrown away(CRC, length, COBS errors)
+ *       duplicates:  messages received twice(an ack was lost)
+ *       acks:        separate ack frames sent
+ *       srtt:        smoothed round trip time(ticks)
+ *       rto:         current retry timeout(ticks)
+ */
+typedef struct{
+
+    uint32_t sent;
+    uint32_t retransmits;
+    uint32_t delivered;
+    uint32_t bad_frames;
+    uint32_t duplicates;
+    uint32_t acks;
+    uint32_t srtt;
+    uint32_t rto;
+
+}MIL_ARQ_Stats;
+
+/*
+ * Desc: called with one encoded frame to put on the wire
+ */
+typedef void (*MIL_ARQ_OutFn)(void *pCtx, const uint8_t *pFrame, uint16_t len);
+
+/*
+ * Desc: called with each received message, in order
+ */
+typedef void (*MIL_ARQ_DeliverFn)(void *pCtx, const uint8_t *pData, uint8_t len);
+
+/*
+ * Desc: one end of a link, all fields are private
+ */
+typedef struct{
+
+    //sender
+    uint8_t  tx_data[MIL_ARQ_WINDOW][MIL_ARQ_MAX_PAYLOAD];
+    uint8_t  tx_len[MIL_ARQ_WINDOW];
+    uint32_t tx_time[MIL_ARQ_WINDOW];   //when each last finished leaving
+    uint8_t  tx_tries[MIL_ARQ_WINDOW];
+    bool     tx_acked[MIL_ARQ_WINDOW];
+    uint8_t  tx_base;                   //oldest unacked
+    uint8_t  tx_next;                   //next new seq
+
+    //receiver
+    uint8_t  rx_data[MIL_ARQ_WINDOW][MIL_ARQ_MAX_PAYLOAD];
+    uint8_t  rx_len[MIL_ARQ_WINDOW];
+    bool     rx_have[MIL_ARQ_WINDOW];
+    uint8_t  rx_next;                   //next seq to deliver
+    bool     ack_due;
+    uint32_t ack_due_time;
+
+    //frame being received
+    uint8_t  in_buf[MIL_ARQ_MAX_WIRE];
+    uint16_t in_len;
+    bool     in_overflow;
+
+    //round trip timing
+    uint32_t srtt;
+    uint32_t rttvar;
+    uint32_t rto;
+    uint32_t rto_min;
+    uint32_t rto_max;
+    uint32_t ack_delay;
+    uint32_t byte_ticks;
+    uint32_t wire_free;                 //when everything sent so far has left
+
+    MIL_ARQ_OutFn     pOut;
+    MIL_ARQ_DeliverFn pDeliver;
+    void             *pCtx;
+
+    MIL_ARQ_Stats stats;
+
+}MIL_ARQ;
+
+/*
+ * Desc: Starts one end of a link
+ *
+ * Parameters:
+ *       pArq: the link end
+ *       ticks_per_ms: how fast now counts(16000 for MIL_TIME at 16MHz)
+ *       byte_ticks: time one byte takes on the wire(10 bits at the baud rate)
+ *       pOut: puts encoded frames on the wire
+ *       pDeliver: receives messages
+ *       pCtx: passed back to pOut and pDeliver
+ */
+void MIL_ARQ_Init(MIL_ARQ *pArq, uint32_t ticks_per_ms, uint32_t byte_ticks,
+                  MIL_ARQ_OutFn pOut, MIL_ARQ_DeliverFn pDeliver, void *pCtx);
+
+/*
+ * Desc: Sends a message
+ *
+ * Parameters:
+ *       pArq: the link end
+ *       pData: the message, copied so the caller can reuse it
+ *       len: 1 to MIL_ARQ_MAX_PAYLOAD
+ *       now: current tick
+ *
+ * Returns: false if the window is full(try again after MIL_ARQ_Poll)
+ *          or len is out of range
+ */
+bool MIL_ARQ_Send(MIL_ARQ *pArq, const uint8_t *pData, uint8_t len, uint32_t now);
+
+/*
+ * Desc: true if MIL_ARQ_Send has room for another message
+ */
+bool MIL_ARQ_CanSend(const MIL_ARQ *pArq);
+
+/*
+ * Desc: Feeds in bytes received from the wire, delivers
+ *       any messages that are now complete and in order
+ */
+void MIL_ARQ_Rx(MIL_ARQ *pArq, const uint8_t *pBytes, uint16_t len, uint32_t now);
+
+/*
+ * Desc: Resends timed out messages and sends acks that are due,
+ *       call often(every main loop pass)
+ */
+void MIL_ARQ_Poll(MIL_ARQ *pArq, uint32_t now);
+
+/*
+ * Desc: copies out the counters
+ */
+void MIL_ARQ_StatsGet(const MIL_ARQ *pArq, MIL_ARQ_Stats *pStats);
+
+#endif /* MIL_ARQ_H_ */
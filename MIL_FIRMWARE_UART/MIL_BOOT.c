@@ -0,0 +1,517 @@
+/*
+ * Name: MIL_BOOT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Serial bootloader for updating firmware over MIL_UART
+ *
+ * Implementation Notes:
+ *       Commands are read by polling, the bootloader has nothing
+ *       else to do so there is no point in interrupts
+ *
+ *       Stream frames are received by DMA into one of two frame buffers.
+ *       As soon as a frame lands, DMA is re-armed on the other buffer and
+ *       the frame is acked, so the host starts sending the next frame
+ *       while this one is erased/programmed. The CPU stalls while flash
+ *       is busy but DMA does not, it only touches the UART and SRAM
+ *
+ *       An even chunk(first half of a page) erases the page and programs
+ *       the first half, an odd chunk programs the second half. That way a
+ *       frame buffer is always free again before DMA needs it. The flash
+ *       result of a chunk is reported in the status byte of the NEXT reply
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
+#include "driverlib/flash.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+#include "MIL_CRC.h"
+#include "MIL_DMA.h"
+#include "MIL_UART.h"
+#include "MIL_BOOT.h"
+
+//which UART the bootloader listens on, UART0 is the launchpad debug USB port
+#ifndef MIL_BOOT_UART_BASE
+#define MIL_BOOT_UART_BASE   UART0_BASE
+#define MIL_BOOT_UART_DMA_RX UDMA_CH8_UART0RX
+#endif
+
+//the app and the flasher both start here
+#define BOOT_BAUD MIL_DEFAULT_BAUD_115K
+
+//valid application stack pointer range(32KB SRAM)
+#define SRAM_START 0x20000000
+#define SRAM_END   0x20008000
+
+#define INFO_MAGIC 0x4D494C42u   //"MILB"
+
+#define RX_CHANNEL (MIL_BOOT_UART_DMA_RX & 0xFF)
+
+/*
+ * Desc: written to MIL_BOOT_INFO_ADDR after a good update
+ */
+typedef struct{
+
+    uint32_t magic;
+    uint32_t length;
+    uint32_t crc;
+    uint32_t magic_inv;
+
+}BootInfo;
+
+/*
+ * Desc: a command or stream frame header
+ */
+typedef struct{
+
+    uint8_t  cmd;
+    uint16_t arg0;
+    uint32_t arg1;
+
+}BootCmd;
+
+//no chunk acked yet in this stream
+#define NO_CHUNK 0xFFFFFFFF
+
+//stream wait granularity, SysCtlDelay takes 3 cycles per loop
+#define WAIT_TICKS_PER_MS 10
+
+//word arrays so FlashProgram gets aligned data
+static uint32_t FRAME_BUF[2][MIL_BOOT_FRAME_LEN / 4];
+
+/************************UART HELPERS******************************/
+
+static void SetupUART(uint32_t baud){
+
+    MIL_InitUART(MIL_BOOT_UART_BASE, baud);
+
+    //RX DMA requests a burst at 4 bytes, matching UDMA_ARB_4 below
+    MIL_UART_FIFOEn(MIL_BOOT_UART_BASE, 2);
+    UARTDMAEnable(MIL_BOOT_UART_BASE, UART_DMA_RX);
+
+}
+
+static uint32_t GetU16(const uint8_t *p){ return p[0] | (p[1] << 8); }
+
+static uint32_t GetU32(const uint8_t *p){
+
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+
+}
+
+static void PutU32(uint32_t value){
+
+    for(uint8_t i = 0; i < 4; i++){ UARTCharPut(MIL_BOOT_UART_BASE, (value >> (8 * i)) & 0xFF); }
+
+}
+
+static void Reply(uint8_t ack, uint8_t status, uint16_t arg0){
+
+    uint8_t msg[MIL_BOOT_REPLY_LEN] = {ack, status, arg0 & 0xFF, arg0 >> 8};
+
+    MIL_UART_OutArray(MIL_BOOT_UART_BASE, msg, MIL_BOOT_REPLY_LEN);
+
+}
+
+static void ParseHeader(const uint8_t *pHdr, BootCmd *pCmd){
+
+    pCmd->cmd = pHdr[1];
+    pCmd->arg0 = GetU16(&pHdr[2]);
+    pCmd->arg1 = GetU32(&pHdr[4]);
+
+}
+
+/*
+ * Desc: blocks until a full command arrives,
+ *       skips anything before the SOF byte
+ */
+static void ReadCmd(BootCmd *pCmd, bool have_sof){
+
+    uint8_t hdr[MIL_BOOT_CMD_LEN];
+
+    if(!have_sof){
+
+        while(UARTCharGet(MIL_BOOT_UART_BASE) != MIL_BOOT_SOF);
+
+    }
+
+    hdr[0] = MIL_BOOT_SOF;
+    for(uint8_t i = 1; i < MIL_BOOT_CMD_LEN; i++){ hdr[i] = UARTCharGet(MIL_BOOT_UART_BASE); }
+
+    ParseHeader(hdr, pCmd);
+
+}
+
+static void WaitTxDone(void){
+
+    while(UARTBusy(MIL_BOOT_UART_BASE));
+
+}
+
+/************************DMA HELPERS******************************/
+
+static void ArmRx(uint8_t buf){
+
+    uDMAChannelTransferSet(RX_CHANNEL | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC,
+                           (void *)(MIL_BOOT_UART_BASE + UART_O_DR),
+                           FRAME_BUF[buf],
+                           MIL_BOOT_FRAME_LEN);
+
+    uDMAChannelEnable(RX_CHANNEL);
+
+}
+
+/*
+ * Desc: waits for the armed frame to land
+ *
+ * Returns: false if no byte came in for MIL_BOOT_STREAM_TIMEOUT_MS
+ */
+static bool WaitFrame(void){
+
+    uint32_t tick = SysCtlClockGet() / (3000 * WAIT_TICKS_PER_MS);
+    uint32_t left = uDMAChannelSizeGet(RX_CHANNEL | UDMA_PRI_SELECT);
+    uint32_t idle = 0;
+
+    while(uDMAChannelIsEnabled(RX_CHANNEL)){
+
+        SysCtlDelay(tick);
+
+        uint32_t now_left = uDMAChannelSizeGet(RX_CHANNEL | UDMA_PRI_SELECT);
+
+        //any byte in restarts the timeout, only a stalled line ends it
+        if(now_left != left){ left = now_left; idle = 0; }
+        else if(++idle >= MIL_BOOT_STREAM_TIMEOUT_MS * WAIT_TICKS_PER_MS){ return false; }
+
+    }
+
+    return true;
+
+}
+
+//stops a half filled frame and throws away whatever is still in the FIFO
+static void ResetRx(void){
+
+    uDMAChannelDisable(RX_CHANNEL);
+
+    while(UARTCharsAvail(MIL_BOOT_UART_BASE)){ UARTCharGetNonBlocking(MIL_BOOT_UART_BASE); }
+
+}
+
+static void InitRxDMA(void){
+
+    MIL_DMA_Init();
+
+    uDMAChannelAssign(MIL_BOOT_UART_DMA_RX);
+    uDMAChannelAttributeDisable(RX_CHANNEL, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(RX_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE |
+                          UDMA_DST_INC_8 | UDMA_ARB_4);
+
+}
+
+/************************FLASH HELPERS******************************/
+
+static uint8_t ProgramChunk(uint32_t chunk, uint32_t *pData){
+
+    uint32_t addr = MIL_BOOT_APP_BASE + chunk * MIL_BOOT_CHUNK_SIZE;
+
+    //first half of a page, the page has to be erased first
+    if((addr % MIL_BOOT_PAGE_SIZE) == 0){
+
+        if(FlashErase(addr) != 0){ return MIL_BOOT_ERR_FLASH; }
+
+    }
+
+    if(FlashProgram(pData, addr, MIL_BOOT_CHUNK_SIZE) != 0){ return MIL_BOOT_ERR_FLASH; }
+
+    return MIL_BOOT_OK;
+
+}
+
+static uint8_t WriteInfo(uint32_t length, uint32_t crc){
+
+    BootInfo info = {INFO_MAGIC, length, crc, ~INFO_MAGIC};
+
+    if(FlashErase(MIL_BOOT_INFO_ADDR) != 0){ return MIL_BOOT_ERR_FLASH; }
+    if(FlashProgram((uint32_t *)&info, MIL_BOOT_INFO_ADDR, sizeof(info)) != 0){ return MIL_BOOT_ERR_FLASH; }
+
+    return MIL_BOOT_OK;
+
+}
+
+/************************COMMANDS******************************/
+
+/*
+ * Desc: receives stream frames until END, see implementation notes
+ *
+ *       the reply to END carries the final status of the whole update
+ */
+static void Stream(void){
+
+    uint8_t  buf = 0;
+    uint8_t  status = MIL_BOOT_OK;
+    uint32_t next_odd = NO_CHUNK;      //odd chunk that has to come next, if any
+    uint32_t last_chunk = NO_CHUNK;    //last chunk acked and its CRC, for resends
+    uint32_t last_crc = 0;
+
+    //nothing may jump into the old app while it is being replaced
+    FlashErase(MIL_BOOT_INFO_ADDR);
+
+    ArmRx(buf);
+    Reply(MIL_BOOT_ACK, MIL_BOOT_OK, 0);
+
+    while(1){
+
+        if(!WaitFrame()){
+
+            ResetRx();
+            Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_TIMEOUT, 0);
+            return;
+
+        }
+
+        uint8_t *pFrame = (uint8_t *)FRAME_BUF[buf];
+        uint8_t *pData = pFrame + MIL_BOOT_CMD_LEN;
+        BootCmd hdr;
+        ParseHeader(pFrame, &hdr);
+
+        bool good = (pFrame[0] == MIL_BOOT_SOF);
+        if(good && hdr.cmd == MIL_BOOT_CMD_WRITE){
+
+            good = (MIL_CRC32(MIL_CRC32_INIT, pData, MIL_BOOT_CHUNK_SIZE) == hdr.arg1);
+
+        }
+        else if(hdr.cmd != MIL_BOOT_CMD_END){
+
+            good = false;
+
+        }
+
+        //bad frame, take it again into the same buffer
+        if(!good){
+
+            ArmRx(buf);
+            Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_CRC, hdr.arg0);
+            continue;
+
+        }
+
+        if(hdr.cmd == MIL_BOOT_CMD_END){
+
+            uint32_t length = GetU32(pData);
+
+            if(status == MIL_BOOT_OK && length > MIL_BOOT_APP_MAX){ status = MIL_BOOT_ERR_ADDR; }
+
+            if(status == MIL_BOOT_OK &&
+               MIL_CRC32(MIL_CRC32_INIT, (const uint8_t *)MIL_BOOT_APP_BASE, length) != hdr.arg1){
+
+                status = MIL_BOOT_ERR_VERIFY;
+
+            }
+
+            if(status == MIL_BOOT_OK){ status = WriteInfo(length, hdr.arg1); }
+
+            Reply(status == MIL_BOOT_OK ? MIL_BOOT_ACK : MIL_BOOT_NAK, status, 0);
+            return;
+
+        }
+
+        //good WRITE frame, let the host send the next one right away
+        uint32_t chunk = hdr.arg0;
+        uint8_t this_buf = buf;
+        buf ^= 1;
+        ArmRx(buf);
+        Reply(MIL_BOOT_ACK, status, hdr.arg0);
+
+        //the host lost our ack and sent the same chunk again, it is already programmed
+        if(chunk == last_chunk && hdr.arg1 == last_crc){ continue; }
+
+        last_chunk = chunk;
+        last_crc = hdr.arg1;
+
+        //once anything fails the rest of the stream is only acked, END reports it
+        if(status != MIL_BOOT_OK){ continue; }
+
+        if((chunk + 1) * MIL_BOOT_CHUNK_SIZE > MIL_BOOT_APP_MAX ||
+           ((chunk & 1) && chunk != next_odd) ||
+           (!(chunk & 1) && next_odd != NO_CHUNK)){
+
+            status = MIL_BOOT_ERR_ADDR;
+            continue;
+
+        }
+
+        next_odd = (chunk & 1) ? NO_CHUNK : chunk + 1;
+        status = ProgramChunk(chunk, FRAME_BUF[this_buf] + MIL_BOOT_CMD_LEN / 4);
+
+    }
+
+}
+
+static void PageCRCs(uint16_t count, uint32_t first_page){
+
+    const uint32_t app_pages = MIL_BOOT_APP_MAX / MIL_BOOT_PAGE_SIZE;
+
+    //compared in pages so a huge first_page can't wrap the byte math
+    if(count > MIL_BOOT_MAX_CRC_PAGES || first_page > app_pages || count > app_pages - first_page){
+
+        Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_ARG, count);
+        return;
+
+    }
+
+    Reply(MIL_BOOT_ACK, MIL_BOOT_OK, count);
+
+    for(uint32_t page = first_page; page < first_page + count; page++){
+
+        const uint8_t *pPage = (const uint8_t *)(MIL_BOOT_APP_BASE + page * MIL_BOOT_PAGE_SIZE);
+        PutU32(MIL_CRC32(MIL_CRC32_INIT, pPage, MIL_BOOT_PAGE_SIZE));
+
+    }
+
+}
+
+/*
+ * Desc: hands the CPU to the application, never returns
+ *
+ *       The app's vector table starts with its stack pointer then its
+ *       reset handler. VTOR is moved so the app's interrupts are used
+ */
+static void JumpToApp(void){
+
+    uint32_t sp = HWREG(MIL_BOOT_APP_BASE);
+    uint32_t pc = HWREG(MIL_BOOT_APP_BASE + 4);
+
+    WaitTxDone();
+    UARTDMADisable(MIL_BOOT_UART_BASE, UART_DMA_RX);
+    uDMAChannelDisable(RX_CHANNEL);
+
+    HWREG(NVIC_VTABLE) = MIL_BOOT_APP_BASE;
+
+    __asm volatile("    msr msp, %0\n"
+                   "    bx  %1\n"
+                   : : "r"(sp), "r"(pc));
+
+    while(1);
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Checks the info record and application vector table
+ *
+ * Returns: true if a complete application is in flash
+ */
+bool MIL_BOOT_AppValid(void){
+
+    const BootInfo *pInfo = (const BootInfo *)MIL_BOOT_INFO_ADDR;
+    uint32_t sp = HWREG(MIL_BOOT_APP_BASE);
+    uint32_t pc = HWREG(MIL_BOOT_APP_BASE + 4);
+
+    if(pInfo->magic != INFO_MAGIC || pInfo->magic_inv != ~INFO_MAGIC){ return false; }
+    if(pInfo->length < 8 || pInfo->length > MIL_BOOT_APP_MAX){ return false; }
+    if(sp < SRAM_START || sp > SRAM_END){ return false; }
+    if(pc < MIL_BOOT_APP_BASE || pc >= MIL_BOOT_APP_BASE + pInfo->length){ return false; }
+
+    return MIL_CRC32(MIL_CRC32_INIT, (const uint8_t *)MIL_BOOT_APP_BASE, pInfo->length) == pInfo->crc;
+
+}
+
+/*
+ * Desc: Runs the bootloader, never returns
+ *
+ * Parameters:
+ *       wait_ms: how long to listen after reset
+ */
+void MIL_BOOT_Run(uint32_t wait_ms){
+
+    bool app_valid = MIL_BOOT_AppValid();
+    bool have_sof = false;
+
+    SetupUART(BOOT_BAUD);
+    InitRxDMA();
+
+    //SysCtlDelay takes 3 cycles per loop
+    uint32_t ms_delay = SysCtlClockGet() / 3000;
+
+    while(app_valid && !have_sof && wait_ms--){
+
+        SysCtlDelay(ms_delay);
+
+        while(UARTCharsAvail(MIL_BOOT_UART_BASE)){
+
+            if(UARTCharGetNonBlocking(MIL_BOOT_UART_BASE) == MIL_BOOT_SOF){ have_sof = true; break; }
+
+        }
+
+    }
+
+    if(app_valid && !have_sof){ JumpToApp(); }
+
+    while(1){
+
+        BootCmd cmd;
+        ReadCmd(&cmd, have_sof);
+        have_sof = false;
+
+        switch(cmd.cmd){
+
+            case MIL_BOOT_CMD_PING:
+                Reply(MIL_BOOT_ACK, MIL_BOOT_OK, 0);
+                break;
+
+            case MIL_BOOT_CMD_BAUD:
+                //the UART divider can't go below 1(clock / 16) or hold a tiny baud
+                if(cmd.arg1 < MIL_BOOT_MIN_BAUD || cmd.arg1 > SysCtlClockGet() / 16){
+
+                    Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_ARG, 0);
+                    break;
+
+                }
+                Reply(MIL_BOOT_ACK, MIL_BOOT_OK, 0);
+                WaitTxDone();
+                SetupUART(cmd.arg1);
+                break;
+
+            case MIL_BOOT_CMD_INFO:
+                Reply(MIL_BOOT_ACK, MIL_BOOT_OK, 0);
+                PutU32(MIL_BOOT_APP_BASE);
+                PutU32(MIL_BOOT_APP_MAX);
+                PutU32(MIL_BOOT_PAGE_SIZE);
+                PutU32(MIL_BOOT_CHUNK_SIZE);
+                break;
+
+            case MIL_BOOT_CMD_CRC:
+                PageCRCs(cmd.arg0, cmd.arg1);
+                break;
+
+            case MIL_BOOT_CMD_STREAM:
+                Stream();
+                break;
+
+            case MIL_BOOT_CMD_RUN:
+                if(MIL_BOOT_AppValid()){
+
+                    Reply(MIL_BOOT_ACK, MIL_BOOT_OK, 0);
+                    JumpToApp();
+
+                }
+                Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_VERIFY, 0);
+                break;
+
+            default:
+                Reply(MIL_BOOT_NAK, MIL_BOOT_ERR_CMD, cmd.cmd);
+                break;
+
+        };
+
+    }
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Name: MIL_BOOT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Serial bootloader for updating firmware over MIL_UART
+ *       without CCS or a JTAG connection
+ *
+ * What to understand: The bootloader is its own small program that lives
+ *                     at the start of flash and runs first after every reset.
+ *                     It waits briefly for the flasher tool(tools/mil_flash.py)
+ *                     and if nothing shows up it jumps to your application
+ *
+ *                     Your application has to be linked to start at
+ *                     MIL_BOOT_APP_BASE instead of 0x0. In CCS change the
+ *                     FLASH origin in the .cmd linker file to 0x00004000
+ *                     and the length to 0x0003BC00
+ *
+ * Speed Notes:
+ *      The update starts at 115.2k and the flasher then switches both
+ *      ends to MIL_BOOT_FAST_BAUD(1M, the fastest a 16MHz clock can do)
+ *
+ *      Data is received by DMA straight into RAM while the CPU erases
+ *      and programs the previous chunk, so flash time hides behind
+ *      wire time instead of adding to it
+ *
+ *      Before streaming, the flasher asks for the CRC of every page already
+ *      on the board and only sends pages that changed(delta update)
+ *
+ * Power Loss Note:
+ *      The last flash page holds an info record(length + CRC of the
+ *      application). It is erased before an update starts and only
+ *      rewritten once the whole new image checks out, so an update
+ *      cut short leaves the board in the bootloader instead of
+ *      jumping into half an application
+ *
+ * Memory Map(TM4C123GH6PM, 256KB flash):
+ *      0x00000000 - 0x00003FFF : bootloader
+ *      0x00004000 - 0x0003FBFF : application
+ *      0x0003FC00 - 0x0003FFFF : info record
+ *
+ * Wire Protocol(all values little endian):
+ *      Command(host -> board, 8 bytes):
+ *          [SOF][cmd][arg0 u16][arg1 u32]
+ *
+ *      Stream frame(host -> board, 8 + MIL_BOOT_CHUNK_SIZE bytes):
+ *          [SOF][WRITE or END][chunk u16][crc u32][data]
+ *
+ *      Reply(board -> host):
+ *          [ACK or NAK][status][arg0 u16] followed by any reply data
+ *
+ * Recovery Notes:
+ *      A WRITE frame for the chunk that was just acked, with the same CRC,
+ *      is acked again without programming. That is the host resending
+ *      because it never saw the ack
+ *
+ *      If a stream frame stops arriving part way(or never starts) for
+ *      MIL_BOOT_STREAM_TIMEOUT_MS, the bootloader stops the DMA, empties
+ *      the RX FIFO, NAKs with MIL_BOOT_ERR_TIMEOUT and goes back to
+ *      taking commands. The app stays invalid until a stream completes
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_BOOT_H_
+#define MIL_BOOT_H_
+
+/************************MEMORY MAP******************************/
+
+#define MIL_BOOT_FLASH_SIZE 0x00040000
+#define MIL_BOOT_PAGE_SIZE  1024    //flash erase size
+#define MIL_BOOT_APP_BASE   0x00004000
+#define MIL_BOOT_INFO_ADDR  (MIL_BOOT_FLASH_SIZE - MIL_BOOT_PAGE_SIZE)
+#define MIL_BOOT_APP_MAX    (MIL_BOOT_INFO_ADDR - MIL_BOOT_APP_BASE)
+
+//data per stream frame, half a page so a frame fits in one DMA transfer
+#define MIL_BOOT_CHUNK_SIZE 512
+
+/************************PROTOCOL******************************/
+
+#define MIL_BOOT_SOF 0xA5
+#define MIL_BOOT_ACK 0x79
+#define MIL_BOOT_NAK 0x1F
+
+#define MIL_BOOT_CMD_LEN   8
+#define MIL_BOOT_REPLY_LEN 4
+#define MIL_BOOT_FRAME_LEN (MIL_BOOT_CMD_LEN + MIL_BOOT_CHUNK_SIZE)
+
+//commands
+#define MIL_BOOT_CMD_PING   0x01    //just replies
+#define MIL_BOOT_CMD_BAUD   0x02    //arg1: new baud, switches after the reply(NAK if out of range)
+#define MIL_BOOT_CMD_INFO   0x03    //replies app base, app max, page size, chunk size(u32 each)
+#define MIL_BOOT_CMD_CRC    0x04    //arg0: page count(max 64) arg1: first page, replies one CRC per page
+#define MIL_BOOT_CMD_STREAM 0x05    //invalidates the app and starts taking stream frames
+#define MIL_BOOT_CMD_RUN    0x06    //jumps to the app if it is valid
+
+//stream frames
+#define MIL_BOOT_CMD_WRITE  0x10    //chunk: which chunk of the app region, crc: of the data
+#define MIL_BOOT_CMD_END    0x11    //crc: of the whole image, data[0..3]: image length
+
+#define MIL_BOOT_MAX_CRC_PAGES 64
+
+//status byte in replies
+#define MIL_BOOT_OK         0x00
+#define MIL_BOOT_ERR_CRC    0x01    //frame data did not match its CRC
+#define MIL_BOOT_ERR_ADDR   0x02    //chunk outside the app region or out of order
+#define MIL_BOOT_ERR_FLASH  0x03    //erase or program failed
+#define MIL_BOOT_ERR_VERIFY 0x04    //image CRC did not match after programming
+#define MIL_BOOT_ERR_CMD    0x05    //unknown command
+#define MIL_BOOT_ERR_ARG    0x06    //command argument out of range(baud, page range)
+#define MIL_BOOT_ERR_TIMEOUT 0x07   //stream frame stopped arriving, back in command mode
+
+//how long a stream frame may go without a new byte
+#ifndef MIL_BOOT_STREAM_TIMEOUT_MS
+#define MIL_BOOT_STREAM_TIMEOUT_MS 1000
+#endif
+
+//slowest baud BAUD accepts, the fastest is the system clock / 16
+#define MIL_BOOT_MIN_BAUD 9600
+
+//fast update baud, 16MHz / 16
+#define MIL_BOOT_FAST_BAUD 1000000
+
+/*
+ * Desc: Runs the bootloader, never returns
+ *
+ *       Waits wait_ms for the flasher to send anything. If it does,
+ *       stays in the bootloader until told to run the app. If it
+ *       does not, jumps straight to the app
+ *
+ *       If there is no valid app the bootloader waits forever
+ *
+ * Parameters:
+ *       wait_ms: how long to listen after reset
+ */
+void MIL_BOOT_Run(uint32_t wait_ms);
+
+/*
+ * Desc: Checks the info record and application vector table
+ *
+ * Returns: true if a complete application is in flash
+ */
+bool MIL_BOOT_AppValid(void);
+
+#endif /* MIL_BOOT_H_ */
@@ -0,0 +1,254 @@
+/*
+ * Name: MIL_BUS
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Poll schedule for several boards sharing one RS-485 bus
+ *
+ * Implementation Notes:
+ *       Frames have no start marker in the data, a frame ends when the
+ *       header's length says so or when the line goes quiet for
+ *       MIL_BUS_GAP_BYTES. The turnaround is always longer than that gap,
+ *       so the first byte after any turnaround starts a fresh frame
+ *
+ *       Every send works out when its last byte will be done from the byte
+ *       time. The master's reply timeout and the next poll count from
+ *       there, not from when the frame was queued
+ *
+ *       The master only gives up on a reply while nothing is arriving. A
+ *       reply that started just before the timeout is waited for instead
+ *       of being talked over
+ *
+ *       Time compares are signed differences so MIL_TIME wrapping is fine
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "MIL_CRC.h"
+#include "MIL_BUS.h"
+
+#define STATE_IDLE      0
+#define STATE_WAIT      1   //master waiting for a reply
+#define STATE_REPLY_DUE 2   //node about to reply
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static bool Reached(uint32_t now, uint32_t when){
+
+    return (int32_t)(now - when) >= 0;
+
+}
+
+/*
+ * Desc: builds and sends one frame
+ *
+ * Returns: when its last byte will be done
+ */
+static uint32_t SendFrame(MIL_BUS *pBus, uint8_t dst, uint8_t type, uint32_t now){
+
+    uint8_t frame[MIL_BUS_MAX_FRAME];
+
+    uint8_t len = pBus->pFill(pBus->pCtx, dst, &frame[MIL_BUS_HEADER_LEN]);
+    if(len > MIL_BUS_MAX_PAYLOAD){ len = MIL_BUS_MAX_PAYLOAD; }
+
+    frame[0] = dst;
+    frame[1] = pBus->address;
+    frame[2] = type;
+    frame[3] = len;
+
+    uint8_t n = MIL_BUS_HEADER_LEN + len;
+    uint32_t crc = MIL_CRC32(MIL_CRC32_INIT, frame, n);
+
+    for(uint8_t i = 0; i < MIL_BUS_CRC_LEN; i++){ frame[n++] = (uint8_t)(crc >> (8 * i)); }
+
+    pBus->pOut(pBus->pCtx, frame, n);
+
+    return now + n * pBus->byte_ticks;
+
+}
+
+static void NextNode(MIL_BUS *pBus, uint32_t due){
+
+    pBus->state = STATE_IDLE;
+    pBus->due = due;
+
+    if(++pBus->node_idx >= pBus->num_nodes){ pBus->node_idx = 0; }
+
+}
+
+static void HandleFrame(MIL_BUS *pBus, uint32_t now){
+
+    const uint8_t *pF = pBus->in_buf;
+    uint8_t n = MIL_BUS_HEADER_LEN + pF[3];
+
+    uint32_t crc = (uint32_t)pF[n] | ((uint32_t)pF[n + 1] << 8) |
+                   ((uint32_t)pF[n + 2] << 16) | ((uint32_t)pF[n + 3] << 24);
+
+    if(crc != MIL_CRC32(MIL_CRC32_INIT, pF, n)){ pBus->stats.bad_frames++; return; }
+
+    //not for us(only seen when the hardware address filter is off)
+    if(pF[0] != pBus->address){ return; }
+
+    uint8_t src = pF[1];
+    uint8_t type = pF[2];
+
+    if(pBus->master){
+
+        if(type != MIL_BUS_TYPE_REPLY || pBus->state != STATE_WAIT ||
+           src != pBus->nodes[pBus->node_idx]){
+
+            //the bus was busy, give it a full turnaround before the next poll
+            pBus->stats.stray_frames++;
+            if(pBus->state == STATE_IDLE && !Reached(pBus->due, now + pBus->turnaround)){
+
+                pBus->due = now + pBus->turnaround;
+
+            }
+            return;
+
+        }
+
+        pBus->stats.replies++;
+        NextNode(pBus, now + pBus->turnaround);
+
+    }
+    else{
+
+        if(type != MIL_BUS_TYPE_POLL || src != MIL_BUS_MASTER_ADDR){ pBus->stats.stray_frames++; return; }
+
+        pBus->state = STATE_REPLY_DUE;
+        pBus->due = now + pBus->turnaround;
+
+    }
+
+    if(pF[3]){ pBus->pDeliver(pBus->pCtx, src, &pF[MIL_BUS_HEADER_LEN], pF[3]); }
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_BUS_Init(MIL_BUS *pBus, uint8_t address, uint32_t byte_ticks,
+                  MIL_BUS_OutFn pOut, MIL_BUS_FillFn pFill, MIL_BUS_DeliverFn pDeliver,
+                  void *pCtx){
+
+    memset(pBus, 0, sizeof(*pBus));
+
+    pBus->address = address;
+    pBus->byte_ticks = byte_ticks;
+    pBus->pOut = pOut;
+    pBus->pFill = pFill;
+    pBus->pDeliver = pDeliver;
+    pBus->pCtx = pCtx;
+
+    MIL_BUS_TimingSet(pBus, MIL_BUS_TURNAROUND_BYTES * byte_ticks, MIL_BUS_TIMEOUT_BYTES * byte_ticks);
+
+}
+
+void MIL_BUS_TimingSet(MIL_BUS *pBus, uint32_t turnaround, uint32_t timeout){
+
+    uint32_t min_turnaround = (MIL_BUS_GAP_BYTES + 1) * pBus->byte_ticks;
+    if(turnaround < min_turnaround){ turnaround = min_turnaround; }
+
+    //turnaround, then time for the first byte of the reply to show up
+    uint32_t min_timeout = turnaround + 2 * pBus->byte_ticks;
+    if(timeout < min_timeout){ timeout = min_timeout; }
+
+    pBus->turnaround = turnaround;
+    pBus->timeout = timeout;
+
+}
+
+bool MIL_BUS_MasterStart(MIL_BUS *pBus, const uint8_t *pNodes, uint8_t num_nodes, uint32_t now){
+
+    if(num_nodes == 0 || num_nodes > MIL_BUS_MAX_NODES){ return false; }
+
+    memcpy(pBus->nodes, pNodes, num_nodes);
+    pBus->num_nodes = num_nodes;
+    pBus->node_idx = 0;
+    pBus->master = true;
+    pBus->state = STATE_IDLE;
+    pBus->due = now;
+
+    return true;
+
+}
+
+void MIL_BUS_Rx(MIL_BUS *pBus, uint8_t byte, uint32_t now){
+
+    //silence ends whatever was being received
+    if(pBus->in_len && Reached(now, pBus->last_rx + MIL_BUS_GAP_BYTES * pBus->byte_ticks)){
+
+        pBus->stats.bad_frames++;
+        pBus->in_len = 0;
+
+    }
+
+    pBus->last_rx = now;
+    pBus->in_buf[pBus->in_len++] = byte;
+
+    if(pBus->in_len < MIL_BUS_HEADER_LEN){ return; }
+
+    if(pBus->in_buf[3] > MIL_BUS_MAX_PAYLOAD){
+
+        pBus->stats.bad_frames++;
+        pBus->in_len = 0;
+        return;
+
+    }
+
+    if(pBus->in_len < MIL_BUS_HEADER_LEN + pBus->in_buf[3] + MIL_BUS_CRC_LEN){ return; }
+
+    pBus->in_len = 0;
+    HandleFrame(pBus, now);
+
+}
+
+void MIL_BUS_Poll(MIL_BUS *pBus, uint32_t now){
+
+    //a frame that went quiet part way is dropped here too
+    if(pBus->in_len && Reached(now, pBus->last_rx + MIL_BUS_GAP_BYTES * pBus->byte_ticks)){
+
+        pBus->stats.bad_frames++;
+        pBus->in_len = 0;
+
+    }
+
+    if(!pBus->master){
+
+        if(pBus->state == STATE_REPLY_DUE && Reached(now, pBus->due)){
+
+            pBus->state = STATE_IDLE;
+            pBus->stats.polls++;
+            SendFrame(pBus, MIL_BUS_MASTER_ADDR, MIL_BUS_TYPE_REPLY, now);
+
+        }
+
+        return;
+
+    }
+
+    if(pBus->state == STATE_WAIT && pBus->in_len == 0 && Reached(now, pBus->deadline)){
+
+        pBus->stats.timeouts++;
+        pBus->stats.node_timeouts[pBus->node_idx]++;
+        NextNode(pBus, now);
+
+    }
+
+    if(pBus->state == STATE_IDLE && pBus->in_len == 0 && Reached(now, pBus->due)){
+
+        uint32_t done = SendFrame(pBus, pBus->nodes[pBus->node_idx], MIL_BUS_TYPE_POLL, now);
+
+        pBus->stats.polls++;
+        pBus->state = STATE_WAIT;
+        pBus->deadline = done + pBus->timeout;
+
+    }
+
+}
+
+void MIL_BUS_StatsGet(const MIL_BUS *pBus, MIL_BUS_Stats *pStats){
+
+    *pStats = pBus->stats;
+
+}
@@ -0,0 +1,213 @@
+/*
+ * Name: MIL_BUS
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Poll schedule for several boards sharing one RS-485 bus,
+ *       the protocol half of MIL_RS485
+ *
+ * What to understand: RS-485 is one pair of wires shared by every board,
+ *                     only one board may drive it at a time. If two talk
+ *                     at once both messages are garbage(a collision)
+ *
+ *                     One board is the master, every other board is a
+ *                     node with its own address. The master polls the
+ *                     nodes in turn, a node only ever talks when it has
+ *                     just been polled, so nobody collides:
+ *
+ *                        master --- poll(+ data for node 1) ---> node 1
+ *                        master <--- reply(+ data from node 1) -- node 1
+ *                        master --- poll ---> node 2
+ *                        ...
+ *
+ *                     Being polled is like holding a token, the reply
+ *                     hands it back
+ *
+ *                     tools/bus_sim.c runs a master and several nodes on one
+ *                     simulated bus, bit by bit, and counts collisions, timeouts
+ *                     and wakeups for a range of turnaround times
+ *
+ * Turnaround Note:
+ *      After a board sends, its RS-485 driver stays on until its ISR turns
+ *      it off. Whoever talks next has to wait the turnaround time first or
+ *      both drivers fight over the wire. It has to cover the slowest
+ *      board's driver release plus its main loop delay. tools/bus_sim.c
+ *      shows what happens when it is too short
+ *
+ *      The reply timeout is how long the master waits before giving up on
+ *      a node that is missing or didn't hear the poll. It has to cover the
+ *      turnaround plus the node's and the master's main loop delays, a
+ *      reply that starts after the master gave up collides with its next poll
+ *
+ * Frame Format:
+ *      [dst][src][type][len][payload 0 to MIL_BUS_MAX_PAYLOAD][crc u32]
+ *
+ *      dst goes out as a 9 bit address byte, so boards it isn't for never
+ *      see the frame at all. A frame ends with silence, so a damaged one
+ *      never swallows the next
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_BUS_H_
+#define MIL_BUS_H_
+
+#define MIL_BUS_MASTER_ADDR 0x00
+
+#ifndef MIL_BUS_MAX_NODES
+#define MIL_BUS_MAX_NODES 16
+#endif
+
+#ifndef MIL_BUS_MAX_PAYLOAD
+#define MIL_BUS_MAX_PAYLOAD 32
+#endif
+
+#define MIL_BUS_HEADER_LEN 4
+#define MIL_BUS_CRC_LEN    4
+#define MIL_BUS_MAX_FRAME  (MIL_BUS_HEADER_LEN + MIL_BUS_MAX_PAYLOAD + MIL_BUS_CRC_LEN)
+
+//silence(byte times) that ends a frame, turnaround is never shorter.
+//the UART RX timeout hands over the last byte of a frame 32 bit times
+//after it lands, so anything under 5 cuts frames short
+#define MIL_BUS_GAP_BYTES 5
+
+//default turnaround and reply timeout in byte times
+#define MIL_BUS_TURNAROUND_BYTES 6
+#define MIL_BUS_TIMEOUT_BYTES    20
+
+#define MIL_BUS_TYPE_POLL  0x01
+#define MIL_BUS_TYPE_REPLY 0x02
+
+/*
+ * Desc: bus counters
+ *
+ *       polls:         polls sent(master) or answered(node)
+ *       replies:       replies received(master)
+ *       timeouts:      polls nobody answered(master)
+ *       bad_frames:    frames thrown away(CRC, length, cut short)
+ *       stray_frames:  good frames that arrived at the wrong time,
+ *                      usually a reply that came after its timeout
+ *       node_timeouts: timeouts per node, in MIL_BUS_MasterStart order
+ */
+typedef struct{
+
+    uint32_t polls;
+    uint32_t replies;
+    uint32_t timeouts;
+    uint32_t bad_frames;
+    uint32_t stray_frames;
+    uint32_t node_timeouts[MIL_BUS_MAX_NODES];
+
+}MIL_BUS_Stats;
+
+/*
+ * Desc: called with one frame to send, pFrame[0] is the address byte
+ */
+typedef void (*MIL_BUS_OutFn)(void *pCtx, const uint8_t *pFrame, uint8_t len);
+
+/*
+ * Desc: called to fill the payload of a poll(master, to is the node) or
+ *       a reply(node, to is the master)
+ *
+ * Returns: payload length, 0 to MIL_BUS_MAX_PAYLOAD
+ */
+typedef uint8_t (*MIL_BUS_FillFn)(void *pCtx, uint8_t to, uint8_t *pPayload);
+
+/*
+ * Desc: called with the payload of each poll or reply received
+ */
+typedef void (*MIL_BUS_DeliverFn)(void *pCtx, uint8_t from, const uint8_t *pData, uint8_t len);
+
+/*
+ * Desc: one board on the bus, all fields are private
+ */
+typedef struct{
+
+    uint8_t address;
+    bool    master;
+
+    //master's poll list
+    uint8_t nodes[MIL_BUS_MAX_NODES];
+    uint8_t num_nodes;
+    uint8_t node_idx;
+
+    uint8_t  state;
+    uint32_t due;           //next poll(master) or reply(node) may go out
+    uint32_t deadline;      //master gives up on the reply
+
+    //timing in ticks
+    uint32_t byte_ticks;
+    uint32_t turnaround;
+    uint32_t timeout;
+
+    //frame being received
+    uint8_t  in_buf[MIL_BUS_MAX_FRAME];
+    uint8_t  in_len;
+    uint32_t last_rx;
+
+    MIL_BUS_OutFn     pOut;
+    MIL_BUS_FillFn    pFill;
+    MIL_BUS_DeliverFn pDeliver;
+    void             *pCtx;
+
+    MIL_BUS_Stats stats;
+
+}MIL_BUS;
+
+/*
+ * Desc: Starts one board on the bus as a node, with the default
+ *       turnaround and timeout
+ *
+ * Parameters:
+ *       pBus: the board
+ *       address: 1 to 255, MIL_BUS_MASTER_ADDR for the master
+ *       byte_ticks: time one byte takes on the wire(10 bits at the baud rate)
+ *       pOut: sends frames
+ *       pFill: supplies outgoing payloads
+ *       pDeliver: receives payloads
+ *       pCtx: passed back to the callbacks
+ */
+void MIL_BUS_Init(MIL_BUS *pBus, uint8_t address, uint32_t byte_ticks,
+                  MIL_BUS_OutFn pOut, MIL_BUS_FillFn pFill, MIL_BUS_DeliverFn pDeliver,
+                  void *pCtx);
+
+/*
+ * Desc: Changes the turnaround time and reply timeout(ticks)
+ *
+ *       turnaround is raised to MIL_BUS_GAP_BYTES + 1 byte times if shorter,
+ *       timeout counts from the end of the poll and is raised to cover
+ *       the turnaround plus the longest reply
+ */
+void MIL_BUS_TimingSet(MIL_BUS *pBus, uint32_t turnaround, uint32_t timeout);
+
+/*
+ * Desc: Makes this board the master and starts polling
+ *
+ * Parameters:
+ *       pNodes: addresses to poll, in order
+ *       num_nodes: 1 to MIL_BUS_MAX_NODES
+ *       now: current tick
+ *
+ * Returns: false if the list is empty or too long
+ */
+bool MIL_BUS_MasterStart(MIL_BUS *pBus, const uint8_t *pNodes, uint8_t num_nodes, uint32_t now);
+
+/*
+ * Desc: Feeds in one received byte and the tick it arrived at
+ */
+void MIL_BUS_Rx(MIL_BUS *pBus, uint8_t byte, uint32_t now);
+
+/*
+ * Desc: Sends the next poll or a reply that is due, handles timeouts.
+ *       Call often(every main loop pass)
+ */
+void MIL_BUS_Poll(MIL_BUS *pBus, uint32_t now);
+
+/*
+ * Desc: copies out the counters
+ */
+void MIL_BUS_StatsGet(const MIL_BUS *pBus, MIL_BUS_Stats *pStats);
+
+#endif /* MIL_BUS_H_ */
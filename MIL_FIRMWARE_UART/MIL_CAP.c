@@ -0,0 +1,185 @@
+/*
+ * Name: MIL_CAP
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Records UART traffic with timestamps and streams it out
+ *
+ * Implementation Notes:
+ *       Bytes come from the main loop and from ISRs at different
+ *       priorities, so MIL_CAP_Record writes the whole record inside a
+ *       MIL_INT critical section before moving head. MIL_CAP_Poll is the
+ *       only reader and only moves tail, so it never sees half a record
+ *
+ *       When the ring is full the record is counted instead of stored.
+ *       The next record that fits goes in behind a MIL_CAP_LOST record
+ *       holding that count, so the gap shows up exactly where it happened
+ *
+ *       head and tail run free and wrap, MIL_CAP_LEN is a power of 2
+ *       so the wrap lands on a whole number of laps
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_SUART.h"
+#include "MIL_CAP.h"
+
+/************************STATE******************************/
+
+typedef struct{
+
+    uint32_t stamp;
+    uint8_t flags;
+    uint8_t data;
+
+}CapRecord;
+
+static CapRecord RING[MIL_CAP_LEN];
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static uint32_t lost_pending;
+
+static uint32_t out_base;
+static volatile bool enabled;
+
+//record being streamed out
+static uint8_t out[MIL_CAP_RECORD_LEN];
+static uint8_t out_pos = MIL_CAP_RECORD_LEN;
+
+static MIL_CAP_Stats stats;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//caller holds the critical section and has checked for room
+static void Put(uint8_t flags, uint8_t data, uint32_t stamp){
+
+    CapRecord *pR = &RING[head & (MIL_CAP_LEN - 1)];
+
+    pR->stamp = stamp;
+    pR->flags = flags;
+    pR->data = data;
+
+    head++;
+
+    uint16_t waiting = (uint16_t)(head - tail);
+    if(waiting > stats.high){ stats.high = waiting; }
+
+}
+
+static uint8_t PortGet(uint32_t base){
+
+    if(MIL_SUART_IS_SOFT(base)){ return (uint8_t)(8 + (base & 0x7)); }
+
+    //UART0 to UART7 are 0x1000 apart
+    return (uint8_t)(((base - UART0_BASE) >> 12) & 0x7);
+
+}
+
+static void Encode(const CapRecord *pR){
+
+    out[0] = MIL_CAP_SYNC;
+    out[1] = pR->flags;
+    out[2] = pR->data;
+    out[3] = (uint8_t)pR->stamp;
+    out[4] = (uint8_t)(pR->stamp >> 8);
+    out[5] = (uint8_t)(pR->stamp >> 16);
+    out[6] = (uint8_t)(pR->stamp >> 24);
+    out[7] = out[1] ^ out[2] ^ out[3] ^ out[4] ^ out[5] ^ out[6];
+
+    out_pos = 0;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_CAP_Init(uint32_t base){
+
+    uint32_t key = MIL_INT_Enter();
+
+    out_base = base;
+    head = 0;
+    tail = 0;
+    lost_pending = 0;
+    out_pos = MIL_CAP_RECORD_LEN;
+    stats = (MIL_CAP_Stats){0};
+
+    //the PC needs the clock to turn stamps into time
+    Put(MIL_CAP_CLOCK, 0, SysCtlClockGet());
+
+    enabled = true;
+
+    MIL_INT_Exit(key);
+
+}
+
+void MIL_CAP_Enable(bool enable){
+
+    enabled = enable;
+
+}
+
+void MIL_CAP_Record(uint32_t base, bool tx, uint8_t data){
+
+    if(!enabled || base == out_base){ return; }
+
+    uint8_t flags = (uint8_t)(PortGet(base) | (tx ? MIL_CAP_TX : 0));
+
+    uint32_t key = MIL_INT_Enter();
+
+    uint32_t stamp = MIL_TIME_NOW();
+    uint16_t room = (uint16_t)(MIL_CAP_LEN - (uint16_t)(head - tail));
+
+    if(room < (lost_pending ? 2 : 1)){
+
+        lost_pending++;
+        stats.lost++;
+
+    }
+    else{
+
+        if(lost_pending){ Put(MIL_CAP_LOST, 0, lost_pending); lost_pending = 0; }
+
+        Put(flags, data, stamp);
+        stats.captured++;
+
+    }
+
+    MIL_INT_Exit(key);
+
+}
+
+void MIL_CAP_Poll(void){
+
+    if(!out_base){ return; }
+
+    while(UARTSpaceAvail(out_base)){
+
+        if(out_pos == MIL_CAP_RECORD_LEN){
+
+            if(tail == head){ return; }
+
+            Encode(&RING[tail & (MIL_CAP_LEN - 1)]);
+            tail++;
+            stats.sent++;
+
+        }
+
+        UARTCharPutNonBlocking(out_base, out[out_pos++]);
+
+    }
+
+}
+
+void MIL_CAP_StatsGet(MIL_CAP_Stats *pStats){
+
+    uint32_t key = MIL_INT_Enter();
+
+    *pStats = stats;
+
+    MIL_INT_Exit(key);
+
+}
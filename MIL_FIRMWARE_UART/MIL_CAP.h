@@ -0,0 +1,133 @@
+/*
+ * Name: MIL_CAP
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Records every byte that goes through MIL_UART with the time
+ *       it happened, and streams the recording out another UART
+ *
+ * What to understand: A field problem with a UART(a dropped byte, a reply
+ *                     that comes too late) usually depends on the exact
+ *                     timing of the traffic, which is hard to make again on
+ *                     a bench. With capture on, MIL_UART_CharPut and
+ *                     MIL_UART_CharGet(NonBlocking) put every byte into a
+ *                     RAM ring with its MIL_TIME stamp, which port and which
+ *                     direction
+ *
+ *                     MIL_CAP_Poll sends the ring out the capture port a few
+ *                     bytes at a time, only as many as fit in its TX FIFO,
+ *                     so it never makes the main loop wait. Save what comes
+ *                     out on the PC to a file with any serial program
+ *
+ *                     tools/uart_replay.c plays a capture file back into a
+ *                     host model of MIL_UART with the same byte timing, so
+ *                     the same traffic can be run against polled or
+ *                     interrupt code, a FIFO or no FIFO, and give the same
+ *                     numbers every time
+ *
+ * Config Note:
+ *      Capture is off unless MIL_UART_CAPTURE_EN is 1 in MIL_CONFIG.h.
+ *      When it's off MIL_UART doesn't call in here at all and this file
+ *      doesn't have to be in the project
+ *
+ * Timing Note:
+ *      A byte is stamped when MIL_UART hands it to the hardware(TX) or
+ *      takes it out(RX), not when it was on the wire. In a polled loop like
+ *      main_polled.c that is within one loop pass of the wire. Bytes read
+ *      straight from driverlib(UARTCharGet) are not captured
+ *
+ *      Nothing is captured on the capture port itself
+ *
+ * Stream Format:
+ *      8 bytes per record: [0xA5][flags][data][stamp u32, LSB first][check]
+ *
+ *      flags: bit 7 set for TX, bits 0-3 the port(0-7 UARTx, 8+ MIL_SUARTx)
+ *             MIL_CAP_CLOCK: stamp is the system clock in Hz, sent first
+ *             MIL_CAP_LOST:  stamp is how many records didn't fit in the
+ *                            ring since the last one of these
+ *      check: XOR of flags, data and the 4 stamp bytes
+ *
+ * Usage:
+ *      MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);   //to the PC
+ *      MIL_CAP_Init(UART0_BASE);
+ *
+ *      while(1){ ...MIL_UART_CharGet/CharPut on other ports...  MIL_CAP_Poll(); }
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_CAP_H_
+#define MIL_CAP_H_
+
+//records in the ring, power of 2, 8 bytes of RAM each
+#ifndef MIL_CAP_LEN
+#define MIL_CAP_LEN 256
+#endif
+
+#define MIL_CAP_SYNC       0xA5
+#define MIL_CAP_RECORD_LEN 8
+
+#define MIL_CAP_TX    0x80
+#define MIL_CAP_PORT  0x0F
+#define MIL_CAP_CLOCK 0xFF
+#define MIL_CAP_LOST  0xFE
+
+/*
+ * Desc: counters for sizing the ring
+ *
+ *       captured: records put in the ring
+ *       lost:     records that didn't fit(the PC side is too slow,
+ *                 raise the capture port's baud or MIL_CAP_LEN)
+ *       sent:     records streamed out
+ *       high:     most records ever waiting in the ring
+ */
+typedef struct{
+
+    uint32_t captured;
+    uint32_t lost;
+    uint32_t sent;
+    uint16_t high;
+
+}MIL_CAP_Stats;
+
+/*
+ * Desc: Starts capturing, call after the capture port is set up
+ *       with MIL_InitUART
+ *
+ * Parameters:
+ *       out_base: hardware UARTx_BASE the recording streams out of
+ */
+void MIL_CAP_Init(uint32_t out_base);
+
+/*
+ * Desc: Pauses or resumes capturing, bytes already in the ring
+ *       still stream out. Pause it from the code that spots a problem
+ *       to keep the traffic that led up to it
+ */
+void MIL_CAP_Enable(bool enable);
+
+/*
+ * Desc: Records one byte, MIL_UART calls this
+ *
+ * Parameters:
+ *       base: UARTx_BASE or MIL_SUARTx_BASE the byte went through
+ *       tx: true for a byte sent, false for a byte received
+ *       data: the byte
+ */
+void MIL_CAP_Record(uint32_t base, bool tx, uint8_t data);
+
+/*
+ * Desc: Streams waiting records out the capture port, as many bytes
+ *       as its FIFO takes without waiting. Call every main loop pass,
+ *       not from an ISR
+ */
+void MIL_CAP_Poll(void);
+
+/*
+ * Desc: copies out the counters
+ */
+void MIL_CAP_StatsGet(MIL_CAP_Stats *pStats);
+
+#endif /* MIL_CAP_H_ */
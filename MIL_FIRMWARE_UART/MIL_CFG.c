@@ -0,0 +1,331 @@
+/*
+ * Name: MIL_CFG
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Configuration store kept in the TIVA's EEPROM
+ *
+ * Implementation Notes:
+ *       The EEPROM is treated as a ring of fixed size records:
+ *
+ *          word 0: 0x5A | key | sequence number(16 bits)
+ *          word 1: value
+ *          word 2: CRC-32 of words 0 and 1
+ *
+ *       A record only counts if its CRC checks out, so a record torn
+ *       by a reset is simply ignored. When two records share a key the
+ *       higher sequence number wins
+ *
+ *       New records go at head. The free space is everything from head
+ *       up to tail(the oldest record that is still the newest for its key).
+ *       When free space runs low the record at tail is copied to head,
+ *       which makes the old copy stale and frees it. The copy is written
+ *       before anything is given up, so a reset during the copy loses nothing
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/eeprom.h"
+#include "driverlib/sysctl.h"
+
+#include "MIL_CRC.h"
+#include "MIL_UART.h"
+#include "MIL_CFG.h"
+
+//EEPROM area used by the store, in bytes
+#define CFG_EEPROM_START 0
+#define CFG_EEPROM_SIZE  2048
+
+#define RECORD_WORDS 3
+#define RECORD_BYTES (RECORD_WORDS * 4)
+#define NUM_SLOTS    (CFG_EEPROM_SIZE / RECORD_BYTES)
+
+//slots that must stay free after every write, lets the compaction always make progress
+#define RESERVE_SLOTS 2
+
+#define RECORD_MAGIC 0x5A
+#define NO_SLOT      0xFF
+#define NO_KEY       0xFF
+
+#if NUM_SLOTS < (MIL_CFG_MAX_KEYS + RESERVE_SLOTS + 1)
+#error "MIL_CFG: EEPROM area too small for MIL_CFG_MAX_KEYS"
+#endif
+
+#if NUM_SLOTS >= NO_SLOT
+#error "MIL_CFG: slot indices no longer fit in a byte"
+#endif
+
+/************************STATE******************************/
+
+static bool cfg_ready = false;
+
+//RAM index, newest value of every key
+static uint32_t KEY_VALUE[MIL_CFG_MAX_KEYS];
+static uint8_t  KEY_SLOT[MIL_CFG_MAX_KEYS];
+
+//which key each slot is the newest record for(NO_KEY if stale or blank)
+static uint8_t  SLOT_KEY[NUM_SLOTS];
+
+static uint8_t  head;       //next slot to write
+static uint8_t  tail;       //oldest live slot
+static uint16_t next_seq;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static uint32_t SlotAddr(uint8_t slot){
+
+    return CFG_EEPROM_START + slot * RECORD_BYTES;
+
+}
+
+static uint8_t NextSlot(uint8_t slot){
+
+    return (slot + 1 == NUM_SLOTS) ? 0 : slot + 1;
+
+}
+
+static uint8_t FreeSlots(void){
+
+    //head == tail only happens with nothing live, then everything is free
+    if(head == tail && SLOT_KEY[tail] == NO_KEY){ return NUM_SLOTS; }
+
+    return (tail + NUM_SLOTS - head) % NUM_SLOTS;
+
+}
+
+//true if sequence number a was written after b, works across wrap around
+static bool SeqNewer(uint16_t a, uint16_t b){
+
+    return (int16_t)(a - b) > 0;
+
+}
+
+static bool ReadRecord(uint8_t slot, uint8_t *pKey, uint16_t *pSeq, uint32_t *pValue){
+
+    uint32_t rec[RECORD_WORDS];
+
+    EEPROMRead(rec, SlotAddr(slot), RECORD_BYTES);
+
+    if((rec[0] >> 24) != RECORD_MAGIC){ return false; }
+    if(MIL_CRC32(MIL_CRC32_INIT, (const uint8_t *)rec, 8) != rec[2]){ return false; }
+
+    *pKey = (rec[0] >> 16) & 0xFF;
+    *pSeq = rec[0] & 0xFFFF;
+    *pValue = rec[1];
+
+    return *pKey < MIL_CFG_MAX_KEYS;
+
+}
+
+/*
+ * Desc: writes one record at head and makes it the newest for its key
+ */
+static bool Append(uint8_t key, uint32_t value){
+
+    uint32_t rec[RECORD_WORDS];
+
+    rec[0] = ((uint32_t)RECORD_MAGIC << 24) | ((uint32_t)key << 16) | next_seq;
+    rec[1] = value;
+    rec[2] = MIL_CRC32(MIL_CRC32_INIT, (const uint8_t *)rec, 8);
+
+    if(EEPROMProgram(rec, SlotAddr(head), RECORD_BYTES) != 0){ return false; }
+
+    next_seq++;
+
+    //the previous record for this key is now stale
+    if(KEY_SLOT[key] != NO_SLOT){ SLOT_KEY[KEY_SLOT[key]] = NO_KEY; }
+
+    KEY_SLOT[key] = head;
+    KEY_VALUE[key] = value;
+    SLOT_KEY[head] = key;
+
+    head = NextSlot(head);
+
+    return true;
+
+}
+
+/*
+ * Desc: moves tail forward until there is enough free space,
+ *       copying live records to head as it goes
+ */
+static bool Compact(void){
+
+    while(FreeSlots() < RESERVE_SLOTS){
+
+        uint8_t key = SLOT_KEY[tail];
+
+        if(key != NO_KEY){
+
+            //copy first, the old one is only given up once the copy is safe
+            if(!Append(key, KEY_VALUE[key])){ return false; }
+
+        }
+
+        tail = NextSlot(tail);
+
+        //skip over anything stale
+        while(SLOT_KEY[tail] == NO_KEY && tail != head){ tail = NextSlot(tail); }
+
+    }
+
+    return true;
+
+}
+
+//UART number(0 to 7) of a UART base, 8 for an invalid base
+static uint8_t UartNumber(uint32_t base){
+
+    switch(base){
+
+        case UART0_BASE: return 0;
+        case UART1_BASE: return 1;
+        case UART2_BASE: return 2;
+        case UART3_BASE: return 3;
+        case UART4_BASE: return 4;
+        case UART5_BASE: return 5;
+        case UART6_BASE: return 6;
+        case UART7_BASE: return 7;
+        default: return 8;
+
+    };
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts the EEPROM and reads the log into RAM
+ *
+ * Returns: false if the EEPROM could not be started
+ */
+bool MIL_CFG_Init(void){
+
+    uint16_t key_seq[MIL_CFG_MAX_KEYS];
+    uint16_t newest_seq = 0;
+    bool     any = false;
+
+    cfg_ready = false;
+
+    for(uint8_t k = 0; k < MIL_CFG_MAX_KEYS; k++){ KEY_SLOT[k] = NO_SLOT; }
+    for(uint8_t s = 0; s < NUM_SLOTS; s++){ SLOT_KEY[s] = NO_KEY; }
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EEPROM0);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_EEPROM0));
+
+    if(EEPROMInit() != EEPROM_INIT_OK){ return false; }
+
+    head = 0;
+
+    //one pass over the log, keep the newest record of every key
+    for(uint8_t s = 0; s < NUM_SLOTS; s++){
+
+        uint8_t key;
+        uint16_t seq;
+        uint32_t value;
+
+        if(!ReadRecord(s, &key, &seq, &value)){ continue; }
+
+        if(KEY_SLOT[key] == NO_SLOT || SeqNewer(seq, key_seq[key])){
+
+            if(KEY_SLOT[key] != NO_SLOT){ SLOT_KEY[KEY_SLOT[key]] = NO_KEY; }
+
+            KEY_SLOT[key] = s;
+            KEY_VALUE[key] = value;
+            key_seq[key] = seq;
+            SLOT_KEY[s] = key;
+
+        }
+
+        //head goes right after the newest record overall
+        if(!any || SeqNewer(seq, newest_seq)){
+
+            newest_seq = seq;
+            head = NextSlot(s);
+            any = true;
+
+        }
+
+    }
+
+    next_seq = any ? newest_seq + 1 : 0;
+
+    //oldest live record is the first one found after head
+    tail = head;
+    for(uint8_t i = 0; i < NUM_SLOTS && SLOT_KEY[tail] == NO_KEY; i++){ tail = NextSlot(tail); }
+
+    cfg_ready = true;
+
+    //a reset during compaction can leave the reserve short
+    return Compact();
+
+}
+
+/*
+ * Desc: Reads a setting from RAM
+ *
+ * Returns: false if the key has never been set
+ */
+bool MIL_CFG_Get(uint8_t key, uint32_t *pValue){
+
+    if(!cfg_ready || key >= MIL_CFG_MAX_KEYS || KEY_SLOT[key] == NO_SLOT){ return false; }
+
+    *pValue = KEY_VALUE[key];
+
+    return true;
+
+}
+
+/*
+ * Desc: Reads a setting from RAM, or returns def if it has never been set
+ */
+uint32_t MIL_CFG_GetDefault(uint8_t key, uint32_t def){
+
+    uint32_t value;
+
+    return MIL_CFG_Get(key, &value) ? value : def;
+
+}
+
+/*
+ * Desc: Saves a setting, nothing is written if the value is unchanged
+ *
+ * Returns: false if the key is out of range or the write failed
+ */
+bool MIL_CFG_Set(uint8_t key, uint32_t value){
+
+    if(!cfg_ready || key >= MIL_CFG_MAX_KEYS){ return false; }
+
+    if(KEY_SLOT[key] != NO_SLOT && KEY_VALUE[key] == value){ return true; }
+
+    if(!Append(key, value)){ return false; }
+
+    return Compact();
+
+}
+
+/*
+ * Desc: Erases every setting(factory reset)
+ */
+void MIL_CFG_EraseAll(void){
+
+    EEPROMMassErase();
+
+    MIL_CFG_Init();
+
+}
+
+/*
+ * Desc: MIL_InitUART using the stored baud rate and FIFO depth
+ *       for this UART
+ */
+void MIL_CFG_InitUART(uint32_t base, uint32_t default_baud){
+
+    uint8_t uart = UartNumber(base);
+    if(uart >= 8){ return; }
+
+    MIL_InitUART(base, MIL_CFG_GetDefault(MIL_CFG_KEY_UART_BAUD(uart), default_baud));
+
+    uint32_t depth = MIL_CFG_GetDefault(MIL_CFG_KEY_UART_FIFO(uart), 0);
+    if(depth){ MIL_UART_FIFOEn(base, depth); }
+
+}
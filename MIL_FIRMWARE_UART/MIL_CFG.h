@@ -0,0 +1,105 @@
+/*
+ * Name: MIL_CFG
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Configuration store kept in the TIVA's EEPROM so settings
+ *       like baud rates survive a reset without recompiling
+ *
+ * What to understand: Every setting has a key(a small number) and a 32 bit
+ *                     value. Changing a setting never overwrites the old
+ *                     record, a new record is written after the newest one
+ *                     like lines in a log book. This spreads writes over the
+ *                     whole EEPROM(wear leveling) and means a reset in the
+ *                     middle of a write can only lose the NEW value, never
+ *                     the old one
+ *
+ *                     At startup MIL_CFG_Init reads the whole log once and
+ *                     keeps the newest value of every key in RAM, so
+ *                     MIL_CFG_Get never touches the EEPROM
+ *
+ * Wear Note:
+ *      The EEPROM is rated for ~500k writes per word. With the log spread
+ *      over all 2KB that is roughly 170x more setting changes than
+ *      writing the same location every time
+ *
+ * Usage:
+ *      MIL_CFG_Init();
+ *      MIL_CFG_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+ *
+ *      //from a shell command or wherever, takes effect next reset
+ *      MIL_CFG_Set(MIL_CFG_KEY_UART_BAUD(1), MIL_BAUD_57600);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_CFG_H_
+#define MIL_CFG_H_
+
+//keys are 0 to MIL_CFG_MAX_KEYS - 1
+#define MIL_CFG_MAX_KEYS 64
+
+/*
+ * MIL driver keys, x is the UART number 0 to 7
+ *
+ *      BAUD: baud rate passed to MIL_InitUART
+ *      FIFO: FIFO trigger depth passed to MIL_UART_FIFOEn, 0 leaves the FIFO off
+ */
+#define MIL_CFG_KEY_UART_BAUD(x) (0 + (x))
+#define MIL_CFG_KEY_UART_FIFO(x) (8 + (x))
+
+//keys from here up are free for applications
+#define MIL_CFG_KEY_USER 32
+
+/*
+ * Desc: Starts the EEPROM and reads the log into RAM
+ *       call once at startup before any other MIL_CFG function
+ *
+ * Returns: false if the EEPROM could not be started
+ *          (every Get will then return its default)
+ */
+bool MIL_CFG_Init(void);
+
+/*
+ * Desc: Reads a setting from RAM
+ *
+ * Parameters:
+ *       key: which setting
+ *       pValue: where to store the value
+ *
+ * Returns: false if the key has never been set
+ */
+bool MIL_CFG_Get(uint8_t key, uint32_t *pValue);
+
+/*
+ * Desc: Reads a setting from RAM, or returns def if it has never been set
+ */
+uint32_t MIL_CFG_GetDefault(uint8_t key, uint32_t def);
+
+/*
+ * Desc: Saves a setting, nothing is written if the value is unchanged
+ *
+ *       Takes a few hundred microseconds per record while the EEPROM
+ *       programs, so don't call it from an ISR or a tight control loop
+ *
+ * Returns: false if the key is out of range or the write failed
+ */
+bool MIL_CFG_Set(uint8_t key, uint32_t value);
+
+/*
+ * Desc: Erases every setting(factory reset)
+ */
+void MIL_CFG_EraseAll(void);
+
+/*
+ * Desc: MIL_InitUART using the stored baud rate and FIFO depth
+ *       for this UART, falling back to default_baud with the FIFO
+ *       off if nothing has been stored
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       default_baud: baud rate to use if none is stored
+ */
+void MIL_CFG_InitUART(uint32_t base, uint32_t default_baud);
+
+#endif /* MIL_CFG_H_ */
@@ -0,0 +1,130 @@
+/*
+ * Name: MIL_CONFIG
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: One place to pick which parts of the MIL libraries get
+ *       compiled into a project, and how big their buffers are
+ *
+ * What to understand: Everything is on by default, so a project that never
+ *                     touches this file builds exactly like before. On a
+ *                     board short on flash or RAM, turn off what you don't
+ *                     use here and the code for it is removed with #if, not
+ *                     just left uncalled
+ *
+ *                     Every setting is inside #ifndef, so it can also be set
+ *                     from the compiler command line(-DMIL_UART3_EN=0, or in
+ *                     CCS: Build > ARM Compiler > Predefined Symbols) without
+ *                     editing this file
+ *
+ *                     The buffer sizes at the bottom are set in each module's
+ *                     own header, uncomment one here to change it for the
+ *                     whole project
+ *
+ * Size Note:
+ *      tools/mil_size.py reports flash and RAM per module from the linker
+ *      map and fails when a module grows past a saved baseline, see the
+ *      top of that file for adding it as a CCS post build step
+ *
+ *      Turning a feature off makes calls to it fail to link, which is the
+ *      point: nothing can use it by accident
+ */
+
+#ifndef MIL_CONFIG_H_
+#define MIL_CONFIG_H_
+
+/************************UART INSTANCES******************************/
+
+//hardware UARTs MIL_UART can set up, 0 drops that UART's pins,
+//clocks and interrupt from every MIL_UART switch
+#ifndef MIL_UART0_EN
+#define MIL_UART0_EN 1
+#endif
+#ifndef MIL_UART1_EN
+#define MIL_UART1_EN 1
+#endif
+#ifndef MIL_UART2_EN
+#define MIL_UART2_EN 1
+#endif
+#ifndef MIL_UART3_EN
+#define MIL_UART3_EN 1
+#endif
+#ifndef MIL_UART4_EN
+#define MIL_UART4_EN 1
+#endif
+#ifndef MIL_UART5_EN
+#define MIL_UART5_EN 1
+#endif
+#ifndef MIL_UART6_EN
+#define MIL_UART6_EN 1
+#endif
+#ifndef MIL_UART7_EN
+#define MIL_UART7_EN 1
+#endif
+
+/************************UART FEATURES******************************/
+
+//MIL_UART_FIFOEn
+#ifndef MIL_UART_FIFO_EN
+#define MIL_UART_FIFO_EN 1
+#endif
+
+//MIL_UART_InitISR and MIL_UART_ISRPrioritySet
+#ifndef MIL_UART_ISR_EN
+#define MIL_UART_ISR_EN 1
+#endif
+
+//MIL_UART_OutArray and MIL_UART_OutCString(text and log output)
+#ifndef MIL_UART_LOG_EN
+#define MIL_UART_LOG_EN 1
+#endif
+
+//MIL_SUART ports through the MIL_UART functions once MIL_SUART_Init
+//has run. MIL_UART doesn't link against MIL_SUART either way, 0 only
+//drops the few checks for a software base
+#ifndef MIL_UART_SOFT_EN
+#define MIL_UART_SOFT_EN 1
+#endif
+
+//MIL_CAP records every byte through MIL_UART_CharPut and
+//MIL_UART_CharGet(NonBlocking) with a timestamp, off by default since
+//it costs a critical section per byte and MIL_CAP_LEN records of RAM
+#ifndef MIL_UART_CAPTURE_EN
+#define MIL_UART_CAPTURE_EN 0
+#endif
+
+/************************DMA******************************/
+
+//the alternate half of the DMA control table, only ping-pong and
+//scatter-gather transfers use it(MIL_PATTERN). 0 saves 512 bytes of RAM
+#ifndef MIL_DMA_ALT_EN
+#define MIL_DMA_ALT_EN 1
+#endif
+
+/************************STATS******************************/
+
+//drivers register their counters with MIL_STAT at Init so they can be
+//read over a UART. 0 leaves MIL_STAT.c out, the counters themselves stay
+#ifndef MIL_STAT_EN
+#define MIL_STAT_EN 1
+#endif
+
+/************************BUFFER SIZES******************************/
+
+//defaults are in each module's header
+//#define MIL_SUART_BUF_LEN 64
+//#define MIL_TXQ_BUF_LEN 512
+//#define MIL_RS485_TX_BUF_LEN 64
+//#define MIL_RS485_RX_BUF_LEN 128
+//#define MIL_LINK_TX_BUF_LEN 1024
+//#define MIL_LINK_RX_BUF_LEN 256
+//#define MIL_SHELL_LINE_LEN 64
+//#define MIL_SHELL_TX_BUF_LEN 256
+//#define MIL_ARQ_WINDOW 8
+//#define MIL_ARQ_MAX_PAYLOAD 64
+//#define MIL_BUS_MAX_NODES 16
+//#define MIL_BUS_MAX_PAYLOAD 32
+//#define MIL_POOL_SMALL_COUNT 32
+//#define MIL_CAP_LEN 256
+//#define MIL_STAT_MAX 16
+
+#endif /* MIL_CONFIG_H_ */
@@ -0,0 +1,42 @@
+/*
+ * Name: MIL_CRC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Checksums for verifying data sent over a link
+ *       or stored in flash
+ *
+ * What to understand: A CRC is a number computed from a block of data.
+ *                     The sender computes it and sends it along, the
+ *                     receiver computes it again and if the two don't
+ *                     match the data was corrupted on the way
+ *
+ *                     MIL_CRC32 is the same CRC-32 used by zip, ethernet
+ *                     and python's zlib.crc32 so host tools can check
+ *                     our data without writing their own CRC
+ *
+ * Chaining Note:
+ *      To CRC data that is split across several buffers, pass the
+ *      result of the previous call as crc. Start with MIL_CRC32_INIT
+ */
+
+#include <stdint.h>
+
+#ifndef MIL_CRC_H_
+#define MIL_CRC_H_
+
+//starting value for a new CRC
+#define MIL_CRC32_INIT 0x00000000
+
+/*
+ * Desc: computes(or continues) a CRC-32 over a buffer
+ *
+ * Parameters:
+ *       crc: MIL_CRC32_INIT for new data, or the previous result to continue
+ *       pData: the data
+ *       len: how many bytes
+ *
+ * Returns: the CRC
+ */
+uint32_t MIL_CRC32(uint32_t crc, const uint8_t *pData, uint32_t len);
+
+#endif /* MIL_CRC_H_ */
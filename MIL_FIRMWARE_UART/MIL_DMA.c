@@ -0,0 +1,55 @@
+/*
+ * Name: MIL_DMA
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Shared setup for the micro DMA(uDMA) controller
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+#include "MIL_DMA.h"
+
+/*
+ * The control table holds a primary and alternate entry for all 32
+ * channels(16 bytes each) and must sit on a 1024 byte boundary.
+ * The alternate entries are the second half, without them the
+ * linker can put other data in that 512 bytes.
+ * Each compiler spells alignment differently
+ */
+#if MIL_DMA_ALT_EN
+#define DMA_TABLE_LEN 64
+#else
+#define DMA_TABLE_LEN 32
+#endif
+
+#if defined(ewarm)
+#pragma data_alignment=1024
+static tDMAControlTable DMA_CONTROL_TABLE[DMA_TABLE_LEN];
+#elif defined(ccs)
+#pragma DATA_ALIGN(DMA_CONTROL_TABLE, 1024)
+static tDMAControlTable DMA_CONTROL_TABLE[DMA_TABLE_LEN];
+#else
+static tDMAControlTable DMA_CONTROL_TABLE[DMA_TABLE_LEN] __attribute__ ((aligned(1024)));
+#endif
+
+static bool dma_ready = false;
+
+/*
+ * Desc: Enables the uDMA controller and points it at the
+ *       control table. Safe to call more than once
+ */
+void MIL_DMA_Init(void){
+
+    if(dma_ready){ return; }
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+
+    uDMAEnable();
+    uDMAControlBaseSet(DMA_CONTROL_TABLE);
+
+    dma_ready = true;
+
+}
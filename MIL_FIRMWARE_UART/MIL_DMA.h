@@ -0,0 +1,41 @@
+/*
+ * Name: MIL_DMA
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Shared setup for the micro DMA(uDMA) controller
+ *
+ * What to understand: DMA moves data between peripherals and memory
+ *                     without the CPU. There is only one uDMA controller
+ *                     and one control table for the whole chip, so every
+ *                     MIL module that uses DMA calls MIL_DMA_Init instead
+ *                     of declaring its own table
+ *
+ *                     The control table has to be 1024 byte aligned
+ *                     in SRAM, that is handled in MIL_DMA.c
+ *
+ * Channel Note:
+ *      Each of the 32 channels can be assigned to one of a few
+ *      peripherals(see table 9-1 of the TM4C123 datasheet). Modules
+ *      assign their own channels with uDMAChannelAssign, just make sure
+ *      two modules in the same project are not fighting over one
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_DMA_H_
+#define MIL_DMA_H_
+
+//most bytes in one basic mode transfer
+#define MIL_DMA_MAX_XFER 1024
+
+/*
+ * Desc: Enables the uDMA controller and points it at the
+ *       control table. Safe to call more than once, only the
+ *       first call does anything
+ */
+void MIL_DMA_Init(void);
+
+#endif /* MIL_DMA_H_ */
@@ -0,0 +1,343 @@
+/*
+ * Name: MIL_FMT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Number to text without printf
+ *
+ * Implementation Notes:
+ *       Decimal numbers are written back to front. The digit count is
+ *       worked out first with compares, so the digits go straight into
+ *       place with no reversing or temporary buffer
+ *
+ *       Fixed point splits into the integer part(a shift) and the fraction
+ *       (multiply by 10^decimals, shift back down with rounding). A fraction
+ *       that rounds up to 1 carries into the integer part
+ *
+ *       Floats are split the same way, (uint32_t) gives the integer part and
+ *       subtracting it back off is exact, so only the fraction is rounded
+ *
+ *       Builder pieces that could be long go to a temporary first when the
+ *       buffer is nearly full, so a number is never split across a flush
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "MIL_FMT.h"
+
+/************************TABLES******************************/
+
+static const char DIGITS2[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char HEX[16] = "0123456789ABCDEF";
+
+static const uint32_t POW10[10] = {
+
+    1, 10, 100, 1000, 10000, 100000, 1000000,
+    10000000, 100000000, 1000000000
+
+};
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static uint8_t DigitCount(uint32_t value){
+
+    uint8_t n = 1;
+
+    while(n < 10 && value >= POW10[n]){ n++; }
+
+    return n;
+
+}
+
+//writes value as exactly n digits, zero padded, back to front
+static void DigitsPut(uint8_t *pOut, uint32_t value, uint8_t n){
+
+    while(n >= 2){
+
+        uint32_t pair = (value % 100) * 2;
+        value /= 100;
+
+        pOut[--n] = (uint8_t)DIGITS2[pair + 1];
+        pOut[--n] = (uint8_t)DIGITS2[pair];
+
+    }
+
+    if(n){ pOut[0] = (uint8_t)('0' + value % 10); }
+
+}
+
+//[-]whole[.frac], frac already scaled to decimals digits
+static uint8_t PartsPut(uint8_t *pOut, bool neg, uint32_t whole, uint32_t frac, uint8_t decimals){
+
+    uint8_t n = 0;
+
+    if(neg){ pOut[n++] = '-'; }
+
+    n += MIL_FMT_U32(&pOut[n], whole);
+
+    if(decimals){
+
+        pOut[n++] = '.';
+        DigitsPut(&pOut[n], frac, decimals);
+        n += decimals;
+
+    }
+
+    return n;
+
+}
+
+//float 0 <= value < 2^32 split into whole and rounded fraction
+static void FloatSplit(float value, uint8_t decimals, uint32_t *pWhole, uint32_t *pFrac){
+
+    uint32_t whole = (uint32_t)value;
+    float rest = value - (float)whole;
+    uint32_t frac = (uint32_t)(rest * (float)POW10[decimals] + 0.5f);
+
+    if(frac >= POW10[decimals]){ frac -= POW10[decimals]; whole++; }
+
+    *pWhole = whole;
+    *pFrac = frac;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+uint8_t MIL_FMT_U32(uint8_t *pOut, uint32_t value){
+
+    uint8_t n = DigitCount(value);
+
+    DigitsPut(pOut, value, n);
+
+    return n;
+
+}
+
+uint8_t MIL_FMT_I32(uint8_t *pOut, int32_t value){
+
+    if(value >= 0){ return MIL_FMT_U32(pOut, (uint32_t)value); }
+
+    pOut[0] = '-';
+
+    //-(uint32_t) so INT32_MIN doesn't overflow
+    return 1 + MIL_FMT_U32(&pOut[1], -(uint32_t)value);
+
+}
+
+uint8_t MIL_FMT_Hex(uint8_t *pOut, uint32_t value, uint8_t digits){
+
+    uint8_t n = 1;
+
+    while(n < 8 && (value >> (4 * n))){ n++; }
+
+    if(digits > 8){ digits = 8; }
+    if(n < digits){ n = digits; }
+
+    for(uint8_t i = n; i > 0; i--){
+
+        pOut[i - 1] = (uint8_t)HEX[value & 0xF];
+        value >>= 4;
+
+    }
+
+    return n;
+
+}
+
+uint8_t MIL_FMT_Fixed(uint8_t *pOut, int32_t value, uint8_t frac_bits, uint8_t decimals){
+
+    if(frac_bits > 31){ frac_bits = 31; }
+    if(decimals > MIL_FMT_MAX_DECIMALS){ decimals = MIL_FMT_MAX_DECIMALS; }
+
+    bool neg = value < 0;
+    uint32_t mag = neg ? -(uint32_t)value : (uint32_t)value;
+
+    uint32_t whole = mag >> frac_bits;
+    uint32_t frac = 0;
+
+    if(frac_bits){
+
+        uint64_t part = mag & ((1u << frac_bits) - 1);
+
+        frac = (uint32_t)((part * POW10[decimals] + (1ull << (frac_bits - 1))) >> frac_bits);
+
+        if(frac >= POW10[decimals]){ frac -= POW10[decimals]; whole++; }
+
+    }
+
+    return PartsPut(pOut, neg, whole, frac, decimals);
+
+}
+
+uint8_t MIL_FMT_Float(uint8_t *pOut, float value, uint8_t decimals){
+
+    if(decimals > MIL_FMT_MAX_DECIMALS){ decimals = MIL_FMT_MAX_DECIMALS; }
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    bool neg = (bits >> 31) != 0;
+    uint8_t n = 0;
+
+    if(neg){ pOut[n++] = '-'; value = -value; }
+
+    if(value != value){ memcpy(pOut, "nan", 3); return 3; }
+
+    if(value > 3.4028235e38f){ memcpy(&pOut[n], "inf", 3); return n + 3; }
+
+    uint32_t whole;
+    uint32_t frac;
+
+    if(value < 4294967296.0f){
+
+        FloatSplit(value, decimals, &whole, &frac);
+        return n + PartsPut(&pOut[n], false, whole, frac, decimals);
+
+    }
+
+    //too big for the integer part, 1.2345e+12 form
+    uint8_t exp = 0;
+
+    while(value >= 10.0f){ value /= 10.0f; exp++; }
+
+    FloatSplit(value, decimals, &whole, &frac);
+
+    if(whole >= 10){ whole = 1; frac = 0; exp++; }
+
+    n += PartsPut(&pOut[n], false, whole, frac, decimals);
+
+    pOut[n++] = 'e';
+    pOut[n++] = '+';
+    DigitsPut(&pOut[n], exp, 2);
+
+    return n + 2;
+
+}
+
+void MIL_FMT_BufInit(MIL_FMT_Buf *pB, uint8_t *pBuf, uint16_t cap, MIL_FMT_FlushFn pFlush, void *pCtx){
+
+    pB->pBuf = pBuf;
+    pB->cap = cap;
+    pB->len = 0;
+    pB->overflow = false;
+    pB->pFlush = pFlush;
+    pB->pCtx = pCtx;
+
+}
+
+void MIL_FMT_Flush(MIL_FMT_Buf *pB){
+
+    if(pB->pFlush && pB->len){ pB->pFlush(pB->pCtx, pB->pBuf, pB->len); }
+
+    if(pB->pFlush){ pB->len = 0; }
+
+}
+
+//adds len bytes, flushing as often as it takes or leaving them all out
+static void Append(MIL_FMT_Buf *pB, const uint8_t *pData, uint16_t len){
+
+    if(len > pB->cap - pB->len){
+
+        if(!pB->pFlush){ pB->overflow = true; return; }
+
+        MIL_FMT_Flush(pB);
+
+    }
+
+    while(len){
+
+        uint16_t chunk = pB->cap - pB->len;
+        if(chunk > len){ chunk = len; }
+
+        memcpy(&pB->pBuf[pB->len], pData, chunk);
+        pB->len += chunk;
+        pData += chunk;
+        len -= chunk;
+
+        if(len){ MIL_FMT_Flush(pB); }
+
+    }
+
+}
+
+//where a number can be written in place, or 0 if it has to go through Append
+static uint8_t *Direct(MIL_FMT_Buf *pB){
+
+    return (pB->cap - pB->len >= MIL_FMT_MAX_LEN) ? &pB->pBuf[pB->len] : 0;
+
+}
+
+void MIL_FMT_AddChar(MIL_FMT_Buf *pB, char c){
+
+    uint8_t data = (uint8_t)c;
+
+    Append(pB, &data, 1);
+
+}
+
+void MIL_FMT_AddStr(MIL_FMT_Buf *pB, const char *pStr){
+
+    Append(pB, (const uint8_t *)pStr, (uint16_t)strlen(pStr));
+
+}
+
+void MIL_FMT_AddU32(MIL_FMT_Buf *pB, uint32_t value){
+
+    uint8_t tmp[MIL_FMT_MAX_LEN];
+    uint8_t *pOut = Direct(pB);
+
+    if(pOut){ pB->len += MIL_FMT_U32(pOut, value); }
+    else{ Append(pB, tmp, MIL_FMT_U32(tmp, value)); }
+
+}
+
+void MIL_FMT_AddI32(MIL_FMT_Buf *pB, int32_t value){
+
+    uint8_t tmp[MIL_FMT_MAX_LEN];
+    uint8_t *pOut = Direct(pB);
+
+    if(pOut){ pB->len += MIL_FMT_I32(pOut, value); }
+    else{ Append(pB, tmp, MIL_FMT_I32(tmp, value)); }
+
+}
+
+void MIL_FMT_AddHex(MIL_FMT_Buf *pB, uint32_t value, uint8_t digits){
+
+    uint8_t tmp[MIL_FMT_MAX_LEN];
+    uint8_t *pOut = Direct(pB);
+
+    if(pOut){ pB->len += MIL_FMT_Hex(pOut, value, digits); }
+    else{ Append(pB, tmp, MIL_FMT_Hex(tmp, value, digits)); }
+
+}
+
+void MIL_FMT_AddFixed(MIL_FMT_Buf *pB, int32_t value, uint8_t frac_bits, uint8_t decimals){
+
+    uint8_t tmp[MIL_FMT_MAX_LEN];
+    uint8_t *pOut = Direct(pB);
+
+    if(pOut){ pB->len += MIL_FMT_Fixed(pOut, value, frac_bits, decimals); }
+    else{ Append(pB, tmp, MIL_FMT_Fixed(tmp, value, frac_bits, decimals)); }
+
+}
+
+void MIL_FMT_AddFloat(MIL_FMT_Buf *pB, float value, uint8_t decimals){
+
+    uint8_t tmp[MIL_FMT_MAX_LEN];
+    uint8_t *pOut = Direct(pB);
+
+    if(pOut){ pB->len += MIL_FMT_Float(pOut, value, decimals); }
+    else{ Append(pB, tmp, MIL_FMT_Float(tmp, value, decimals)); }
+
+}
@@ -0,0 +1,148 @@
+/*
+ * Name: MIL_FMT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Number to text without printf, for ASCII telemetry
+ *
+ * What to understand: UARTprintf and snprintf read the format string one
+ *                     character at a time at run time, divide by 10 once per
+ *                     digit and need a lot of stack. When the format is
+ *                     always "a number goes here" that work is wasted
+ *
+ *                     MIL_FMT has one function per kind of number. Decimal
+ *                     digits come out two at a time from a 200 byte table
+ *                     ("00" to "99"), so a 32 bit number takes at most 5
+ *                     divides instead of 10. Hex is one table lookup per digit
+ *
+ *                     Nothing is allocated and nothing is 0 terminated, each
+ *                     function writes the characters and returns how many
+ *
+ *                     tools/fmt_bench.c formats millions of numbers with this
+ *                     and with snprintf, integers and hex have to match exactly,
+ *                     fixed point and floats to within one in the last digit
+ *
+ * Builder Note:
+ *      MIL_FMT_Buf puts a line together piece by piece in your buffer.
+ *      Give it a flush function and it hands the buffer on whenever the
+ *      next piece won't fit(and on MIL_FMT_Flush), so a small buffer can
+ *      build any length of line straight into MIL_UART_OutArray or
+ *      MIL_UARTQ_Send with no extra copy. Without a flush function a piece
+ *      that won't fit is left out whole and overflow is set
+ *
+ * Float Note:
+ *      MIL_FMT_Float uses float math only(no double, no libc), the last
+ *      digit can differ from printf by one on values that sit exactly
+ *      between two roundings. Values of 2^32 and up come out as 1.2345e+12
+ *
+ * Usage:
+ *      uint8_t line[64];
+ *      MIL_FMT_Buf b;
+ *
+ *      MIL_FMT_BufInit(&b, line, sizeof(line), 0, 0);
+ *      MIL_FMT_AddStr(&b, "temp ");
+ *      MIL_FMT_AddFixed(&b, temp_q8, 8, 2);
+ *      MIL_FMT_AddStr(&b, " raw 0x");
+ *      MIL_FMT_AddHex(&b, raw, 4);
+ *      MIL_FMT_AddStr(&b, "\r\n");
+ *      MIL_UART_OutArray(UART0_BASE, line, b.len);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_FMT_H_
+#define MIL_FMT_H_
+
+//longest output of any single MIL_FMT number function
+#define MIL_FMT_MAX_LEN 24
+
+//most digits after the point MIL_FMT_Fixed and MIL_FMT_Float give
+#define MIL_FMT_MAX_DECIMALS 9
+
+/*
+ * Desc: called by the builder with a full buffer, or on MIL_FMT_Flush
+ */
+typedef void (*MIL_FMT_FlushFn)(void *pCtx, uint8_t *pData, uint16_t len);
+
+/*
+ * Desc: a line being built, read len and overflow, leave the rest alone
+ */
+typedef struct{
+
+    uint8_t *pBuf;
+    uint16_t cap;
+    uint16_t len;
+    bool overflow;
+
+    MIL_FMT_FlushFn pFlush;
+    void *pCtx;
+
+}MIL_FMT_Buf;
+
+/*
+ * Desc: Writes a number in decimal
+ *
+ * Parameters:
+ *       pOut: room for MIL_FMT_MAX_LEN characters
+ *       value: the number
+ *
+ * Returns: characters written
+ */
+uint8_t MIL_FMT_U32(uint8_t *pOut, uint32_t value);
+uint8_t MIL_FMT_I32(uint8_t *pOut, int32_t value);
+
+/*
+ * Desc: Writes a number in upper case hex, no 0x
+ *
+ * Parameters:
+ *       digits: pads with 0 to this many digits(1 to 8), 0 for no padding
+ */
+uint8_t MIL_FMT_Hex(uint8_t *pOut, uint32_t value, uint8_t digits);
+
+/*
+ * Desc: Writes a fixed point number with a set number of decimals,
+ *       rounded to nearest
+ *
+ * Parameters:
+ *       value: the raw fixed point value, signed
+ *       frac_bits: bits after the point(8 for Q24.8, 16 for Q16.16)
+ *       decimals: digits after the point, 0 to MIL_FMT_MAX_DECIMALS
+ */
+uint8_t MIL_FMT_Fixed(uint8_t *pOut, int32_t value, uint8_t frac_bits, uint8_t decimals);
+
+/*
+ * Desc: Writes a float with a set number of decimals, rounded to nearest
+ *
+ * Parameters:
+ *       decimals: digits after the point, 0 to MIL_FMT_MAX_DECIMALS(only the
+ *                 first 7 or so significant digits of a float mean anything)
+ */
+uint8_t MIL_FMT_Float(uint8_t *pOut, float value, uint8_t decimals);
+
+/*
+ * Desc: Starts a line in pBuf
+ *
+ * Parameters:
+ *       pFlush: called when pBuf fills, or 0 to drop what doesn't fit
+ *       pCtx: passed back to pFlush
+ */
+void MIL_FMT_BufInit(MIL_FMT_Buf *pB, uint8_t *pBuf, uint16_t cap, MIL_FMT_FlushFn pFlush, void *pCtx);
+
+/*
+ * Desc: Add one piece to the line, same formats as the functions above
+ */
+void MIL_FMT_AddChar(MIL_FMT_Buf *pB, char c);
+void MIL_FMT_AddStr(MIL_FMT_Buf *pB, const char *pStr);
+void MIL_FMT_AddU32(MIL_FMT_Buf *pB, uint32_t value);
+void MIL_FMT_AddI32(MIL_FMT_Buf *pB, int32_t value);
+void MIL_FMT_AddHex(MIL_FMT_Buf *pB, uint32_t value, uint8_t digits);
+void MIL_FMT_AddFixed(MIL_FMT_Buf *pB, int32_t value, uint8_t frac_bits, uint8_t decimals);
+void MIL_FMT_AddFloat(MIL_FMT_Buf *pB, float value, uint8_t decimals);
+
+/*
+ * Desc: Hands what is in the buffer to the flush function and empties it,
+ *       does nothing without one
+ */
+void MIL_FMT_Flush(MIL_FMT_Buf *pB);
+
+#endif /* MIL_FMT_H_ */
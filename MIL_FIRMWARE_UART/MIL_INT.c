@@ -0,0 +1,70 @@
+/*
+ * Name: MIL_INT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: System wide interrupt priority plan and critical sections
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
+#include "driverlib/cpu.h"
+#include "driverlib/interrupt.h"
+
+#include "MIL_INT.h"
+
+//number of implemented priority bits on the TM4C123
+#define PRIORITY_BITS 3
+
+/*
+ * Desc: Makes every priority bit preemptive and moves the
+ *       vector table to RAM
+ */
+void MIL_INT_Init(void){
+
+    IntPriorityGroupingSet(PRIORITY_BITS);
+
+    /*
+     * Re-registering the SysTick handler that is already in the table
+     * makes driverlib copy the whole table to RAM and point VTOR at it
+     */
+    void (**pVectors)(void) = (void (**)(void))HWREG(NVIC_VTABLE);
+    IntRegister(FAULT_SYSTICK, pVectors[FAULT_SYSTICK]);
+
+}
+
+/*
+ * Desc: Sets the priority of one interrupt
+ */
+void MIL_INT_PrioritySet(uint32_t interrupt, uint8_t priority){
+
+    IntPrioritySet(interrupt, priority);
+
+}
+
+/*
+ * Desc: Starts a critical section, blocks every interrupt at
+ *       MIL_INT_MASK_LEVEL and lower
+ *
+ * Returns: a key to give to MIL_INT_Exit
+ */
+uint32_t MIL_INT_Enter(void){
+
+    uint32_t key = CPUbasepriGet();
+
+    //0 means nothing is masked, only ever make the mask stricter so nesting works
+    if(key == 0 || key > MIL_INT_MASK_LEVEL){ CPUbasepriSet(MIL_INT_MASK_LEVEL); }
+
+    return key;
+
+}
+
+/*
+ * Desc: Ends a critical section started with MIL_INT_Enter
+ */
+void MIL_INT_Exit(uint32_t key){
+
+    CPUbasepriSet(key);
+
+}
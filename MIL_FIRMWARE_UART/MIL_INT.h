@@ -0,0 +1,96 @@
+/*
+ * Name: MIL_INT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: System wide interrupt priority plan and critical sections
+ *
+ * What to understand: Every interrupt has a priority. A higher priority
+ *                     ISR(SMALLER number) can interrupt a lower priority one
+ *                     that is already running. Out of reset every interrupt is
+ *                     priority 0, so nothing can interrupt anything and a long
+ *                     UART ISR delays your timer ISR by however long it takes
+ *
+ *                     The TIVA has 3 priority bits, so there are 8 levels
+ *                     0x00, 0x20, 0x40 ... 0xE0. The MIL plan is below, time
+ *                     critical things at the top and bulk data at the bottom
+ *
+ * Critical Sections:
+ *      IntMasterDisable blocks EVERY interrupt. MIL_INT_Enter instead raises
+ *      BASEPRI which only blocks priorities MIL_INT_PRI_TIMER and lower, so a
+ *      zero latency ISR(MIL_INT_PRI_ZERO_LATENCY) still runs on time
+ *
+ *      A zero latency ISR must never call anything that uses
+ *      MIL_INT_Enter, because it can't be blocked by it
+ *
+ *          uint32_t key = MIL_INT_Enter();
+ *          ...touch data shared with an ISR...
+ *          MIL_INT_Exit(key);
+ *
+ * Vector Table Note:
+ *      The first IntRegister(or UARTIntRegister, TimerIntRegister...) call
+ *      copies the vector table from flash to RAM. MIL_INT_Init does that
+ *      copy up front so it never happens in the middle of running code
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_INT_H_
+#define MIL_INT_H_
+
+/************************MIL PRIORITY PLAN******************************/
+
+//never masked by MIL_INT_Enter, keep these ISRs tiny
+#define MIL_INT_PRI_ZERO_LATENCY 0x00
+
+//timer capture and control loop ticks
+#define MIL_INT_PRI_TIMER        0x20
+
+//GPIO edges(buttons, encoders)
+#define MIL_INT_PRI_GPIO         0x40
+
+//DMA completion(SPI sensor reads)
+#define MIL_INT_PRI_DMA          0x60
+
+//UART RX/TX
+#define MIL_INT_PRI_UART         0x80
+
+//anything that can wait(logging, housekeeping)
+#define MIL_INT_PRI_LOW          0xE0
+
+//MIL_INT_Enter masks this priority and everything below it
+#define MIL_INT_MASK_LEVEL       MIL_INT_PRI_TIMER
+
+/*
+ * Desc: Makes every priority bit preemptive(no subpriorities),
+ *       and moves the vector table to RAM. Call once at startup
+ *       before registering any interrupts
+ */
+void MIL_INT_Init(void);
+
+/*
+ * Desc: Sets the priority of one interrupt
+ *
+ * Parameters:
+ *       interrupt: INT_x from hw_ints.h(INT_UART1, INT_TIMER0A...)
+ *       priority: one of the MIL_INT_PRI defines
+ */
+void MIL_INT_PrioritySet(uint32_t interrupt, uint8_t priority);
+
+/*
+ * Desc: Starts a critical section, blocks every interrupt at
+ *       MIL_INT_MASK_LEVEL and lower. Can be nested
+ *
+ * Returns: a key to give to MIL_INT_Exit
+ */
+uint32_t MIL_INT_Enter(void);
+
+/*
+ * Desc: Ends a critical section started with MIL_INT_Enter
+ *
+ * Parameters:
+ *       key: the value MIL_INT_Enter returned
+ */
+void MIL_INT_Exit(uint32_t key);
+
+#endif /* MIL_INT_H_ */
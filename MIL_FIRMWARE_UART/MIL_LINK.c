@@ -0,0 +1,260 @@
+/*
+ * Name: MIL_LINK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Reliable messages over a UART
+ *
+ * Implementation Notes:
+ *       Both rings have a single writer and a single reader, so neither
+ *       side needs a lock as long as it only moves its own index:
+ *
+ *          RX: ISR writes, MIL_LINK_Poll reads
+ *          TX: main loop writes, ISR reads
+ *
+ *       The TX interrupt only fires when the FIFO drains past its trigger
+ *       level, so once the ring runs dry nothing wakes the ISR again.
+ *       Kick refills the FIFO by hand after new bytes are queued, inside
+ *       a MIL_INT critical section so it can't race the ISR for the ring
+ *
+ *       MIL_ARQ is told the byte time so it can work out when each frame
+ *       actually leaves, round trips are measured from then rather than
+ *       from when the frame was queued behind others
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_ARQ.h"
+#include "MIL_STAT.h"
+#include "MIL_LINK.h"
+
+#define TX_MASK (MIL_LINK_TX_BUF_LEN - 1)
+#define RX_MASK (MIL_LINK_RX_BUF_LEN - 1)
+
+//bytes handed to MIL_ARQ per call
+#define RX_CHUNK 32
+
+/************************STATE******************************/
+
+static uint32_t LINK_BASE;
+static MIL_ARQ ARQ;
+
+static uint8_t TX_BUF[MIL_LINK_TX_BUF_LEN];
+static volatile uint16_t tx_head;   //main loop writes
+static volatile uint16_t tx_tail;   //ISR reads
+
+static uint8_t RX_BUF[MIL_LINK_RX_BUF_LEN];
+static volatile uint16_t rx_head;   //ISR writes
+static volatile uint16_t rx_tail;   //main loop reads
+
+static volatile uint32_t rx_dropped;
+static volatile uint32_t rx_overruns;
+static volatile uint32_t rx_framing;
+static uint32_t tx_dropped;
+
+//ISR side counters, tx_bytes is also added to inside Kick's critical section
+static volatile uint32_t isr_count;
+static volatile uint32_t rx_bytes;
+static volatile uint32_t tx_bytes;
+static volatile uint32_t rx_fifo_high;
+
+#if MIL_STAT_EN
+static MIL_STAT_Src STAT_SRC;
+#endif
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//moves queued bytes into the TX FIFO until one of them runs out
+static void FillFIFO(void){
+
+    uint16_t tail = tx_tail;
+
+    while(tail != tx_head && UARTSpaceAvail(LINK_BASE)){
+
+        UARTCharPutNonBlocking(LINK_BASE, TX_BUF[tail & TX_MASK]);
+        tail++;
+
+    }
+
+    tx_bytes += (uint16_t)(tail - tx_tail);
+    tx_tail = tail;
+
+}
+
+static void Kick(void){
+
+    uint32_t key = MIL_INT_Enter();
+
+    FillFIFO();
+
+    MIL_INT_Exit(key);
+
+}
+
+static void LinkISR(void){
+
+    uint32_t status = UARTIntStatus(LINK_BASE, true);
+    UARTIntClear(LINK_BASE, status);
+
+    uint32_t n = 0;
+
+    isr_count++;
+
+    while(UARTCharsAvail(LINK_BASE)){
+
+        uint32_t c = (uint32_t)UARTCharGetNonBlocking(LINK_BASE);
+        n++;
+
+        //a damaged byte still goes in, the frame CRC throws it out
+        if(c & UART_DR_OE){ rx_overruns++; }
+        else if(c & 0xF00){ rx_framing++; }
+
+        uint16_t head = rx_head;
+
+        if((uint16_t)(head - rx_tail) >= MIL_LINK_RX_BUF_LEN){ rx_dropped++; continue; }
+
+        RX_BUF[head & RX_MASK] = (uint8_t)c;
+        rx_head = head + 1;
+
+    }
+
+    rx_bytes += n;
+    MIL_STAT_HIGH(rx_fifo_high, n);
+
+    if(status & MIL_TX_INT_EN){ FillFIFO(); }
+
+}
+
+//MIL_ARQ output, queues a whole frame or none of it
+static void Out(void *pCtx, const uint8_t *pFrame, uint16_t len){
+
+    (void)pCtx;
+
+    uint16_t head = tx_head;
+
+    if((uint16_t)(MIL_LINK_TX_BUF_LEN - (uint16_t)(head - tx_tail)) < len){
+
+        //lost like any other frame, the retry timer covers it
+        tx_dropped += len;
+        return;
+
+    }
+
+    for(uint16_t i = 0; i < len; i++){ TX_BUF[(head + i) & TX_MASK] = pFrame[i]; }
+
+    tx_head = head + len;
+
+    Kick();
+
+}
+
+#if MIL_STAT_EN
+
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    (void)pCtx;
+
+    pC->isr = isr_count;
+    pC->rx_bytes = rx_bytes;
+    pC->tx_bytes = tx_bytes;
+    pC->overruns = rx_overruns;
+    pC->errors = rx_framing;
+    pC->dropped = rx_dropped;
+    pC->fifo_high = rx_fifo_high;
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts the link on an initialized UART
+ */
+void MIL_LINK_Init(uint32_t base, uint32_t baud_rate, MIL_ARQ_DeliverFn pDeliver, void *pCtx){
+
+    LINK_BASE = base;
+
+    tx_head = 0;
+    tx_tail = 0;
+    rx_head = 0;
+    rx_tail = 0;
+    rx_dropped = 0;
+    rx_overruns = 0;
+    rx_framing = 0;
+    tx_dropped = 0;
+    isr_count = 0;
+    rx_bytes = 0;
+    tx_bytes = 0;
+    rx_fifo_high = 0;
+
+    uint32_t clock = SysCtlClockGet();
+
+    MIL_ARQ_Init(&ARQ, MIL_TIME_FromUs(1000), (10 * clock + baud_rate / 2) / baud_rate,
+                 Out, pDeliver, pCtx);
+
+    //RX timeout picks up the tail of a frame below the trigger level
+    MIL_UART_FIFOEn(base, 4);
+    MIL_UART_InitISR(base, MIL_RX_INT_EN | UART_INT_RT | MIL_TX_INT_EN, LinkISR);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&STAT_SRC, "LINK", StatFill, 0);
+#endif
+
+}
+
+/*
+ * Desc: Queues a message, never blocks
+ */
+bool MIL_LINK_Send(const uint8_t *pData, uint8_t len){
+
+    return MIL_ARQ_Send(&ARQ, pData, len, MIL_TIME_NOW());
+
+}
+
+bool MIL_LINK_CanSend(void){
+
+    return MIL_ARQ_CanSend(&ARQ);
+
+}
+
+/*
+ * Desc: Delivers received messages, resends lost ones and sends acks
+ */
+void MIL_LINK_Poll(void){
+
+    uint8_t chunk[RX_CHUNK];
+
+    while(rx_tail != rx_head){
+
+        uint16_t tail = rx_tail;
+        uint16_t n = 0;
+
+        while(n < RX_CHUNK && tail != rx_head){ chunk[n++] = RX_BUF[tail++ & RX_MASK]; }
+
+        //bytes are copied out before the ISR can reuse them
+        rx_tail = tail;
+
+        MIL_ARQ_Rx(&ARQ, chunk, n, MIL_TIME_NOW());
+
+    }
+
+    MIL_ARQ_Poll(&ARQ, MIL_TIME_NOW());
+
+}
+
+void MIL_LINK_StatsGet(MIL_LINK_Stats *pStats){
+
+    MIL_ARQ_StatsGet(&ARQ, &pStats->arq);
+
+    pStats->rx_dropped = rx_dropped;
+    pStats->tx_dropped = tx_dropped;
+    pStats->rx_errors = rx_overruns + rx_framing;
+
+}
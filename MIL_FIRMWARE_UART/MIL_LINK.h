@@ -0,0 +1,113 @@
+/*
+ * Name: MIL_LINK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Reliable messages over a UART, for long tethers that lose bytes
+ *
+ * What to understand: MIL_UART_OutArray sends and forgets, if a byte gets
+ *                     lost on the way nobody finds out. MIL_LINK numbers
+ *                     every message, the other board acknowledges what it
+ *                     got and anything lost is sent again. Messages come
+ *                     out the other end exactly once and in order
+ *
+ *                     Several messages are kept in flight at once, so the
+ *                     link runs close to the line rate even with a long
+ *                     round trip. See MIL_ARQ.h for how the protocol works
+ *
+ *                     Both boards run MIL_LINK, there is no master
+ *
+ * Buffering Note:
+ *      Sending and receiving are interrupt driven, MIL_LINK_Send only
+ *      queues bytes and never waits on the UART. Received messages are
+ *      handed to your deliver function from MIL_LINK_Poll, never from
+ *      an ISR, so it can take its time
+ *
+ * Tuning Note:
+ *      tools/link_sim.c runs the same protocol code over a simulated lossy
+ *      tether, use it to pick MIL_ARQ_WINDOW and MIL_ARQ_MAX_PAYLOAD before
+ *      trying it on hardware. The window needs to cover one round trip of
+ *      messages, longer tethers need a bigger window
+ *
+ * Usage:
+ *      void Deliver(void *pCtx, const uint8_t *pData, uint8_t len){ ... }
+ *
+ *      MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_LINK_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, Deliver, 0);
+ *
+ *      //main loop
+ *      MIL_LINK_Poll();
+ *      if(MIL_LINK_CanSend()){ MIL_LINK_Send(msg, len); }
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+#include "MIL_ARQ.h"
+
+#ifndef MIL_LINK_H_
+#define MIL_LINK_H_
+
+//power of 2, must hold a full window of frames plus acks
+#ifndef MIL_LINK_TX_BUF_LEN
+#define MIL_LINK_TX_BUF_LEN 1024
+#endif
+
+//power of 2, bytes received between two MIL_LINK_Poll calls
+#ifndef MIL_LINK_RX_BUF_LEN
+#define MIL_LINK_RX_BUF_LEN 256
+#endif
+
+/*
+ * Desc: link statistics
+ *
+ *       arq:        protocol counters, see MIL_ARQ.h(srtt and rto are cycles)
+ *       rx_dropped: bytes lost because MIL_LINK_Poll was not called often enough
+ *       tx_dropped: bytes lost because the TX buffer was full
+ *       rx_errors:  bytes the UART flagged(framing, parity, overrun, break)
+ */
+typedef struct{
+
+    MIL_ARQ_Stats arq;
+    uint32_t rx_dropped;
+    uint32_t tx_dropped;
+    uint32_t rx_errors;
+
+}MIL_LINK_Stats;
+
+/*
+ * Desc: Starts the link on an initialized UART
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       baud_rate: the rate the UART was initialized at
+ *       pDeliver: called from MIL_LINK_Poll with each received message
+ *       pCtx: passed back to pDeliver
+ */
+void MIL_LINK_Init(uint32_t base, uint32_t baud_rate, MIL_ARQ_DeliverFn pDeliver, void *pCtx);
+
+/*
+ * Desc: Queues a message, never blocks
+ *
+ * Parameters:
+ *       pData: the message, copied so the caller can reuse it
+ *       len: 1 to MIL_ARQ_MAX_PAYLOAD
+ *
+ * Returns: false if the window is full or len is out of range
+ */
+bool MIL_LINK_Send(const uint8_t *pData, uint8_t len);
+
+/*
+ * Desc: true if MIL_LINK_Send has room for another message
+ */
+bool MIL_LINK_CanSend(void);
+
+/*
+ * Desc: Delivers received messages, resends lost ones and sends acks,
+ *       call every main loop pass
+ */
+void MIL_LINK_Poll(void);
+
+void MIL_LINK_StatsGet(MIL_LINK_Stats *pStats);
+
+#endif /* MIL_LINK_H_ */
@@ -0,0 +1,224 @@
+/*
+ * Name: MIL_LZ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Small window LZ compression for UART payloads
+ *
+ * Implementation Notes:
+ *       Think of the history and the packet as one long stream. Position
+ *       i of the packet is stream position i, the history sits just before
+ *       it at -fill to -1. A copy can reach back into the history and can
+ *       also overlap itself(d = 1, n = 10 is a run of 10 equal bytes)
+ *
+ *       The search is brute force over every distance, greedy(take the
+ *       longest match at each spot). The first byte and the byte that
+ *       would beat the current best are checked before the full compare,
+ *       which throws out most distances in two loads
+ *
+ *       Bits are packed MSB first. The last byte is padded with ones.
+ *       With small settings a copy can be as short as 7 bits, shorter
+ *       than a literal and no longer than the padding, so the decoder
+ *       can't just stop below 9 bits. Padding of ones reads as the start
+ *       of a literal with fewer than 8 bits behind it, which no real
+ *       literal can be, and that is where the decoder stops
+ *
+ *       After each packet the end of the stream becomes the new history
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "MIL_LZ.h"
+
+#define COPY_BITS (1 + MIL_LZ_WINDOW_BITS + MIL_LZ_LENGTH_BITS)
+#define LITERAL_BITS 9
+
+//shortest item, anything less left at the end is padding
+#define MIN_ITEM_BITS ((COPY_BITS < LITERAL_BITS) ? COPY_BITS : LITERAL_BITS)
+
+/************************PRIVATE FUNCTIONS******************************/
+
+typedef struct{
+
+    uint8_t *pBuf;
+    uint16_t byte;
+    uint8_t  bit;       //bits used in pBuf[byte]
+
+}BitWriter;
+
+static void PutBits(BitWriter *pW, uint32_t value, uint8_t bits){
+
+    while(bits--){
+
+        if(pW->bit == 0){ pW->pBuf[pW->byte] = 0; }
+
+        if(value & (1u << bits)){ pW->pBuf[pW->byte] |= (uint8_t)(0x80 >> pW->bit); }
+
+        if(++pW->bit == 8){ pW->bit = 0; pW->byte++; }
+
+    }
+
+}
+
+typedef struct{
+
+    const uint8_t *pBuf;
+    uint32_t pos;       //in bits
+    uint32_t end;
+
+}BitReader;
+
+static uint32_t GetBits(BitReader *pR, uint8_t bits){
+
+    uint32_t value = 0;
+
+    while(bits--){
+
+        value = (value << 1) | ((pR->pBuf[pR->pos >> 3] >> (7 - (pR->pos & 7))) & 1);
+        pR->pos++;
+
+    }
+
+    return value;
+
+}
+
+//byte at stream position pos, negative positions are history
+static inline uint8_t At(const MIL_LZ *pLz, const uint8_t *pData, int32_t pos){
+
+    return (pos < 0) ? pLz->hist[MIL_LZ_WINDOW + pos] : pData[pos];
+
+}
+
+//slides the last len bytes of the stream into the history
+static void Remember(MIL_LZ *pLz, const uint8_t *pData, uint16_t len){
+
+    if(len >= MIL_LZ_WINDOW){
+
+        memcpy(pLz->hist, &pData[len - MIL_LZ_WINDOW], MIL_LZ_WINDOW);
+        pLz->fill = MIL_LZ_WINDOW;
+        return;
+
+    }
+
+    memmove(pLz->hist, &pLz->hist[len], MIL_LZ_WINDOW - len);
+    memcpy(&pLz->hist[MIL_LZ_WINDOW - len], pData, len);
+
+    pLz->fill = (pLz->fill + len > MIL_LZ_WINDOW) ? MIL_LZ_WINDOW : pLz->fill + len;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts(or restarts) an encoder or decoder with an empty history
+ */
+void MIL_LZ_Init(MIL_LZ *pLz){
+
+    pLz->fill = 0;
+
+}
+
+/*
+ * Desc: Compresses one packet
+ */
+uint16_t MIL_LZ_Encode(MIL_LZ *pLz, const uint8_t *pIn, uint16_t len, uint8_t *pOut){
+
+    BitWriter w = {pOut, 0, 0};
+    int32_t i = 0;
+
+    while(i < len){
+
+        uint16_t best_len = 0;
+        uint16_t best_dist = 0;
+        int32_t reach = i + pLz->fill;
+        uint16_t limit = (len - i < (int32_t)MIL_LZ_MAX_MATCH) ? (uint16_t)(len - i) : MIL_LZ_MAX_MATCH;
+
+        if(reach > (int32_t)MIL_LZ_WINDOW){ reach = MIL_LZ_WINDOW; }
+
+        for(int32_t d = 1; d <= reach && best_len < limit; d++){
+
+            int32_t src = i - d;
+
+            //cheap rejects before the full compare
+            if(At(pLz, pIn, src) != pIn[i]){ continue; }
+            if(best_len && At(pLz, pIn, src + best_len) != pIn[i + best_len]){ continue; }
+
+            uint16_t n = 1;
+            while(n < limit && At(pLz, pIn, src + n) == pIn[i + n]){ n++; }
+
+            if(n > best_len){
+
+                best_len = n;
+                best_dist = (uint16_t)d;
+
+            }
+
+        }
+
+        if(best_len >= MIL_LZ_MIN_MATCH){
+
+            PutBits(&w, 0, 1);
+            PutBits(&w, best_dist - 1, MIL_LZ_WINDOW_BITS);
+            PutBits(&w, best_len - MIL_LZ_MIN_MATCH, MIL_LZ_LENGTH_BITS);
+            i += best_len;
+
+        }
+        else{
+
+            PutBits(&w, 0x100 | pIn[i], LITERAL_BITS);
+            i++;
+
+        }
+
+    }
+
+    //pad with ones, see the notes at the top
+    if(w.bit){ PutBits(&w, 0xFF, (uint8_t)(8 - w.bit)); }
+
+    Remember(pLz, pIn, len);
+
+    return w.byte;
+
+}
+
+/*
+ * Desc: Decompresses one packet
+ */
+bool MIL_LZ_Decode(MIL_LZ *pLz, const uint8_t *pIn, uint16_t len,
+                   uint8_t *pOut, uint16_t max, uint16_t *pOutLen){
+
+    BitReader r = {pIn, 0, (uint32_t)len * 8};
+    uint16_t o = 0;
+
+    while(r.end - r.pos >= MIN_ITEM_BITS){
+
+        if(GetBits(&r, 1)){
+
+            //a literal flag without a whole byte behind it is the padding
+            if(r.end - r.pos < 8){ break; }
+
+            if(o >= max){ return false; }
+            pOut[o++] = (uint8_t)GetBits(&r, 8);
+            continue;
+
+        }
+
+        //padding is all ones, so a copy flag always starts a whole item
+        if(r.end - r.pos < COPY_BITS - 1){ return false; }
+
+        uint16_t d = (uint16_t)GetBits(&r, MIL_LZ_WINDOW_BITS) + 1;
+        uint16_t n = (uint16_t)GetBits(&r, MIL_LZ_LENGTH_BITS) + MIL_LZ_MIN_MATCH;
+
+        if(d > o + pLz->fill || o + n > max){ return false; }
+
+        for(uint16_t k = 0; k < n; k++, o++){ pOut[o] = At(pLz, pOut, (int32_t)o - d); }
+
+    }
+
+    Remember(pLz, pOut, o);
+    *pOutLen = o;
+
+    return true;
+
+}
@@ -0,0 +1,123 @@
+/*
+ * Name: MIL_LZ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Small window LZ compression for UART payloads
+ *       (LZSS, same bit format idea as heatshrink)
+ *
+ * What to understand: Telemetry repeats itself: the same header, the same
+ *                     status bytes, values that barely move. LZ replaces a
+ *                     run of bytes that already went out recently with a
+ *                     short "copy n bytes from d bytes back" code
+ *
+ *                     Every item in the output is one of:
+ *
+ *                        literal:  1 bit 1,  then the 8 bit byte
+ *                        copy:     1 bit 0,  then d - 1 in MIL_LZ_WINDOW_BITS,
+ *                                  then n - MIL_LZ_MIN_MATCH in MIL_LZ_LENGTH_BITS
+ *
+ *                     The history carries over from one packet to the next,
+ *                     so even a short packet compresses well when it looks
+ *                     like the one before it
+ *
+ *                     No heap, the only RAM is the MIL_LZ struct(the window
+ *                     plus a few bytes). tools/telem.c roundtrip encodes and
+ *                     decodes every packet length up to 300 with history
+ *                     carried over, build it once per window and length
+ *                     setting to check them all
+ *
+ * Stream Note:
+ *      Like MIL_PACK, the decoder has to see every packet in order.
+ *      MIL_LZ_Init on both ends makes the next packet self contained
+ *
+ * Speed Note:
+ *      The encoder searches the whole window for every byte, so it costs
+ *      about MIL_LZ_WINDOW compares per input byte worst case. Fewer
+ *      window bits compress a little worse but run faster. Decoding is
+ *      a few cycles per byte. tools/telem.c bench prints both
+ *
+ * Usage:
+ *      MIL_LZ lz;
+ *      uint8_t out[MIL_LZ_MAX_OUT(sizeof(msg))];
+ *
+ *      MIL_LZ_Init(&lz);
+ *      len = MIL_LZ_Encode(&lz, msg, sizeof(msg), out);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_LZ_H_
+#define MIL_LZ_H_
+
+//history size is 2^bits bytes, 4 to 11
+#ifndef MIL_LZ_WINDOW_BITS
+#define MIL_LZ_WINDOW_BITS 8
+#endif
+
+//longest copy is MIL_LZ_MIN_MATCH + 2^bits - 1, 2 to 8
+#ifndef MIL_LZ_LENGTH_BITS
+#define MIL_LZ_LENGTH_BITS 4
+#endif
+
+#if MIL_LZ_WINDOW_BITS < 4 || MIL_LZ_WINDOW_BITS > 11
+#error "MIL_LZ_WINDOW_BITS must be 4 to 11"
+#endif
+
+#if MIL_LZ_LENGTH_BITS < 2 || MIL_LZ_LENGTH_BITS > 8
+#error "MIL_LZ_LENGTH_BITS must be 2 to 8"
+#endif
+
+#define MIL_LZ_WINDOW    (1u << MIL_LZ_WINDOW_BITS)
+#define MIL_LZ_MIN_MATCH 2
+#define MIL_LZ_MAX_MATCH (MIL_LZ_MIN_MATCH + (1u << MIL_LZ_LENGTH_BITS) - 1)
+
+//largest output for len input bytes(all literals)
+#define MIL_LZ_MAX_OUT(len) (((len) * 9 + 7) / 8)
+
+/*
+ * Desc: one encoder or decoder, all fields are private
+ */
+typedef struct{
+
+    uint8_t  hist[MIL_LZ_WINDOW];   //last bytes of the stream, oldest first
+    uint16_t fill;                  //how much of hist is real data
+
+}MIL_LZ;
+
+/*
+ * Desc: Starts(or restarts) an encoder or decoder with an empty history
+ */
+void MIL_LZ_Init(MIL_LZ *pLz);
+
+/*
+ * Desc: Compresses one packet
+ *
+ * Parameters:
+ *       pLz: the encoder
+ *       pIn: the packet
+ *       len: its length
+ *       pOut: at least MIL_LZ_MAX_OUT(len) bytes
+ *
+ * Returns: compressed length
+ */
+uint16_t MIL_LZ_Encode(MIL_LZ *pLz, const uint8_t *pIn, uint16_t len, uint8_t *pOut);
+
+/*
+ * Desc: Decompresses one packet
+ *
+ * Parameters:
+ *       pLz: the decoder
+ *       pIn: the compressed packet
+ *       len: its length
+ *       pOut: the packet
+ *       max: size of pOut
+ *       pOutLen: where the packet length is written
+ *
+ * Returns: false if the packet is damaged or too big for pOut
+ *          (the history is then out of step, MIL_LZ_Init it)
+ */
+bool MIL_LZ_Decode(MIL_LZ *pLz, const uint8_t *pIn, uint16_t len,
+                   uint8_t *pOut, uint16_t max, uint16_t *pOutLen);
+
+#endif /* MIL_LZ_H_ */
@@ -0,0 +1,135 @@
+/*
+ * Name: MIL_PACK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Packs numeric telemetry channels into fewer bytes
+ *
+ * Implementation Notes:
+ *       Deltas are taken in unsigned math so a channel that wraps
+ *       (a counter going from 0x7FFFFFFF to 0x80000000) is still a
+ *       delta of 1 and decodes back exactly
+ *
+ *       Decode works into a copy of the last sample and only keeps it
+ *       once the whole packet has parsed, so a cut off packet never
+ *       leaves the unpacker half updated
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "MIL_PACK.h"
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: writes value as a varint
+ */
+uint8_t MIL_PACK_VarintPut(uint8_t *pOut, uint32_t value){
+
+    uint8_t n = 0;
+
+    while(value >= 0x80){
+
+        pOut[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+
+    }
+
+    pOut[n++] = (uint8_t)value;
+
+    return n;
+
+}
+
+/*
+ * Desc: reads a varint
+ */
+uint8_t MIL_PACK_VarintGet(const uint8_t *pIn, uint16_t len, uint32_t *pValue){
+
+    uint32_t value = 0;
+
+    for(uint8_t n = 0; n < MIL_PACK_VARINT_MAX && n < len; n++){
+
+        value |= (uint32_t)(pIn[n] & 0x7F) << (7 * n);
+
+        if(!(pIn[n] & 0x80)){
+
+            *pValue = value;
+            return n + 1;
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+/*
+ * Desc: Starts a packer(or unpacker) with every channel at 0
+ */
+void MIL_PACK_DeltaInit(MIL_PACK_Delta *pPack, uint8_t channels){
+
+    if(channels > MIL_PACK_MAX_CHANNELS){ channels = MIL_PACK_MAX_CHANNELS; }
+
+    pPack->channels = channels;
+    MIL_PACK_DeltaReset(pPack);
+
+}
+
+/*
+ * Desc: Forgets the previous sample
+ */
+void MIL_PACK_DeltaReset(MIL_PACK_Delta *pPack){
+
+    memset(pPack->last, 0, sizeof(pPack->last));
+
+}
+
+/*
+ * Desc: Packs one sample
+ */
+uint16_t MIL_PACK_DeltaEncode(MIL_PACK_Delta *pPack, const int32_t *pSamples, uint8_t *pOut){
+
+    uint16_t n = 0;
+
+    for(uint8_t ch = 0; ch < pPack->channels; ch++){
+
+        int32_t delta = (int32_t)((uint32_t)pSamples[ch] - (uint32_t)pPack->last[ch]);
+
+        n += MIL_PACK_VarintPut(&pOut[n], MIL_PACK_ZigZag(delta));
+        pPack->last[ch] = pSamples[ch];
+
+    }
+
+    return n;
+
+}
+
+/*
+ * Desc: Unpacks one sample
+ */
+uint16_t MIL_PACK_DeltaDecode(MIL_PACK_Delta *pPack, const uint8_t *pIn, uint16_t len,
+                              int32_t *pSamples){
+
+    int32_t next[MIL_PACK_MAX_CHANNELS];
+    uint16_t n = 0;
+
+    for(uint8_t ch = 0; ch < pPack->channels; ch++){
+
+        uint32_t zz;
+        uint8_t used = MIL_PACK_VarintGet(&pIn[n], len - n, &zz);
+
+        if(used == 0){ return 0; }
+
+        n += used;
+        next[ch] = (int32_t)((uint32_t)pPack->last[ch] + (uint32_t)MIL_PACK_UnZigZag(zz));
+
+    }
+
+    memcpy(pPack->last, next, pPack->channels * sizeof(int32_t));
+    memcpy(pSamples, next, pPack->channels * sizeof(int32_t));
+
+    return n;
+
+}
@@ -0,0 +1,138 @@
+/*
+ * Name: MIL_PACK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Packs numeric telemetry channels into fewer bytes
+ *       (delta + zigzag + varint)
+ *
+ * What to understand: Sensor values change slowly, so each sample is
+ *                     sent as the change since the last sample(delta)
+ *                     instead of the full value. Small changes are small
+ *                     numbers, and small numbers are sent in fewer bytes:
+ *
+ *                        varint: 7 bits per byte, the top bit means
+ *                                "another byte follows". 0 to 127 is one
+ *                                byte, up to 16383 is two, ...
+ *
+ *                        zigzag: maps -1 to 1, 1 to 2, -2 to 3 ... so a
+ *                                small negative change is also small
+ *
+ *                     A temperature that moves by a few counts goes from
+ *                     4 bytes to 1 byte per sample
+ *
+ *                     tools/telem.c decodes a capture of main_telem.c with this
+ *                     code, and its bench checks every packing method decodes back
+ *                     exactly
+ *
+ * Stream Note:
+ *      Each delta depends on the sample before it, so the decoder has to
+ *      see every packet, in order. Over a lossy link send packets with
+ *      MIL_LINK, or call MIL_PACK_DeltaReset on both ends every so often
+ *      (a key frame) so a lost packet only breaks the data up to the next one
+ *
+ * Usage:
+ *      MIL_PACK_Delta pack;
+ *      uint8_t out[MIL_PACK_MAX_OUT(4)];
+ *
+ *      MIL_PACK_DeltaInit(&pack, 4);
+ *      len = MIL_PACK_DeltaEncode(&pack, samples, out);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_PACK_H_
+#define MIL_PACK_H_
+
+#ifndef MIL_PACK_MAX_CHANNELS
+#define MIL_PACK_MAX_CHANNELS 16
+#endif
+
+//a 32 bit varint is at most 5 bytes
+#define MIL_PACK_VARINT_MAX 5
+
+//largest packet for one sample of n channels
+#define MIL_PACK_MAX_OUT(n) ((n) * MIL_PACK_VARINT_MAX)
+
+/*
+ * Desc: one packer or unpacker, all fields are private
+ */
+typedef struct{
+
+    int32_t last[MIL_PACK_MAX_CHANNELS];
+    uint8_t channels;
+
+}MIL_PACK_Delta;
+
+/*
+ * Desc: zigzag maps signed to unsigned so small magnitudes stay small
+ */
+static inline uint32_t MIL_PACK_ZigZag(int32_t value){
+
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+
+}
+
+static inline int32_t MIL_PACK_UnZigZag(uint32_t value){
+
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+
+}
+
+/*
+ * Desc: writes value as a varint
+ *
+ * Returns: bytes written, 1 to MIL_PACK_VARINT_MAX
+ */
+uint8_t MIL_PACK_VarintPut(uint8_t *pOut, uint32_t value);
+
+/*
+ * Desc: reads a varint
+ *
+ * Returns: bytes used, 0 if the varint runs past len or is too long
+ */
+uint8_t MIL_PACK_VarintGet(const uint8_t *pIn, uint16_t len, uint32_t *pValue);
+
+/*
+ * Desc: Starts a packer(or unpacker) with every channel at 0
+ *
+ * Parameters:
+ *       pPack: the packer
+ *       channels: values per sample, 1 to MIL_PACK_MAX_CHANNELS
+ */
+void MIL_PACK_DeltaInit(MIL_PACK_Delta *pPack, uint8_t channels);
+
+/*
+ * Desc: Forgets the previous sample, the next packet is self contained.
+ *       Do the same on the decoding end before that packet
+ */
+void MIL_PACK_DeltaReset(MIL_PACK_Delta *pPack);
+
+/*
+ * Desc: Packs one sample
+ *
+ * Parameters:
+ *       pPack: the packer
+ *       pSamples: one value per channel
+ *       pOut: at least MIL_PACK_MAX_OUT(channels) bytes
+ *
+ * Returns: bytes written
+ */
+uint16_t MIL_PACK_DeltaEncode(MIL_PACK_Delta *pPack, const int32_t *pSamples, uint8_t *pOut);
+
+/*
+ * Desc: Unpacks one sample
+ *
+ * Parameters:
+ *       pPack: the unpacker
+ *       pIn: the packet
+ *       len: bytes available in pIn
+ *       pSamples: one value per channel
+ *
+ * Returns: bytes used, 0 if the packet is cut short or damaged
+ *          (pPack is left unchanged)
+ */
+uint16_t MIL_PACK_DeltaDecode(MIL_PACK_Delta *pPack, const uint8_t *pIn, uint16_t len,
+                              int32_t *pSamples);
+
+#endif /* MIL_PACK_H_ */
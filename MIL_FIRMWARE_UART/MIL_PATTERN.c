@@ -0,0 +1,407 @@
+/*
+ * Name: MIL_PATTERN
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Timer paced DMA to GPIO
+ *
+ * Implementation Notes:
+ *       Everything runs in ping-pong mode except a table played once.
+ *       The controller plays the primary structure, switches to the
+ *       alternate, and so on, marking each one stopped as it finishes.
+ *       The ISR refills whichever halves have stopped, oldest first
+ *
+ *       A table that loops is just both halves pointing at the same table
+ *
+ *       If the controller switches to a half that is still stopped it
+ *       disables the channel. The ISR sees that after refilling, counts
+ *       an underrun and enables it again
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_gpio.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+
+#include "MIL_INT.h"
+#include "MIL_DMA.h"
+#include "MIL_STAT.h"
+#include "MIL_PATTERN.h"
+
+#if !MIL_DMA_ALT_EN
+#error "MIL_PATTERN plays in DMA ping-pong mode, set MIL_DMA_ALT_EN to 1 in MIL_CONFIG.h"
+#endif
+
+/************************STATE******************************/
+
+typedef struct{
+
+    uint32_t timer_periph;
+    uint32_t timer;
+    uint32_t timer_int;
+    uint32_t dma;               //uDMAChannelAssign value
+
+}PatternHw;
+
+static const PatternHw HW[MIL_PATTERN_NUM_GENS] = {
+
+    {SYSCTL_PERIPH_TIMER1, TIMER1_BASE, INT_TIMER1A, UDMA_CH20_TIMER1A},
+    {SYSCTL_PERIPH_TIMER3, TIMER3_BASE, INT_TIMER3A, UDMA_CH2_TIMER3A}
+
+};
+
+typedef struct{
+
+    void *pDst;                 //GPIO data register through the pin mask
+
+    uint8_t *pHalf[2];
+    uint16_t half_len[2];       //steps queued in each half
+    bool armed[2];
+    uint8_t next;               //half that finishes next
+    uint16_t len;
+
+    //tables
+    const uint8_t *pTable;
+    uint32_t loops;
+    uint32_t queued;
+
+    //streams
+    MIL_PATTERN_FillFn pFill;
+    void *pCtx;
+
+    volatile bool busy;
+    MIL_PATTERN_Stats stats;
+    volatile uint32_t isr_count;
+
+#if MIL_STAT_EN
+    MIL_STAT_Src stat;
+#endif
+
+}PatternGen;
+
+static PatternGen GEN[MIL_PATTERN_NUM_GENS];
+
+static const uint32_t PORT_BASE[6] = {
+
+    GPIO_PORTA_BASE, GPIO_PORTB_BASE, GPIO_PORTC_BASE,
+    GPIO_PORTD_BASE, GPIO_PORTE_BASE, GPIO_PORTF_BASE
+
+};
+
+static const uint32_t PORT_PERIPH[6] = {
+
+    SYSCTL_PERIPH_GPIOA, SYSCTL_PERIPH_GPIOB, SYSCTL_PERIPH_GPIOC,
+    SYSCTL_PERIPH_GPIOD, SYSCTL_PERIPH_GPIOE, SYSCTL_PERIPH_GPIOF
+
+};
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static uint32_t Channel(uint8_t gen){
+
+    return HW[gen].dma & 0xFF;
+
+}
+
+static uint32_t Select(uint8_t half){
+
+    return half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT;
+
+}
+
+static void Arm(uint8_t gen, uint8_t half, const uint8_t *pBuf, uint16_t len, uint32_t mode){
+
+    PatternGen *pG = &GEN[gen];
+    uint32_t ch = Channel(gen) | Select(half);
+
+    uDMAChannelControlSet(ch, UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    uDMAChannelTransferSet(ch, mode, (void *)pBuf, pG->pDst, len);
+
+    pG->half_len[half] = len;
+    pG->armed[half] = true;
+
+}
+
+static bool Stopped(uint8_t gen, uint8_t half){
+
+    return uDMAChannelModeGet(Channel(gen) | Select(half)) == UDMA_MODE_STOP;
+
+}
+
+//the next thing for a half that just finished, or nothing
+static void Refill(uint8_t gen, uint8_t half){
+
+    PatternGen *pG = &GEN[gen];
+
+    pG->armed[half] = false;
+
+    if(pG->pFill){
+
+        uint16_t n = pG->pFill(pG->pCtx, pG->pHalf[half], pG->len);
+
+        if(n > pG->len){ n = pG->len; }
+
+        if(n){ Arm(gen, half, pG->pHalf[half], n, UDMA_MODE_PINGPONG); }
+        else{ pG->pFill = 0; }
+
+    }
+    else if(pG->pTable && (pG->loops == 0 || pG->queued < pG->loops)){
+
+        Arm(gen, half, pG->pTable, pG->len, UDMA_MODE_PINGPONG);
+        pG->queued++;
+
+    }
+
+}
+
+static void Run(uint8_t gen, uint32_t step_cycles){
+
+    const PatternHw *pHw = &HW[gen];
+
+    GEN[gen].busy = true;
+
+    TimerLoadSet(pHw->timer, TIMER_A, step_cycles - 1);
+    uDMAChannelEnable(Channel(gen));
+    TimerEnable(pHw->timer, TIMER_A);
+
+}
+
+//clears everything from the last pattern, starts on the primary half
+static bool Reset(uint8_t gen, uint16_t len){
+
+    if(gen >= MIL_PATTERN_NUM_GENS || GEN[gen].busy || len == 0 || len > MIL_PATTERN_MAX_LEN){ return false; }
+
+    PatternGen *pG = &GEN[gen];
+
+    pG->armed[0] = false;
+    pG->armed[1] = false;
+    pG->next = 0;
+    pG->len = len;
+    pG->pTable = 0;
+    pG->pFill = 0;
+
+    uDMAChannelAttributeDisable(Channel(gen), UDMA_ATTR_ALTSELECT);
+
+    return true;
+
+}
+
+static void GenISR(uint8_t gen){
+
+    PatternGen *pG = &GEN[gen];
+    const PatternHw *pHw = &HW[gen];
+
+    TimerIntClear(pHw->timer, TIMER_TIMA_DMA);
+    pG->isr_count++;
+
+    while(pG->armed[pG->next] && Stopped(gen, pG->next)){
+
+        pG->stats.steps += pG->half_len[pG->next];
+        pG->stats.buffers++;
+
+        Refill(gen, pG->next);
+        pG->next ^= 1;
+
+    }
+
+    if(!pG->armed[0] && !pG->armed[1]){
+
+        TimerDisable(pHw->timer, TIMER_A);
+        pG->busy = false;
+
+    }
+    else if(!uDMAChannelIsEnabled(Channel(gen))){
+
+        pG->stats.underruns++;
+        uDMAChannelEnable(Channel(gen));
+
+    }
+
+}
+
+//TimerIntRegister takes plain functions, so one per generator
+static void Gen0ISR(void){ GenISR(0); }
+static void Gen1ISR(void){ GenISR(1); }
+
+static void (* const GEN_ISR[MIL_PATTERN_NUM_GENS])(void) = {Gen0ISR, Gen1ISR};
+
+#if MIL_STAT_EN
+
+static const char * const STAT_NAME[MIL_PATTERN_NUM_GENS] = {"PATTERN0", "PATTERN1"};
+
+//each step is one byte DMA writes to the port
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    PatternGen *pG = (PatternGen *)pCtx;
+
+    uint32_t key = MIL_INT_Enter();
+
+    pC->isr = pG->isr_count;
+    pC->tx_bytes = pG->stats.steps;
+    pC->overruns = pG->stats.underruns;
+
+    MIL_INT_Exit(key);
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_PATTERN_Init(uint8_t gen, uint32_t port_base, uint8_t pins){
+
+    if(gen >= MIL_PATTERN_NUM_GENS){ return; }
+
+    const PatternHw *pHw = &HW[gen];
+
+    for(uint8_t i = 0; i < 6; i++){
+
+        if(PORT_BASE[i] == port_base){
+
+            SysCtlPeripheralEnable(PORT_PERIPH[i]);
+            while(!SysCtlPeripheralReady(PORT_PERIPH[i]));
+
+        }
+
+    }
+
+    SysCtlPeripheralEnable(pHw->timer_periph);
+    while(!SysCtlPeripheralReady(pHw->timer_periph));
+
+    GPIOPinTypeGPIOOutput(port_base, pins);
+
+    //address bits 9:2 of a data register access pick which pins it touches
+    GEN[gen].pDst = (void *)(port_base + GPIO_O_DATA + ((uint32_t)pins << 2));
+    GEN[gen].busy = false;
+    GEN[gen].isr_count = 0;
+
+    MIL_DMA_Init();
+
+    uDMAChannelAssign(pHw->dma);
+    uDMAChannelAttributeDisable(Channel(gen), UDMA_ATTR_ALL);
+
+    TimerConfigure(pHw->timer, TIMER_CFG_PERIODIC);
+    TimerIntRegister(pHw->timer, TIMER_A, GEN_ISR[gen]);
+    TimerIntEnable(pHw->timer, TIMER_TIMA_DMA);
+    MIL_INT_PrioritySet(pHw->timer_int, MIL_INT_PRI_DMA);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&GEN[gen].stat, STAT_NAME[gen], StatFill, &GEN[gen]);
+#endif
+
+}
+
+bool MIL_PATTERN_Play(uint8_t gen, const uint8_t *pTable, uint16_t len, uint32_t step_cycles, uint32_t loops){
+
+    if(!Reset(gen, len)){ return false; }
+
+    PatternGen *pG = &GEN[gen];
+
+    pG->pTable = pTable;
+    pG->loops = loops;
+
+    if(loops == 1){
+
+        Arm(gen, 0, pTable, len, UDMA_MODE_BASIC);
+        pG->queued = 1;
+
+    }
+    else{
+
+        Arm(gen, 0, pTable, len, UDMA_MODE_PINGPONG);
+        Arm(gen, 1, pTable, len, UDMA_MODE_PINGPONG);
+        pG->queued = 2;
+
+    }
+
+    Run(gen, step_cycles);
+
+    return true;
+
+}
+
+bool MIL_PATTERN_Stream(uint8_t gen, uint8_t *pBufA, uint8_t *pBufB, uint16_t len,
+                        uint32_t step_cycles, MIL_PATTERN_FillFn pFill, void *pCtx){
+
+    if(!Reset(gen, len)){ return false; }
+
+    PatternGen *pG = &GEN[gen];
+
+    pG->pHalf[0] = pBufA;
+    pG->pHalf[1] = pBufB;
+    pG->pFill = pFill;
+    pG->pCtx = pCtx;
+
+    Refill(gen, 0);
+
+    if(!pG->armed[0]){ return false; }
+
+    Refill(gen, 1);
+
+    //a one buffer stream doesn't need the alternate half
+    if(!pG->armed[1]){ Arm(gen, 0, pBufA, pG->half_len[0], UDMA_MODE_BASIC); }
+
+    Run(gen, step_cycles);
+
+    return true;
+
+}
+
+void MIL_PATTERN_Stop(uint8_t gen){
+
+    if(gen >= MIL_PATTERN_NUM_GENS){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    TimerDisable(HW[gen].timer, TIMER_A);
+    uDMAChannelDisable(Channel(gen));
+
+    GEN[gen].armed[0] = false;
+    GEN[gen].armed[1] = false;
+    GEN[gen].busy = false;
+
+    MIL_INT_Exit(key);
+
+}
+
+bool MIL_PATTERN_Busy(uint8_t gen){
+
+    return gen < MIL_PATTERN_NUM_GENS && GEN[gen].busy;
+
+}
+
+void MIL_PATTERN_StatsGet(uint8_t gen, MIL_PATTERN_Stats *pStats){
+
+    if(gen >= MIL_PATTERN_NUM_GENS){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    *pStats = GEN[gen].stats;
+
+    MIL_INT_Exit(key);
+
+}
+
+uint16_t MIL_PATTERN_EncodeBits(uint8_t *pOut, const uint8_t *pData, uint16_t len,
+                                uint8_t pins, uint8_t steps, uint8_t high0, uint8_t high1){
+
+    uint16_t n = 0;
+
+    for(uint16_t i = 0; i < len; i++){
+
+        for(uint8_t bit = 0x80; bit; bit >>= 1){
+
+            uint8_t high = (pData[i] & bit) ? high1 : high0;
+
+            for(uint8_t s = 0; s < steps; s++){ pOut[n++] = (s < high) ? pins : 0; }
+
+        }
+
+    }
+
+    return n;
+
+}
@@ -0,0 +1,159 @@
+/*
+ * Name: MIL_PATTERN
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Plays tables of port values out to GPIO pins at exact
+ *       timing with a timer and DMA, no CPU per edge
+ *
+ * What to understand: A software delay loop(main_blink.c) gets its timing
+ *                     from counting instructions, so every interrupt that
+ *                     lands in the loop stretches it and the CPU can do
+ *                     nothing else while it waits
+ *
+ *                     Here a table holds one port value per step. A timer
+ *                     times out once per step and every timeout asks the
+ *                     DMA to copy the next table entry into the GPIO data
+ *                     register. The edges land on timer ticks, the CPU is
+ *                     only involved once per table(or half buffer)
+ *
+ *                     Only the pins given to MIL_PATTERN_Init change, the
+ *                     DMA writes through the GPIO address mask so the
+ *                     rest of the port is left alone
+ *
+ * Streaming Note:
+ *      MIL_PATTERN_Stream plays two buffers back to back(DMA ping-pong).
+ *      While one plays, the ISR calls your fill function for the other,
+ *      so a pattern can go on forever(stepper ramps, LED strips) as long
+ *      as the fill function is done before the playing half runs out.
+ *      If it isn't the output pauses and underruns counts it
+ *
+ * Speed Note:
+ *      Each step is one DMA transfer through the APB bus, about 16 cycles
+ *      is a safe shortest step(1us at 16MHz). WS2812 LED data needs steps
+ *      of ~0.4us, that takes a faster system clock than MIL_ClkSetInt_16MHz
+ *
+ * Hardware Notes:
+ *       On the TM4C123 a timer timeout always raises a DMA request to the
+ *       timer's channel, and the channel finishing raises the timer's own
+ *       interrupt(TIMER_TIMA_DMA)
+ *
+ *       The port keeps the last value played when a pattern ends, end your
+ *       tables with the idle level
+ *
+ *       main_latency.c uses TIMER0, MIL_SUART and MIL_SPI use the wide timers
+ *
+ * MIL_PATTERN GENERATORS:
+ *      GEN0:
+ *          TIMER: TIMER1 A
+ *          DMA :  ch 20
+ *      GEN1:
+ *          TIMER: TIMER3 A
+ *          DMA :  ch 2
+ *
+ * Usage:
+ *      //square wave on PB0, 2 steps of 10us = 50kHz, forever
+ *      static const uint8_t SQUARE[] = {GPIO_PIN_0, 0};
+ *      MIL_PATTERN_Init(MIL_PATTERN_GEN0, GPIO_PORTB_BASE, GPIO_PIN_0);
+ *      MIL_PATTERN_Play(MIL_PATTERN_GEN0, SQUARE, 2, MIL_TIME_FromUs(10), 0);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_PATTERN_H_
+#define MIL_PATTERN_H_
+
+#define MIL_PATTERN_NUM_GENS 2
+#define MIL_PATTERN_GEN0 0
+#define MIL_PATTERN_GEN1 1
+
+//most steps in one table or half buffer(one DMA transfer)
+#define MIL_PATTERN_MAX_LEN 1024
+
+/*
+ * Desc: fills the next half buffer of a stream, from the ISR
+ *
+ * Returns: steps written, at most len. 0 ends the stream once
+ *          the half already queued has played
+ */
+typedef uint16_t (*MIL_PATTERN_FillFn)(void *pCtx, uint8_t *pBuf, uint16_t len);
+
+/*
+ * Desc: per generator counters
+ *
+ *       steps:     table entries played
+ *       buffers:   tables or half buffers played
+ *       underruns: times a stream ran dry before its next half was ready
+ */
+typedef struct{
+
+    uint32_t steps;
+    uint32_t buffers;
+    uint32_t underruns;
+
+}MIL_PATTERN_Stats;
+
+/*
+ * Desc: Sets the pins up as outputs and gets the generator's timer
+ *       and DMA channel ready
+ *
+ * Parameters:
+ *            gen: MIL_PATTERN_GENx
+ *            port_base: GPIO_PORTx_BASE
+ *            pins: GPIO_PIN_x ORed together, the only pins the pattern changes
+ */
+void MIL_PATTERN_Init(uint8_t gen, uint32_t port_base, uint8_t pins);
+
+/*
+ * Desc: Plays a table
+ *
+ * Parameters:
+ *            pTable: one port value per step, must stay put while playing
+ *            len: 1 to MIL_PATTERN_MAX_LEN
+ *            step_cycles: system clock cycles per step
+ *            loops: times to play it, 0 is forever
+ *
+ * Returns: false if the generator is busy or len is out of range
+ */
+bool MIL_PATTERN_Play(uint8_t gen, const uint8_t *pTable, uint16_t len, uint32_t step_cycles, uint32_t loops);
+
+/*
+ * Desc: Plays a continuous stream from two buffers, calling pFill for
+ *       each half(both before the first step)
+ *
+ * Parameters:
+ *            pBufA, pBufB: len bytes each, yours for as long as it plays
+ *            len: 1 to MIL_PATTERN_MAX_LEN
+ *            pFill: called from the ISR with the half that just finished
+ *
+ * Returns: false if the generator is busy, len is out of range or the
+ *          first fill returned 0
+ */
+bool MIL_PATTERN_Stream(uint8_t gen, uint8_t *pBufA, uint8_t *pBufB, uint16_t len,
+                        uint32_t step_cycles, MIL_PATTERN_FillFn pFill, void *pCtx);
+
+/*
+ * Desc: Stops at the current step, the pins keep their level
+ */
+void MIL_PATTERN_Stop(uint8_t gen);
+
+/*
+ * Desc: true while a pattern is playing
+ */
+bool MIL_PATTERN_Busy(uint8_t gen);
+
+void MIL_PATTERN_StatsGet(uint8_t gen, MIL_PATTERN_Stats *pStats);
+
+/*
+ * Desc: Turns bytes into steps for one-wire style bit timing, MSB first.
+ *       Every bit is steps entries long and starts with high0 or high1
+ *       steps of pins high, the rest low
+ *
+ *       WS2812: steps 3, high0 1, high1 2 with a 0.4us step
+ *
+ * Returns: entries written, len * 8 * steps
+ */
+uint16_t MIL_PATTERN_EncodeBits(uint8_t *pOut, const uint8_t *pData, uint16_t len,
+                                uint8_t pins, uint8_t steps, uint8_t high0, uint8_t high1);
+
+#endif /* MIL_PATTERN_H_ */
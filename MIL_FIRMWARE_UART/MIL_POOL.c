@@ -0,0 +1,291 @@
+/*
+ * Name: MIL_POOL
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Fixed size block pool for packet and message buffers
+ *
+ * Implementation Notes:
+ *       Each class keeps its free list as an array of next indices
+ *       plus a head word. The head word packs a 16 bit index with a
+ *       16 bit tag that changes on every update. Without the tag an
+ *       ISR could pop and push the same block between the main loop
+ *       reading head and swapping it(the ABA problem) and the
+ *       main loop's swap would wrongly succeed
+ *
+ *       Every update is a compare and swap(LDREX/STREX on the M4),
+ *       if an ISR gets in the middle the swap fails and we retry
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "MIL_POOL.h"
+
+#define FREE_LIST_END 0xFFFF
+#define INDEX_MASK    0x0000FFFF
+#define TAG_STEP      0x00010000
+
+//compare and swap, compiles to an LDREX/STREX loop on the M4
+#define CAS(ptr, old_val, new_val) __sync_bool_compare_and_swap((ptr), (old_val), (new_val))
+
+/*
+ * Desc: bookkeeping for one size class
+ */
+typedef struct{
+
+    uint8_t           *pMem;
+    uint32_t           block_size;
+    uint32_t           block_count;
+    uint16_t          *pNext;
+    volatile uint32_t *pRefs;
+    volatile uint32_t  head;    //tag << 16 | index
+    volatile uint32_t  in_use;
+    volatile uint32_t  high_water;
+    volatile uint32_t  fails;
+    volatile uint32_t  misuse;
+
+}PoolClass;
+
+//block storage, declared as words so every block is 4 byte aligned
+static uint32_t SMALL_MEM[(MIL_POOL_SMALL_SIZE * MIL_POOL_SMALL_COUNT + 3) / 4];
+static uint32_t MEDIUM_MEM[(MIL_POOL_MEDIUM_SIZE * MIL_POOL_MEDIUM_COUNT + 3) / 4];
+static uint32_t LARGE_MEM[(MIL_POOL_LARGE_SIZE * MIL_POOL_LARGE_COUNT + 3) / 4];
+
+static uint16_t SMALL_NEXT[MIL_POOL_SMALL_COUNT];
+static uint16_t MEDIUM_NEXT[MIL_POOL_MEDIUM_COUNT];
+static uint16_t LARGE_NEXT[MIL_POOL_LARGE_COUNT];
+
+static volatile uint32_t SMALL_REFS[MIL_POOL_SMALL_COUNT];
+static volatile uint32_t MEDIUM_REFS[MIL_POOL_MEDIUM_COUNT];
+static volatile uint32_t LARGE_REFS[MIL_POOL_LARGE_COUNT];
+
+//ordered smallest to largest, Alloc depends on this
+static PoolClass CLASSES[MIL_POOL_NUM_CLASSES] = {
+
+    {(uint8_t *)SMALL_MEM,  MIL_POOL_SMALL_SIZE,  MIL_POOL_SMALL_COUNT,  SMALL_NEXT,  SMALL_REFS,  FREE_LIST_END, 0, 0, 0, 0},
+    {(uint8_t *)MEDIUM_MEM, MIL_POOL_MEDIUM_SIZE, MIL_POOL_MEDIUM_COUNT, MEDIUM_NEXT, MEDIUM_REFS, FREE_LIST_END, 0, 0, 0, 0},
+    {(uint8_t *)LARGE_MEM,  MIL_POOL_LARGE_SIZE,  MIL_POOL_LARGE_COUNT,  LARGE_NEXT,  LARGE_REFS,  FREE_LIST_END, 0, 0, 0, 0},
+
+};
+
+/************************PRIVATE FUNCTIONS******************************/
+
+/*
+ * Desc: finds which class a block came from and its index
+ *       returns 0 if the pointer is not the start of a pool block
+ */
+static PoolClass *FindBlock(uint8_t *pBlock, uint32_t *pIndex){
+
+    for(uint8_t c = 0; c < MIL_POOL_NUM_CLASSES; c++){
+
+        PoolClass *pClass = &CLASSES[c];
+        uint8_t *pEnd = pClass->pMem + pClass->block_size * pClass->block_count;
+
+        if(pBlock >= pClass->pMem && pBlock < pEnd){
+
+            uint32_t offset = (uint32_t)(pBlock - pClass->pMem);
+            if(offset % pClass->block_size){ return 0; }
+
+            *pIndex = offset / pClass->block_size;
+            return pClass;
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+static bool Pop(PoolClass *pClass, uint32_t *pIndex){
+
+    uint32_t old_head;
+    uint32_t new_head;
+    uint32_t index;
+
+    do{
+
+        old_head = pClass->head;
+        index = old_head & INDEX_MASK;
+        if(index == FREE_LIST_END){ return false; }
+
+        new_head = ((old_head + TAG_STEP) & ~INDEX_MASK) | pClass->pNext[index];
+
+    }while(!CAS(&pClass->head, old_head, new_head));
+
+    *pIndex = index;
+    return true;
+
+}
+
+static void Push(PoolClass *pClass, uint32_t index){
+
+    uint32_t old_head;
+    uint32_t new_head;
+
+    do{
+
+        old_head = pClass->head;
+        pClass->pNext[index] = (uint16_t)(old_head & INDEX_MASK);
+        new_head = ((old_head + TAG_STEP) & ~INDEX_MASK) | index;
+
+    }while(!CAS(&pClass->head, old_head, new_head));
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Builds the free lists, call once at startup
+ *       before anything allocates
+ */
+void MIL_POOL_Init(void){
+
+    for(uint8_t c = 0; c < MIL_POOL_NUM_CLASSES; c++){
+
+        PoolClass *pClass = &CLASSES[c];
+
+        for(uint32_t i = 0; i < pClass->block_count; i++){
+
+            pClass->pNext[i] = (uint16_t)(i + 1);
+            pClass->pRefs[i] = 0;
+
+        }
+        pClass->pNext[pClass->block_count - 1] = FREE_LIST_END;
+
+        pClass->head = 0;
+        pClass->in_use = 0;
+        pClass->high_water = 0;
+        pClass->fails = 0;
+        pClass->misuse = 0;
+
+    }
+
+}
+
+/*
+ * Desc: Borrows a block of at least size bytes
+ *
+ * Returns: pointer to the block or 0 if nothing fits/is free
+ */
+uint8_t *MIL_POOL_Alloc(uint32_t size){
+
+    uint8_t c;
+
+    //smallest class that fits
+    for(c = 0; c < MIL_POOL_NUM_CLASSES; c++){
+
+        if(size <= CLASSES[c].block_size){ break; }
+
+    }
+
+    if(c == MIL_POOL_NUM_CLASSES){ return 0; }
+
+    uint8_t wanted = c;
+
+    //fall through to larger classes if that one is empty
+    for(; c < MIL_POOL_NUM_CLASSES; c++){
+
+        PoolClass *pClass = &CLASSES[c];
+        uint32_t index;
+
+        if(Pop(pClass, &index)){
+
+            pClass->pRefs[index] = 1;
+
+            uint32_t used = __sync_add_and_fetch(&pClass->in_use, 1);
+            uint32_t high = pClass->high_water;
+            while(used > high && !CAS(&pClass->high_water, high, used)){ high = pClass->high_water; }
+
+            return pClass->pMem + index * pClass->block_size;
+
+        }
+
+    }
+
+    __sync_fetch_and_add(&CLASSES[wanted].fails, 1);
+
+    return 0;
+
+}
+
+/*
+ * Desc: Adds an owner to a block(reference count + 1)
+ */
+void MIL_POOL_Retain(uint8_t *pBlock){
+
+    uint32_t index;
+    PoolClass *pClass = FindBlock(pBlock, &index);
+    if(!pClass){ return; }
+
+    uint32_t refs;
+
+    //a free block has no owner to add to
+    do{
+
+        refs = pClass->pRefs[index];
+        if(refs == 0){ __sync_fetch_and_add(&pClass->misuse, 1); return; }
+
+    }while(!CAS(&pClass->pRefs[index], refs, refs + 1));
+
+}
+
+/*
+ * Desc: Removes an owner from a block(reference count - 1)
+ *       the block goes back to the pool when the count hits 0
+ */
+void MIL_POOL_Release(uint8_t *pBlock){
+
+    uint32_t index;
+    PoolClass *pClass = FindBlock(pBlock, &index);
+    if(!pClass){ return; }
+
+    uint32_t refs;
+
+    //a count of 0 is a double release, decrementing would wrap it and
+    //put the block on the free list twice
+    do{
+
+        refs = pClass->pRefs[index];
+        if(refs == 0){ __sync_fetch_and_add(&pClass->misuse, 1); return; }
+
+    }while(!CAS(&pClass->pRefs[index], refs, refs - 1));
+
+    if(refs == 1){
+
+        Push(pClass, index);
+        __sync_fetch_and_sub(&pClass->in_use, 1);
+
+    }
+
+}
+
+/*
+ * Desc: Returns the usable size of a block which may be
+ *       bigger than what was asked for, 0 if not a pool block
+ */
+uint32_t MIL_POOL_BlockSize(uint8_t *pBlock){
+
+    uint32_t index;
+    PoolClass *pClass = FindBlock(pBlock, &index);
+
+    return pClass ? pClass->block_size : 0;
+
+}
+
+/*
+ * Desc: Copies the usage statistics of one size class
+ */
+void MIL_POOL_StatsGet(uint8_t size_class, MIL_POOL_Stats *pStats){
+
+    if(size_class >= MIL_POOL_NUM_CLASSES){ return; }
+
+    PoolClass *pClass = &CLASSES[size_class];
+
+    pStats->block_size = pClass->block_size;
+    pStats->block_count = pClass->block_count;
+    pStats->in_use = pClass->in_use;
+    pStats->high_water = pClass->high_water;
+    pStats->fails = pClass->fails;
+    pStats->misuse = pClass->misuse;
+
+}
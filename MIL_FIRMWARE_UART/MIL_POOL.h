@@ -0,0 +1,139 @@
+/*
+ * Name: MIL_POOL
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Fixed size block pool for packet and message buffers
+ *
+ * What to understand: Instead of every app declaring its own static
+ *                     arrays and copying data between them, buffers are
+ *                     borrowed from a shared pool and given back when done
+ *
+ *                     The pool is split into size classes(small, medium, large).
+ *                     Every block in a class is the same size, so allocating
+ *                     and freeing is just popping/pushing a free list. That is
+ *                     O(1) and never fragments, unlike malloc
+ *
+ *                     Alloc and free are lock free so they are safe to call
+ *                     from both ISRs and the main loop without disabling
+ *                     interrupts
+ *
+ * Reference Counting:
+ *      A block starts with a count of 1. If the same buffer gets queued
+ *      to more than one UART, call MIL_POOL_Retain once per extra owner
+ *      and have every owner call MIL_POOL_Release when it is finished.
+ *      The block goes back to the pool when the last owner releases it
+ *
+ * Sizing Note:
+ *      The class sizes and counts below are defaults, override them
+ *      in your project defines if your traffic needs something else
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_POOL_H_
+#define MIL_POOL_H_
+
+//block sizes in bytes and how many blocks of each
+#ifndef MIL_POOL_SMALL_SIZE
+#define MIL_POOL_SMALL_SIZE   16
+#endif
+#ifndef MIL_POOL_SMALL_COUNT
+#define MIL_POOL_SMALL_COUNT  32
+#endif
+#ifndef MIL_POOL_MEDIUM_SIZE
+#define MIL_POOL_MEDIUM_SIZE  64
+#endif
+#ifndef MIL_POOL_MEDIUM_COUNT
+#define MIL_POOL_MEDIUM_COUNT 16
+#endif
+#ifndef MIL_POOL_LARGE_SIZE
+#define MIL_POOL_LARGE_SIZE   256
+#endif
+#ifndef MIL_POOL_LARGE_COUNT
+#define MIL_POOL_LARGE_COUNT  4
+#endif
+
+//size class ids for MIL_POOL_StatsGet
+#define MIL_POOL_SMALL       0
+#define MIL_POOL_MEDIUM      1
+#define MIL_POOL_LARGE       2
+#define MIL_POOL_NUM_CLASSES 3
+
+/*
+ * Desc: Usage of one size class
+ *
+ *       in_use:     blocks currently handed out
+ *       high_water: most blocks ever handed out at once
+ *       fails:      allocations that could not be served
+ *                   (every larger class was empty too)
+ *       misuse:     Retain or Release on a block that was already
+ *                   back in the pool(a double release), ignored
+ */
+typedef struct{
+
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t in_use;
+    uint32_t high_water;
+    uint32_t fails;
+    uint32_t misuse;
+
+}MIL_POOL_Stats;
+
+/*
+ * Desc: Builds the free lists, call once at startup
+ *       before anything allocates
+ */
+void MIL_POOL_Init(void);
+
+/*
+ * Desc: Borrows a block of at least size bytes
+ *
+ *       The smallest class that fits is tried first, if it is
+ *       empty the next larger class is used
+ *
+ * Parameters:
+ *       size: how many bytes you need
+ *
+ * Returns: pointer to the block or 0 if nothing fits/is free
+ */
+uint8_t *MIL_POOL_Alloc(uint32_t size);
+
+/*
+ * Desc: Adds an owner to a block(reference count + 1),
+ *       retaining a free block does nothing but count as misuse
+ *
+ * Parameters:
+ *       pBlock: pointer returned by MIL_POOL_Alloc
+ */
+void MIL_POOL_Retain(uint8_t *pBlock);
+
+/*
+ * Desc: Removes an owner from a block(reference count - 1)
+ *       the block goes back to the pool when the count hits 0.
+ *       Releasing a free block does nothing but count as misuse
+ *
+ * Parameters:
+ *       pBlock: pointer returned by MIL_POOL_Alloc
+ */
+void MIL_POOL_Release(uint8_t *pBlock);
+
+/*
+ * Desc: Returns the usable size of a block which may be
+ *       bigger than what was asked for, 0 if not a pool block
+ */
+uint32_t MIL_POOL_BlockSize(uint8_t *pBlock);
+
+/*
+ * Desc: Copies the usage statistics of one size class
+ *
+ * Parameters:
+ *       size_class: MIL_POOL_SMALL, MIL_POOL_MEDIUM or MIL_POOL_LARGE
+ *       pStats: where to store the statistics
+ */
+void MIL_POOL_StatsGet(uint8_t size_class, MIL_POOL_Stats *pStats);
+
+#endif /* MIL_POOL_H_ */
@@ -0,0 +1,321 @@
+/*
+ * Name: MIL_RS485
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Several boards sharing one RS-485 bus
+ *
+ * Implementation Notes:
+ *       The TX interrupt runs in end of transmission mode, it fires when
+ *       the FIFO is empty AND the last stop bit is out. The ISR refills
+ *       the FIFO from the TX ring if there is more, otherwise the frame is
+ *       done and DE goes low. Turning DE off any earlier would cut off the
+ *       last byte, any later and the next board to talk collides with us
+ *
+ *       The address byte goes out with UART9BitAddrSend, which waits for it
+ *       to finish. That costs one byte time per frame but keeps the stick
+ *       parity switching out of the ISR. The address finishing raises the
+ *       end of transmission interrupt while the FIFO is still empty, so
+ *       this UART's TX interrupt is switched off from the address until the
+ *       payload is in the FIFO, or the ISR would take the frame as done
+ *       and drop DE under it. Only the TX interrupt, a MIL_INT critical
+ *       section over the wait would hold off every other ISR for a byte time
+ *
+ *       MIL_BUS finds frame ends by silence, so each received byte keeps the
+ *       time it landed. The ISR only knows when it ran, so it works back
+ *       from there: on an RX trigger the newest byte just landed, on an RX
+ *       timeout it landed 32 bit times ago(see MIL_RXTS for the exact
+ *       version). Good to within the ISR latency, far under the gap
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_BUS.h"
+#include "MIL_STAT.h"
+#include "MIL_RS485.h"
+
+#define TX_MASK (MIL_RS485_TX_BUF_LEN - 1)
+#define RX_MASK (MIL_RS485_RX_BUF_LEN - 1)
+
+#define TIMEOUT_BITS 32
+
+/************************STATE******************************/
+
+static uint32_t BUS_BASE;
+static uint32_t DE_PORT;
+static uint8_t DE_PIN;
+static MIL_BUS BUS;
+
+static uint32_t byte_cycles;
+
+static uint8_t TX_BUF[MIL_RS485_TX_BUF_LEN];
+static volatile uint16_t tx_head;   //main loop writes
+static volatile uint16_t tx_tail;   //ISR reads
+static volatile bool tx_active;     //DE is on
+
+static uint8_t RX_BYTE[MIL_RS485_RX_BUF_LEN];
+static uint32_t RX_TIME[MIL_RS485_RX_BUF_LEN];
+static volatile uint16_t rx_head;   //ISR writes
+static volatile uint16_t rx_tail;   //main loop reads
+
+//ISR side counters, tx_bytes is also added to inside Out's critical section
+static volatile uint32_t rx_dropped;
+static volatile uint32_t rx_bytes;
+static volatile uint32_t rx_overruns;
+static volatile uint32_t rx_framing;
+static volatile uint32_t rx_fifo_high;
+static volatile uint32_t tx_bytes;
+static volatile uint32_t isr_count;
+
+#if MIL_STAT_EN
+static MIL_STAT_Src STAT_SRC;
+#endif
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//SysCtl peripheral of a GPIO port base
+static uint32_t PortPeriph(uint32_t port){
+
+    switch(port){
+
+        case GPIO_PORTA_BASE: return SYSCTL_PERIPH_GPIOA;
+        case GPIO_PORTB_BASE: return SYSCTL_PERIPH_GPIOB;
+        case GPIO_PORTC_BASE: return SYSCTL_PERIPH_GPIOC;
+        case GPIO_PORTD_BASE: return SYSCTL_PERIPH_GPIOD;
+        case GPIO_PORTE_BASE: return SYSCTL_PERIPH_GPIOE;
+        default: return SYSCTL_PERIPH_GPIOF;
+
+    };
+
+}
+
+static void FillFIFO(void){
+
+    uint16_t tail = tx_tail;
+
+    while(tail != tx_head && UARTSpaceAvail(BUS_BASE)){
+
+        UARTCharPutNonBlocking(BUS_BASE, TX_BUF[tail & TX_MASK]);
+        tail++;
+
+    }
+
+    tx_bytes += (uint16_t)(tail - tx_tail);
+    tx_tail = tail;
+
+}
+
+static void RS485ISR(void){
+
+    //read the clock before anything else
+    uint32_t now = MIL_TIME_NOW();
+
+    uint32_t status = UARTIntStatus(BUS_BASE, true);
+    UARTIntClear(BUS_BASE, status);
+
+    uint8_t raw[16];
+    uint8_t n = 0;
+
+    isr_count++;
+
+    while(n < sizeof(raw) && UARTCharsAvail(BUS_BASE)){
+
+        uint32_t c = (uint32_t)UARTCharGetNonBlocking(BUS_BASE);
+
+        if(c & UART_DR_OE){ rx_overruns++; }
+        else if(c & 0xF00){ rx_framing++; }
+
+        raw[n++] = (uint8_t)c;
+
+    }
+
+    rx_bytes += n;
+    MIL_STAT_HIGH(rx_fifo_high, n);
+
+    if(n){
+
+        //when the newest byte landed
+        uint32_t last = (status & UART_INT_RT) ? now - TIMEOUT_BITS * byte_cycles / 10 : now;
+
+        for(uint8_t i = 0; i < n; i++){
+
+            uint16_t head = rx_head;
+
+            if((uint16_t)(head - rx_tail) >= MIL_RS485_RX_BUF_LEN){ rx_dropped++; continue; }
+
+            RX_BYTE[head & RX_MASK] = raw[i];
+            RX_TIME[head & RX_MASK] = last - (n - 1 - i) * byte_cycles;
+            rx_head = head + 1;
+
+        }
+
+    }
+
+    if((status & MIL_TX_INT_EN) && tx_active){
+
+        FillFIFO();
+
+        //nothing left and the last stop bit is out
+        if(tx_tail == tx_head && !UARTBusy(BUS_BASE)){
+
+            GPIOPinWrite(DE_PORT, DE_PIN, 0);
+            tx_active = false;
+
+        }
+
+    }
+
+}
+
+//MIL_BUS output, pFrame[0] is the 9 bit address
+static void Out(void *pCtx, const uint8_t *pFrame, uint8_t len){
+
+    (void)pCtx;
+
+    //the schedule never overlaps frames, this only waits out a late ISR
+    while(tx_active);
+
+    //payload first, the ISR can't see it until tx_head moves
+    uint16_t head = tx_head;
+    for(uint8_t i = 1; i < len; i++){ TX_BUF[(head + i - 1) & TX_MASK] = pFrame[i]; }
+
+    tx_active = true;
+    GPIOPinWrite(DE_PORT, DE_PIN, DE_PIN);
+
+    //the end of the address latches the TX interrupt, it runs once re-enabled
+    UARTIntDisable(BUS_BASE, MIL_TX_INT_EN);
+
+    UART9BitAddrSend(BUS_BASE, pFrame[0]);
+
+    tx_head = head + len - 1;
+    FillFIFO();
+
+    UARTIntEnable(BUS_BASE, MIL_TX_INT_EN);
+
+}
+
+#if MIL_STAT_EN
+
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    (void)pCtx;
+
+    pC->isr = isr_count;
+    pC->rx_bytes = rx_bytes;
+    pC->tx_bytes = tx_bytes;
+    pC->overruns = rx_overruns;
+    pC->errors = rx_framing;
+    pC->dropped = rx_dropped;
+    pC->fifo_high = rx_fifo_high;
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Joins the bus as a node
+ */
+void MIL_RS485_Init(uint32_t base, uint32_t baud_rate, uint8_t address,
+                    uint32_t de_port, uint8_t de_pin,
+                    MIL_BUS_FillFn pFill, MIL_BUS_DeliverFn pDeliver, void *pCtx){
+
+    BUS_BASE = base;
+    DE_PORT = de_port;
+    DE_PIN = de_pin;
+
+    tx_head = 0;
+    tx_tail = 0;
+    tx_active = false;
+    rx_head = 0;
+    rx_tail = 0;
+    rx_dropped = 0;
+    rx_bytes = 0;
+    rx_overruns = 0;
+    rx_framing = 0;
+    rx_fifo_high = 0;
+    tx_bytes = 0;
+    isr_count = 0;
+
+    //driver off before anything else, never hold the bus by accident
+    SysCtlPeripheralEnable(PortPeriph(de_port));
+    while(!SysCtlPeripheralReady(PortPeriph(de_port)));
+    GPIOPinTypeGPIOOutput(de_port, de_pin);
+    GPIOPinWrite(de_port, de_pin, 0);
+
+    uint32_t clock = SysCtlClockGet();
+
+    byte_cycles = (10 * clock + baud_rate / 2) / baud_rate;
+
+    MIL_BUS_Init(&BUS, address, byte_cycles, Out, pFill, pDeliver, pCtx);
+
+    //hardware drops every frame not addressed to us
+    UART9BitEnable(base);
+    UART9BitAddrSet(base, address, 0xFF);
+
+    MIL_UART_FIFOEn(base, 1);
+    UARTTxIntModeSet(base, UART_TXINT_MODE_EOT);
+    MIL_UART_InitISR(base, MIL_RX_INT_EN | UART_INT_RT | MIL_TX_INT_EN, RS485ISR);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&STAT_SRC, "RS485", StatFill, 0);
+#endif
+
+}
+
+/*
+ * Desc: Changes the turnaround time and reply timeout
+ */
+void MIL_RS485_TimingSet(uint32_t turnaround_us, uint32_t timeout_us){
+
+    MIL_BUS_TimingSet(&BUS, MIL_TIME_FromUs(turnaround_us), MIL_TIME_FromUs(timeout_us));
+
+}
+
+/*
+ * Desc: Makes this board the master and starts polling
+ */
+bool MIL_RS485_MasterStart(const uint8_t *pNodes, uint8_t num_nodes){
+
+    return MIL_BUS_MasterStart(&BUS, pNodes, num_nodes, MIL_TIME_NOW());
+
+}
+
+/*
+ * Desc: Handles received frames and sends polls or replies when due
+ */
+void MIL_RS485_Poll(void){
+
+    while(rx_tail != rx_head){
+
+        uint16_t tail = rx_tail;
+
+        uint8_t byte = RX_BYTE[tail & RX_MASK];
+        uint32_t stamp = RX_TIME[tail & RX_MASK];
+
+        //entry is copied out before the ISR can reuse it
+        rx_tail = tail + 1;
+
+        MIL_BUS_Rx(&BUS, byte, stamp);
+
+    }
+
+    MIL_BUS_Poll(&BUS, MIL_TIME_NOW());
+
+}
+
+void MIL_RS485_StatsGet(MIL_RS485_Stats *pStats){
+
+    MIL_BUS_StatsGet(&BUS, &pStats->bus);
+
+    pStats->rx_bytes = rx_bytes;
+    pStats->rx_dropped = rx_dropped;
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Name: MIL_RS485
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Several boards sharing one RS-485 bus(multi-drop)
+ *
+ * What to understand: An RS-485 transceiver(MAX485, SN65HVD72 ...) turns a
+ *                     UART into a differential pair that many boards can
+ *                     share over long wires. Each board's transceiver has a
+ *                     driver enable(DE) pin, a board may only turn its driver
+ *                     on while it is talking. MIL_RS485 turns DE on when a
+ *                     frame starts and off from the end of transmission
+ *                     interrupt once the last stop bit has left
+ *
+ *                     Every frame starts with the address of the board it is
+ *                     for, sent with the UART's 9th bit set. The TIVA UART
+ *                     compares that against its own address in hardware and
+ *                     throws away frames for other boards, so a node's CPU
+ *                     only wakes up for its own traffic
+ *
+ *                     Who talks when is decided by MIL_BUS, the master polls
+ *                     each node in turn(see MIL_BUS.h)
+ *
+ * Wiring Note:
+ *      UART TX -> transceiver DI, UART RX <- transceiver RO
+ *      de_pin  -> transceiver DE, tie RE low so the receiver is always on
+ *      A/B of every board on the same pair, terminate both ends with 120R
+ *
+ * Format Note:
+ *      9 bit mode sends 8 data bits plus the address bit, the UART has to be
+ *      set up with MIL_InitUART(8N1) first. Every board on the bus needs to
+ *      use MIL_RS485, a plain 8N1 UART can't receive these frames
+ *
+ * Usage:
+ *      MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_RS485_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, my_address,
+ *                     GPIO_PORTB_BASE, GPIO_PIN_2, Fill, Deliver, 0);
+ *
+ *      //master only
+ *      MIL_RS485_MasterStart(nodes, num_nodes);
+ *
+ *      //main loop, every board
+ *      MIL_RS485_Poll();
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+#include "MIL_BUS.h"
+
+#ifndef MIL_RS485_H_
+#define MIL_RS485_H_
+
+//power of 2, at least MIL_BUS_MAX_FRAME
+#ifndef MIL_RS485_TX_BUF_LEN
+#define MIL_RS485_TX_BUF_LEN 64
+#endif
+
+//power of 2, bytes received between two MIL_RS485_Poll calls
+#ifndef MIL_RS485_RX_BUF_LEN
+#define MIL_RS485_RX_BUF_LEN 128
+#endif
+
+/*
+ * Desc: bus statistics
+ *
+ *       bus:        schedule counters, see MIL_BUS.h
+ *       rx_bytes:   bytes this board's CPU had to handle
+ *       rx_dropped: bytes lost because MIL_RS485_Poll was not called often enough
+ */
+typedef struct{
+
+    MIL_BUS_Stats bus;
+    uint32_t rx_bytes;
+    uint32_t rx_dropped;
+
+}MIL_RS485_Stats;
+
+/*
+ * Desc: Joins the bus as a node
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7), already initialized
+ *       baud_rate: the rate the UART was initialized at
+ *       address: this board's address, MIL_BUS_MASTER_ADDR for the master
+ *       de_port: GPIO_PORTx_BASE of the driver enable pin
+ *       de_pin: GPIO_PIN_x of the driver enable pin
+ *       pFill: supplies the payload of each poll or reply sent
+ *       pDeliver: called from MIL_RS485_Poll with each payload received
+ *       pCtx: passed back to pFill and pDeliver
+ */
+void MIL_RS485_Init(uint32_t base, uint32_t baud_rate, uint8_t address,
+                    uint32_t de_port, uint8_t de_pin,
+                    MIL_BUS_FillFn pFill, MIL_BUS_DeliverFn pDeliver, void *pCtx);
+
+/*
+ * Desc: Changes the turnaround time and reply timeout, every board
+ *       should use the same turnaround(see MIL_BUS.h)
+ */
+void MIL_RS485_TimingSet(uint32_t turnaround_us, uint32_t timeout_us);
+
+/*
+ * Desc: Makes this board the master and starts polling pNodes in order
+ *
+ * Returns: false if the list is empty or too long
+ */
+bool MIL_RS485_MasterStart(const uint8_t *pNodes, uint8_t num_nodes);
+
+/*
+ * Desc: Handles received frames and sends polls or replies when due,
+ *       call every main loop pass
+ */
+void MIL_RS485_Poll(void);
+
+void MIL_RS485_StatsGet(MIL_RS485_Stats *pStats);
+
+#endif /* MIL_RS485_H_ */
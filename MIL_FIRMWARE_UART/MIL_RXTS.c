@@ -0,0 +1,320 @@
+/*
+ * Name: MIL_RXTS
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Timestamped UART receive
+ *
+ * Implementation Notes:
+ *       Times below assume 8N1(10 bits per byte). The UART samples each
+ *       bit in its middle, so a byte lands in the FIFO 9.5 bit times
+ *       after its start bit began. Everything is kept in half bits to
+ *       stay in integer math
+ *
+ *       The ISR picks one byte it knows the landing time of(the reference)
+ *       and stamps every other byte of the batch a whole byte time apart
+ *       from it:
+ *
+ *          RX trigger: byte number trig - 1 landed when the interrupt fired
+ *          RX timeout: the last byte landed 32 bit times before it fired
+ *          neither:    the batch carries on straight after the last byte
+ *
+ *       The third case covers an RX flag left pending by bytes the previous
+ *       ISR already drained, where there is nothing left to reference
+ *
+ *       A stamp is never allowed earlier than one byte time after the
+ *       previous byte, bytes cannot overlap on the wire
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_STAT.h"
+#include "MIL_RXTS.h"
+
+#define NUM_UARTS 8
+
+//RX FIFO is 16 bytes deep, drain a little more than that per ISR
+#define MAX_BATCH 20
+
+//landing point and RX timeout in half bits
+#define LAND_HALF_BITS    19
+#define TIMEOUT_HALF_BITS 64
+#define BYTE_HALF_BITS    20
+
+/************************STATE******************************/
+
+typedef struct{
+
+    MIL_RXTS_Byte *pBuf;
+    uint16_t mask;
+    volatile uint16_t head;     //ISR writes
+    volatile uint16_t tail;     //main loop reads
+
+    uint32_t base;
+    uint8_t  trig;              //bytes in the FIFO at the RX trigger
+
+    uint32_t half_bit;          //cycles per half bit
+    uint32_t byte_cycles;
+    uint32_t gap_cycles;
+
+    bool     have_last;
+    uint32_t last_start;        //stamp of the last byte received
+
+    volatile uint32_t dropped;
+
+    //ISR side counters
+    volatile uint32_t isr_count;
+    volatile uint32_t rx_bytes;
+    volatile uint32_t overruns;
+    volatile uint32_t errors;
+    volatile uint32_t fifo_high;
+
+#if MIL_STAT_EN
+    MIL_STAT_Src stat;
+#endif
+
+}RxtsState;
+
+static RxtsState RXTS[NUM_UARTS];
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//UART number(0 to 7) of a UART base, 8 for an invalid base
+static uint8_t UartNumber(uint32_t base){
+
+    switch(base){
+
+        case UART0_BASE: return 0;
+        case UART1_BASE: return 1;
+        case UART2_BASE: return 2;
+        case UART3_BASE: return 3;
+        case UART4_BASE: return 4;
+        case UART5_BASE: return 5;
+        case UART6_BASE: return 6;
+        case UART7_BASE: return 7;
+        default: return 8;
+
+    };
+
+}
+
+//bytes in the FIFO when the RX interrupt fires, matches MIL_UART_FIFOEn
+static uint8_t TriggerBytes(uint8_t int_depth){
+
+    if(int_depth >= 7){ return 14; }
+    if(int_depth >= 5){ return 12; }
+    if(int_depth >= 3){ return 8; }
+    if(int_depth == 2){ return 4; }
+
+    return 2;
+
+}
+
+static void Push(RxtsState *pS, uint8_t data, uint8_t error, uint32_t stamp){
+
+    bool sof = !pS->have_last || (int32_t)(stamp - pS->last_start) > (int32_t)pS->gap_cycles;
+
+    pS->have_last = true;
+    pS->last_start = stamp;
+
+    uint16_t head = pS->head;
+
+    if((uint16_t)(head - pS->tail) > pS->mask){ pS->dropped++; return; }
+
+    MIL_RXTS_Byte *pB = &pS->pBuf[head & pS->mask];
+    pB->stamp = stamp;
+    pB->data = data;
+    pB->sof = sof;
+    pB->error = error;
+
+    //entry is complete before the main loop can see it
+    pS->head = head + 1;
+
+}
+
+static void RxtsISR(RxtsState *pS){
+
+    //read the clock before anything else
+    uint32_t now = MIL_TIME_NOW() - MIL_RXTS_ENTRY_CYCLES;
+
+    uint32_t status = UARTIntStatus(pS->base, true);
+    UARTIntClear(pS->base, status);
+
+    uint32_t raw[MAX_BATCH];
+    uint8_t n = 0;
+
+    pS->isr_count++;
+
+    while(n < MAX_BATCH && UARTCharsAvail(pS->base)){
+
+        raw[n++] = (uint32_t)UARTCharGetNonBlocking(pS->base);
+
+    }
+
+    if(n == 0){ return; }
+
+    pS->rx_bytes += n;
+    MIL_STAT_HIGH(pS->fifo_high, n);
+
+    //start bit time of raw[0]
+    uint32_t first;
+
+    if((status & UART_INT_RX) && n >= pS->trig){
+
+        first = now - LAND_HALF_BITS * pS->half_bit - (pS->trig - 1) * pS->byte_cycles;
+
+    }
+    else if(status & UART_INT_RT){
+
+        first = now - (TIMEOUT_HALF_BITS + LAND_HALF_BITS) * pS->half_bit - (n - 1) * pS->byte_cycles;
+
+    }
+    else{
+
+        first = pS->last_start + pS->byte_cycles;
+
+    }
+
+    //bytes cannot overlap the one before them
+    if(pS->have_last && (int32_t)(first - pS->last_start) < (int32_t)pS->byte_cycles){
+
+        first = pS->last_start + pS->byte_cycles;
+
+    }
+
+    for(uint8_t i = 0; i < n; i++){
+
+        uint8_t error = (uint8_t)((raw[i] >> 8) & 0x0F);
+
+        if(error & UART_RXERROR_OVERRUN){ pS->overruns++; }
+        else if(error){ pS->errors++; }
+
+        Push(pS, (uint8_t)raw[i], error, first + i * pS->byte_cycles);
+
+    }
+
+}
+
+//UARTIntRegister takes a plain function, so one per UART
+static void RxtsISR0(void){ RxtsISR(&RXTS[0]); }
+static void RxtsISR1(void){ RxtsISR(&RXTS[1]); }
+static void RxtsISR2(void){ RxtsISR(&RXTS[2]); }
+static void RxtsISR3(void){ RxtsISR(&RXTS[3]); }
+static void RxtsISR4(void){ RxtsISR(&RXTS[4]); }
+static void RxtsISR5(void){ RxtsISR(&RXTS[5]); }
+static void RxtsISR6(void){ RxtsISR(&RXTS[6]); }
+static void RxtsISR7(void){ RxtsISR(&RXTS[7]); }
+
+static void (* const RXTS_ISR[NUM_UARTS])(void) = {
+
+    RxtsISR0, RxtsISR1, RxtsISR2, RxtsISR3,
+    RxtsISR4, RxtsISR5, RxtsISR6, RxtsISR7
+
+};
+
+#if MIL_STAT_EN
+
+static const char * const STAT_NAME[NUM_UARTS] = {
+
+    "RXTS0", "RXTS1", "RXTS2", "RXTS3",
+    "RXTS4", "RXTS5", "RXTS6", "RXTS7"
+
+};
+
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    RxtsState *pS = (RxtsState *)pCtx;
+
+    pC->isr = pS->isr_count;
+    pC->rx_bytes = pS->rx_bytes;
+    pC->overruns = pS->overruns;
+    pC->errors = pS->errors;
+    pC->dropped = pS->dropped;
+    pC->fifo_high = pS->fifo_high;
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts timestamped receive on an initialized UART
+ */
+void MIL_RXTS_Init(uint32_t base, uint32_t baud_rate, uint8_t int_depth,
+                   MIL_RXTS_Byte *pBuf, uint16_t len){
+
+    uint8_t uart = UartNumber(base);
+    if(uart >= NUM_UARTS || len == 0 || (len & (len - 1))){ return; }
+
+    RxtsState *pS = &RXTS[uart];
+    uint32_t clock = SysCtlClockGet();
+
+    pS->pBuf = pBuf;
+    pS->mask = len - 1;
+    pS->head = 0;
+    pS->tail = 0;
+    pS->base = base;
+    pS->trig = TriggerBytes(int_depth);
+
+    //rounded, at 115.2k and 16MHz a half bit is 69.4 cycles
+    pS->half_bit = (clock + baud_rate) / (2 * baud_rate);
+    pS->byte_cycles = (10 * clock + baud_rate / 2) / baud_rate;
+    pS->gap_cycles = pS->byte_cycles + MIL_RXTS_GAP_BITS * 2 * pS->half_bit;
+
+    pS->have_last = false;
+    pS->dropped = 0;
+    pS->isr_count = 0;
+    pS->rx_bytes = 0;
+    pS->overruns = 0;
+    pS->errors = 0;
+    pS->fifo_high = 0;
+
+    MIL_UART_FIFOEn(base, int_depth);
+    MIL_UART_InitISR(base, MIL_RX_INT_EN | UART_INT_RT, RXTS_ISR[uart]);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&pS->stat, STAT_NAME[uart], StatFill, pS);
+#endif
+
+}
+
+/*
+ * Desc: Takes the oldest received byte. Never blocks
+ *
+ * Returns: true if a byte was available
+ */
+bool MIL_RXTS_Get(uint32_t base, MIL_RXTS_Byte *pByte){
+
+    uint8_t uart = UartNumber(base);
+    if(uart >= NUM_UARTS){ return false; }
+
+    RxtsState *pS = &RXTS[uart];
+    uint16_t tail = pS->tail;
+
+    if(tail == pS->head){ return false; }
+
+    *pByte = pS->pBuf[tail & pS->mask];
+
+    //entry is copied out before the ISR can reuse it
+    pS->tail = tail + 1;
+
+    return true;
+
+}
+
+/*
+ * Desc: Bytes lost because the buffer was full
+ */
+uint32_t MIL_RXTS_DroppedGet(uint32_t base){
+
+    uint8_t uart = UartNumber(base);
+    if(uart >= NUM_UARTS){ return 0; }
+
+    return RXTS[uart].dropped;
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Name: MIL_RXTS
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Receives UART data with a timestamp of when each byte's
+ *       start bit actually arrived on the wire
+ *
+ * What to understand: When two sensors(IMU and GPS for example) come in on
+ *                     different UARTs, fusing them needs to know WHEN each
+ *                     measurement arrived. By the time the main loop gets
+ *                     around to UARTCharGet that information is gone
+ *
+ *                     The RX ISR reads MIL_TIME the moment it starts, then
+ *                     works backwards. It knows which byte caused the interrupt
+ *                     (the one that filled the FIFO to its trigger level, or the
+ *                     last byte for an RX timeout) and how long each byte takes
+ *                     at this baud rate, so it can compute when every byte's
+ *                     start bit arrived
+ *
+ * Accuracy Note:
+ *      The back calculation assumes bytes arrived back to back, which is
+ *      how sensors send a message. Stamps are within one bit time as long
+ *      as the ISR starts promptly. A higher priority ISR delaying this one
+ *      shows up directly as error, so for UARTs you timestamp consider
+ *      MIL_UART_ISRPrioritySet(base, MIL_INT_PRI_TIMER)
+ *
+ * Usage:
+ *      static MIL_RXTS_Byte IMU_BUF[64];
+ *      MIL_InitUART(UART2_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_RXTS_Init(UART2_BASE, MIL_DEFAULT_BAUD_115K, 4, IMU_BUF, 64);
+ *
+ *      MIL_RXTS_Byte rx;
+ *      while(MIL_RXTS_Get(UART2_BASE, &rx)){ ...rx.data, rx.stamp... }
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_RXTS_H_
+#define MIL_RXTS_H_
+
+//cycles from the interrupt firing to MIL_TIME being read in the ISR
+#define MIL_RXTS_ENTRY_CYCLES 24
+
+//an idle gap longer than this(in bit times) starts a new frame
+#define MIL_RXTS_GAP_BITS 20
+
+/*
+ * Desc: one received byte
+ *
+ *       stamp: MIL_TIME cycle count when its start bit began
+ *       data:  the byte
+ *       sof:   true if this is the first byte after an idle
+ *              gap(start of frame)
+ *       error: UART error bits(UART_RXERROR_x) for this byte, 0 if clean
+ */
+typedef struct{
+
+    uint32_t stamp;
+    uint8_t  data;
+    bool     sof;
+    uint8_t  error;
+
+}MIL_RXTS_Byte;
+
+/*
+ * Desc: Starts timestamped receive on a UART that has already been
+ *       set up with MIL_InitUART. Enables the FIFO and RX interrupts
+ *       and registers the ISR, MIL_TIME_Init must have been called
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       baud_rate: the baud rate the UART was initialized with
+ *       int_depth: FIFO trigger depth, same values as MIL_UART_FIFOEn
+ *       pBuf: buffer for received bytes(this module never allocates)
+ *       len: entries in pBuf, must be a power of 2
+ */
+void MIL_RXTS_Init(uint32_t base, uint32_t baud_rate, uint8_t int_depth,
+                   MIL_RXTS_Byte *pBuf, uint16_t len);
+
+/*
+ * Desc: Takes the oldest received byte. Never blocks
+ *
+ * Returns: true if a byte was available
+ */
+bool MIL_RXTS_Get(uint32_t base, MIL_RXTS_Byte *pByte);
+
+/*
+ * Desc: Bytes lost because the buffer was full
+ */
+uint32_t MIL_RXTS_DroppedGet(uint32_t base);
+
+#endif /* MIL_RXTS_H_ */
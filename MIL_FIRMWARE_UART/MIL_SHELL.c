@@ -0,0 +1,419 @@
+/*
+ * Name: MIL_SHELL
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: A small command shell for configuring a running board
+ *       over a terminal
+ *
+ * Implementation Notes:
+ *       The ISR edits into EDIT_LINE. When enter is hit the line is
+ *       copied to READY_LINE and line_ready is set. The ISR will not touch
+ *       READY_LINE again until MIL_SHELL_Poll clears line_ready, so the
+ *       main loop can chop it up into words in place
+ *
+ *       Output is a TX ring written by both sides: the ISR echoes into it
+ *       and the main loop queues the prompt and replies inside a MIL_INT
+ *       critical section, so the two never move head at the same time.
+ *       The TX interrupt only fires when the FIFO drains past its
+ *       trigger, so after queuing the main loop refills the FIFO itself
+ *
+ *       C cannot hash strings at compile time, so the perfect hash
+ *       table is built once in MIL_SHELL_Init. It tries hash seeds until
+ *       every command lands in its own slot. With twice as many slots
+ *       as commands this takes a handful of tries at most
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/uart.h"
+
+#include "MIL_INT.h"
+#include "MIL_UART.h"
+#include "MIL_SHELL.h"
+#include "MIL_STAT.h"
+
+//power of 2 and at least twice MIL_SHELL_MAX_CMDS
+#define HASH_SLOTS 32
+#define HASH_SLOT_EMPTY 0xFF
+#define HASH_MAX_TRIES 256
+
+#define TX_MASK (MIL_SHELL_TX_BUF_LEN - 1)
+
+//FNV-1a constants
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+/************************STATE******************************/
+
+static uint32_t SHELL_BASE;
+
+//command lookup
+static const MIL_SHELL_Cmd *CMDS;
+static uint32_t HASH_SEED;
+static uint8_t HASH_TABLE[HASH_SLOTS];
+
+//ISR side line editing
+static char EDIT_LINE[MIL_SHELL_LINE_LEN + 1];
+static uint8_t edit_len;
+static bool discarding;
+static bool last_was_cr;
+
+//hand off to main loop
+static char READY_LINE[MIL_SHELL_LINE_LEN + 1];
+static volatile bool line_ready;
+static volatile uint32_t dropped;
+
+//output, head moves in the ISR or inside a critical section
+static uint8_t TX_BUF[MIL_SHELL_TX_BUF_LEN];
+static volatile uint16_t tx_head;
+static volatile uint16_t tx_tail;
+
+//counters, only ever added to
+static volatile uint32_t isr_count;
+static volatile uint32_t rx_bytes;
+static volatile uint32_t tx_bytes;
+static volatile uint32_t overruns;
+static volatile uint32_t errors;
+static volatile uint32_t fifo_high;
+
+#if MIL_STAT_EN
+static MIL_STAT_Src STAT;
+#endif
+
+static const char PROMPT[] = "> ";
+static const char UNKNOWN[] = "unknown command\r\n";
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static uint32_t Hash(const char *pStr, uint32_t seed){
+
+    uint32_t h = FNV_OFFSET ^ seed;
+
+    while(*pStr){
+
+        h ^= (uint8_t)*pStr++;
+        h *= FNV_PRIME;
+
+    }
+
+    return h & (HASH_SLOTS - 1);
+
+}
+
+/*
+ * Desc: tries to place every command in its own slot with this seed
+ */
+static bool BuildTable(uint8_t num_cmds, uint32_t seed){
+
+    memset(HASH_TABLE, HASH_SLOT_EMPTY, sizeof(HASH_TABLE));
+
+    for(uint8_t i = 0; i < num_cmds; i++){
+
+        uint32_t slot = Hash(CMDS[i].name, seed);
+        if(HASH_TABLE[slot] != HASH_SLOT_EMPTY){ return false; }
+
+        HASH_TABLE[slot] = i;
+
+    }
+
+    return true;
+
+}
+
+//moves queued output into the TX FIFO until one of them runs out
+static void FillFIFO(void){
+
+    uint16_t tail = tx_tail;
+
+    while(tail != tx_head && UARTSpaceAvail(SHELL_BASE)){
+
+        UARTCharPutNonBlocking(SHELL_BASE, TX_BUF[tail & TX_MASK]);
+        tail++;
+
+    }
+
+    tx_bytes += (uint16_t)(tail - tx_tail);
+    tx_tail = tail;
+
+}
+
+//ISR only, a dropped echo only affects the display
+static void Echo(uint8_t c){
+
+    uint16_t head = tx_head;
+
+    if((uint16_t)(head - tx_tail) >= MIL_SHELL_TX_BUF_LEN){ return; }
+
+    TX_BUF[head & TX_MASK] = c;
+    tx_head = head + 1;
+
+}
+
+static void LineDone(void){
+
+    if(discarding || line_ready){
+
+        dropped++;
+
+    }
+    else{
+
+        memcpy(READY_LINE, EDIT_LINE, edit_len);
+        READY_LINE[edit_len] = 0;
+        line_ready = true;
+
+    }
+
+    edit_len = 0;
+    discarding = false;
+
+    Echo(CR);
+    Echo(LF);
+
+}
+
+/*
+ * Desc: RX and RX timeout interrupt, drains the FIFO
+ *       and edits the current line
+ */
+static void ShellISR(void){
+
+    uint32_t status = UARTIntStatus(SHELL_BASE, true);
+    UARTIntClear(SHELL_BASE, status);
+
+    uint32_t n = 0;
+
+    isr_count++;
+
+    while(UARTCharsAvail(SHELL_BASE)){
+
+        uint32_t raw = (uint32_t)UARTCharGetNonBlocking(SHELL_BASE);
+        uint8_t error = (uint8_t)((raw >> 8) & 0x0F);
+        uint8_t c = (uint8_t)raw;
+
+        n++;
+
+        if(error & UART_RXERROR_OVERRUN){ overruns++; }
+        else if(error){ errors++; }
+
+        //CR LF from one enter key only ends one line
+        if(c == LF && last_was_cr){ last_was_cr = false; continue; }
+        last_was_cr = (c == CR);
+
+        if(c == CR || c == LF){
+
+            LineDone();
+
+        }
+        else if(c == BS || c == DEL){
+
+            if(edit_len > 0 && !discarding){
+
+                edit_len--;
+                Echo(BS);
+                Echo(' ');
+                Echo(BS);
+
+            }
+
+        }
+        else if(c >= ' ' && c < DEL){
+
+            if(edit_len < MIL_SHELL_LINE_LEN){
+
+                EDIT_LINE[edit_len++] = (char)c;
+                Echo(c);
+
+            }
+            else{
+
+                discarding = true;
+
+            }
+
+        }
+
+    }
+
+    rx_bytes += n;
+    MIL_STAT_HIGH(fifo_high, n);
+
+    //echoes and anything the main loop queued
+    FillFIFO();
+
+}
+
+#if MIL_STAT_EN
+
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    (void)pCtx;
+
+    pC->isr = isr_count;
+    pC->rx_bytes = rx_bytes;
+    pC->tx_bytes = tx_bytes;
+    pC->overruns = overruns;
+    pC->errors = errors;
+    pC->dropped = dropped;
+    pC->fifo_high = fifo_high;
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Attaches the shell to an already initialized UART,
+ *       builds the command lookup table and enables the RX interrupt
+ *
+ * Returns: false if the table is too big or has duplicate names
+ */
+bool MIL_SHELL_Init(uint32_t base, const MIL_SHELL_Cmd *pCmds, uint8_t num_cmds){
+
+    if(num_cmds > MIL_SHELL_MAX_CMDS){ return false; }
+
+    CMDS = pCmds;
+
+    uint32_t seed;
+    for(seed = 0; seed < HASH_MAX_TRIES; seed++){
+
+        if(BuildTable(num_cmds, seed)){ break; }
+
+    }
+
+    //duplicate names can never be placed
+    if(seed == HASH_MAX_TRIES){ return false; }
+
+    HASH_SEED = seed;
+    SHELL_BASE = base;
+    edit_len = 0;
+    discarding = false;
+    last_was_cr = false;
+    line_ready = false;
+    dropped = 0;
+    tx_head = 0;
+    tx_tail = 0;
+    isr_count = 0;
+    rx_bytes = 0;
+    tx_bytes = 0;
+    overruns = 0;
+    errors = 0;
+    fifo_high = 0;
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&STAT, "SHELL", StatFill, 0);
+#endif
+
+    /*
+     * RX timeout makes single key presses show up without
+     * waiting for the FIFO trigger level, TX drains the ring
+     */
+    MIL_UART_FIFOEn(base, 1);
+    MIL_UART_InitISR(base, MIL_RX_INT_EN | UART_INT_RT | MIL_TX_INT_EN, ShellISR);
+
+    MIL_SHELL_Out(PROMPT);
+
+    return true;
+
+}
+
+/*
+ * Desc: Runs the command for a finished line if there is one
+ *
+ * Returns: true if a line was processed
+ */
+bool MIL_SHELL_Poll(void){
+
+    if(!line_ready){ return false; }
+
+    //split into words in place
+    char *argv[MIL_SHELL_MAX_ARGS];
+    uint8_t argc = 0;
+    char *p = READY_LINE;
+
+    while(*p && argc < MIL_SHELL_MAX_ARGS){
+
+        while(*p == ' '){ *p++ = 0; }
+        if(!*p){ break; }
+
+        argv[argc++] = p;
+        while(*p && *p != ' '){ p++; }
+
+    }
+
+    //extra words past MIL_SHELL_MAX_ARGS are ignored
+    *p = 0;
+
+    if(argc > 0){
+
+        uint8_t index = HASH_TABLE[Hash(argv[0], HASH_SEED)];
+
+        if(index != HASH_SLOT_EMPTY && strcmp(CMDS[index].name, argv[0]) == 0){
+
+            CMDS[index].handler(SHELL_BASE, argc, argv);
+
+        }
+        else{
+
+            MIL_SHELL_Out(UNKNOWN);
+
+        }
+
+    }
+
+    //only now can the ISR reuse READY_LINE
+    line_ready = false;
+
+    MIL_SHELL_Out(PROMPT);
+
+    return true;
+
+}
+
+/*
+ * Desc: Queues text to the terminal, never blocks
+ *
+ * Returns: false if it didn't fit, nothing was queued
+ */
+bool MIL_SHELL_Out(const char *pStr){
+
+    uint16_t len = (uint16_t)strlen(pStr);
+    bool fits;
+
+    uint32_t key = MIL_INT_Enter();
+
+    uint16_t head = tx_head;
+    fits = (uint16_t)(MIL_SHELL_TX_BUF_LEN - (uint16_t)(head - tx_tail)) >= len;
+
+    if(fits){
+
+        for(uint16_t i = 0; i < len; i++){ TX_BUF[(head + i) & TX_MASK] = (uint8_t)pStr[i]; }
+        tx_head = head + len;
+
+        FillFIFO();
+
+    }
+    else{
+
+        dropped++;
+
+    }
+
+    MIL_INT_Exit(key);
+
+    return fits;
+
+}
+
+/*
+ * Desc: How many lines have been thrown away because they
+ *       were too long or the main loop was too slow, plus
+ *       replies that didn't fit in the TX ring
+ */
+uint32_t MIL_SHELL_DroppedGet(void){
+
+    return dropped;
+
+}
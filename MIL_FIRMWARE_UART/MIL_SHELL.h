@@ -0,0 +1,135 @@
+/*
+ * Name: MIL_SHELL
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: A small command shell for configuring a running board
+ *       over a terminal
+ *
+ * What to understand: Typing is handled entirely inside the RX interrupt.
+ *                     Characters are echoed, backspace erases, and
+ *                     when enter(CR or LF) is hit the finished line is
+ *                     handed to the main loop. The main loop only calls
+ *                     MIL_SHELL_Poll which returns right away unless a
+ *                     whole line is waiting, so a user typing slowly
+ *                     or pasting a wall of text never stalls your
+ *                     control loop
+ *
+ *                     Commands are looked up with a perfect hash(no two
+ *                     commands share a slot) so finding a command costs
+ *                     the same no matter how many there are
+ *
+ * Overflow Note:
+ *      Lines longer than MIL_SHELL_LINE_LEN are thrown away
+ *      and so are lines that finish while the main loop still
+ *      has not picked up the previous one. Both are counted
+ *      in MIL_SHELL_DroppedGet
+ *
+ * Output Note:
+ *      Echo, the prompt and command replies all go through one TX ring
+ *      that the UART's TX interrupt drains, nothing waits on the FIFO.
+ *      Handlers should reply with MIL_SHELL_Out, not MIL_UART_OutCString.
+ *      Text that doesn't fit in the ring is left out whole and counted
+ *      in MIL_SHELL_DroppedGet
+ *
+ * Usage:
+ *      static const MIL_SHELL_Cmd CMDS[] = {
+ *          {"led",  LedCmd},
+ *          {"baud", BaudCmd},
+ *      };
+ *      MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_SHELL_Init(UART0_BASE, CMDS, 2);
+ *      while(1){ MIL_SHELL_Poll(); ...control loop... }
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_SHELL_H_
+#define MIL_SHELL_H_
+
+//longest line that can be typed(not including the terminator)
+#ifndef MIL_SHELL_LINE_LEN
+#define MIL_SHELL_LINE_LEN 64
+#endif
+
+//output waiting to go out, power of 2
+#ifndef MIL_SHELL_TX_BUF_LEN
+#define MIL_SHELL_TX_BUF_LEN 256
+#endif
+
+//most words on one line including the command name
+#define MIL_SHELL_MAX_ARGS 8
+
+//most commands in one table
+#define MIL_SHELL_MAX_CMDS 16
+
+//Ascii DEL, most terminals send this for backspace instead of BS
+#define DEL 0x7F
+
+/*
+ * Desc: a command handler
+ *
+ * Parameters:
+ *       base: the UART the command came in on(reply on this one)
+ *       argc: how many words were typed including the command name
+ *       argv: the words, argv[0] is the command name
+ */
+typedef void (*MIL_SHELL_Handler)(uint32_t base, uint8_t argc, char *argv[]);
+
+/*
+ * Desc: one entry in the command table
+ */
+typedef struct{
+
+    const char *name;
+    MIL_SHELL_Handler handler;
+
+}MIL_SHELL_Cmd;
+
+/*
+ * Desc: Attaches the shell to an already initialized UART
+ *       (see MIL_InitUART), builds the command lookup table
+ *       and enables the RX and TX interrupts
+ *
+ *       The FIFO is enabled here(see MIL_UART_FIFOEn) and the TX
+ *       interrupt refills it from the shell's TX ring
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       pCmds: your command table, must stay valid(make it const)
+ *       num_cmds: entries in pCmds, at most MIL_SHELL_MAX_CMDS
+ *
+ * Returns: false if the table is too big or has duplicate names
+ */
+bool MIL_SHELL_Init(uint32_t base, const MIL_SHELL_Cmd *pCmds, uint8_t num_cmds);
+
+/*
+ * Desc: Runs the command for a finished line if there is one
+ *       call this from your main loop, returns right away
+ *       if nothing has been entered
+ *
+ * Returns: true if a line was processed
+ */
+bool MIL_SHELL_Poll(void);
+
+/*
+ * Desc: Queues text to the terminal, never blocks. Use this
+ *       from command handlers
+ *
+ * Parameters:
+ *       pStr: 0 terminated text
+ *
+ * Returns: false if it didn't fit, nothing was queued
+ */
+bool MIL_SHELL_Out(const char *pStr);
+
+/*
+ * Desc: How many lines have been thrown away because they
+ *       were too long or the main loop was too slow, plus
+ *       replies that didn't fit in the TX ring
+ */
+uint32_t MIL_SHELL_DroppedGet(void);
+
+#endif /* MIL_SHELL_H_ */
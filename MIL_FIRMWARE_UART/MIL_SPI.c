@@ -0,0 +1,455 @@
+/*
+ * Name: MIL_SPI
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: SPI master with DMA
+ *
+ * Implementation Notes:
+ *       Every transaction uses both DMA channels, RX is always running even
+ *       when the caller doesn't want the data(it goes to a dummy byte) and
+ *       TX always runs even when there is nothing to send(0xFF from a fixed
+ *       byte). The RX channel finishing means the last byte has been clocked
+ *       in, which is the real end of the transaction
+ *
+ *       On the TM4C123 a finished peripheral DMA channel raises the
+ *       peripheral's own interrupt, so the SSI ISR is the completion
+ *       interrupt. It checks the RX channel actually stopped before
+ *       ending the transaction
+ *
+ *       The ISR starts the next transaction before calling the finished
+ *       one's done function, the bus gap is just the ISR entry and setup
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ssi.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/ssi.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_DMA.h"
+#include "MIL_SPIQ.h"
+#include "MIL_STAT.h"
+#include "MIL_SPI.h"
+
+#define NUM_BUSES 3
+
+/************************STATE******************************/
+
+typedef struct{
+
+    uint32_t base;
+    uint32_t ssi_periph;
+    uint32_t gpio_periph;
+    uint32_t ssi_int;
+    uint32_t rx_dma;            //uDMAChannelAssign values
+    uint32_t tx_dma;
+
+    uint32_t timer_periph;
+    uint32_t timer;
+    uint32_t timer_half;        //TIMER_A or TIMER_B
+    uint32_t timer_int;
+
+}SpiHw;
+
+static const SpiHw HW[NUM_BUSES] = {
+
+    {SSI0_BASE, SYSCTL_PERIPH_SSI0, SYSCTL_PERIPH_GPIOA, INT_SSI0, UDMA_CH10_SSI0RX, UDMA_CH11_SSI0TX,
+     SYSCTL_PERIPH_WTIMER2, WTIMER2_BASE, TIMER_A, INT_WTIMER2A},
+
+    {SSI1_BASE, SYSCTL_PERIPH_SSI1, SYSCTL_PERIPH_GPIOD, INT_SSI1, UDMA_CH24_SSI1RX, UDMA_CH25_SSI1TX,
+     SYSCTL_PERIPH_WTIMER2, WTIMER2_BASE, TIMER_B, INT_WTIMER2B},
+
+    {SSI2_BASE, SYSCTL_PERIPH_SSI2, SYSCTL_PERIPH_GPIOB, INT_SSI2, UDMA_CH12_SSI2RX, UDMA_CH13_SSI2TX,
+     SYSCTL_PERIPH_WTIMER3, WTIMER3_BASE, TIMER_A, INT_WTIMER3A}
+
+};
+
+typedef struct{
+
+    MIL_SPIQ q;
+    MIL_SPI_Xfer *pPeriodic;
+    bool configured;            //MIL_SPI_Config has run, its timer half is set up
+
+    volatile uint32_t isr_count;
+
+#if MIL_STAT_EN
+    MIL_STAT_Src stat;
+#endif
+
+}SpiBus;
+
+static SpiBus BUS[NUM_BUSES];
+
+//what TX sends and RX throws away into when the caller gives no buffer
+static const uint8_t FILL = 0xFF;
+static uint8_t DUMMY;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static int8_t BusIndex(uint32_t base){
+
+    for(int8_t i = 0; i < NUM_BUSES; i++){
+
+        if(HW[i].base == base){ return i; }
+
+    }
+
+    return -1;
+
+}
+
+static uint32_t Channel(uint32_t assign){
+
+    return assign & 0xFF;
+
+}
+
+static void Configure(const SpiHw *pHw, const MIL_SPI_Dev *pDev){
+
+    static const uint32_t PROTOCOL[4] = {
+
+        SSI_FRF_MOTO_MODE_0, SSI_FRF_MOTO_MODE_1,
+        SSI_FRF_MOTO_MODE_2, SSI_FRF_MOTO_MODE_3
+
+    };
+
+    SSIDisable(pHw->base);
+    SSIConfigSetExpClk(pHw->base, SysCtlClockGet(), PROTOCOL[pDev->mode & 3],
+                       SSI_MODE_MASTER, pDev->bit_rate, 8);
+    SSIEnable(pHw->base);
+
+}
+
+//CS low and both DMA channels running
+static void Start(SpiBus *pB, const SpiHw *pHw){
+
+    MIL_SPI_Xfer *pX = pB->q.pHead;
+
+    if(MIL_SPIQ_Started(&pB->q, MIL_TIME_NOW())){ Configure(pHw, pX->pDev); }
+
+    uint32_t rx = Channel(pHw->rx_dma);
+    uint32_t tx = Channel(pHw->tx_dma);
+    void *pData = (void *)(pHw->base + SSI_O_DR);
+
+    GPIOPinWrite(pX->pDev->cs_port, pX->pDev->cs_pin, 0);
+
+    uDMAChannelControlSet(rx | UDMA_PRI_SELECT, UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_ARB_4 |
+                          (pX->pRx ? UDMA_DST_INC_8 : UDMA_DST_INC_NONE));
+    uDMAChannelTransferSet(rx | UDMA_PRI_SELECT, UDMA_MODE_BASIC, pData,
+                           pX->pRx ? pX->pRx : &DUMMY, pX->len);
+
+    uDMAChannelControlSet(tx | UDMA_PRI_SELECT, UDMA_SIZE_8 | UDMA_DST_INC_NONE | UDMA_ARB_4 |
+                          (pX->pTx ? UDMA_SRC_INC_8 : UDMA_SRC_INC_NONE));
+    uDMAChannelTransferSet(tx | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)(pX->pTx ? pX->pTx : &FILL), pData, pX->len);
+
+    //RX first so it is ready for the first byte TX clocks out
+    uDMAChannelEnable(rx);
+    uDMAChannelEnable(tx);
+
+}
+
+static void BusISR(uint8_t i){
+
+    SpiBus *pB = &BUS[i];
+    const SpiHw *pHw = &HW[i];
+
+    SSIIntClear(pHw->base, SSIIntStatus(pHw->base, true));
+    pB->isr_count++;
+
+    //TX finishing raises this interrupt too, wait for the last byte in
+    if(!MIL_SPIQ_Active(&pB->q) || uDMAChannelIsEnabled(Channel(pHw->rx_dma))){ return; }
+
+    MIL_SPI_Xfer *pDone = MIL_SPIQ_Active(&pB->q);
+    MIL_SPI_Xfer *pNext;
+
+    GPIOPinWrite(pDone->pDev->cs_port, pDone->pDev->cs_pin, pDone->pDev->cs_pin);
+
+    MIL_SPIQ_Complete(&pB->q, MIL_TIME_NOW(), &pNext);
+
+    if(pNext){ Start(pB, pHw); }
+
+    if(pDone->pDone){ pDone->pDone(pDone); }
+
+}
+
+static void TimerISR(uint8_t i){
+
+    SpiBus *pB = &BUS[i];
+    const SpiHw *pHw = &HW[i];
+
+    TimerIntClear(pHw->timer, pHw->timer_half == TIMER_A ? TIMER_TIMA_TIMEOUT : TIMER_TIMB_TIMEOUT);
+    pB->isr_count++;
+
+    if(pB->pPeriodic && MIL_SPIQ_Periodic(&pB->q, pB->pPeriodic, MIL_DMA_MAX_XFER)){ Start(pB, pHw); }
+
+}
+
+//SSIIntRegister and TimerIntRegister take plain functions, so one set per bus
+static void Spi0ISR(void){ BusISR(0); }
+static void Spi1ISR(void){ BusISR(1); }
+static void Spi2ISR(void){ BusISR(2); }
+static void Spi0Timer(void){ TimerISR(0); }
+static void Spi1Timer(void){ TimerISR(1); }
+static void Spi2Timer(void){ TimerISR(2); }
+
+static void (* const BUS_ISR[NUM_BUSES])(void) = {Spi0ISR, Spi1ISR, Spi2ISR};
+static void (* const TIMER_ISR[NUM_BUSES])(void) = {Spi0Timer, Spi1Timer, Spi2Timer};
+
+#if MIL_STAT_EN
+
+static const char * const STAT_NAME[NUM_BUSES] = {"SPI0", "SPI1", "SPI2"};
+
+//SPI is full duplex, every byte out is a byte in
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    SpiBus *pB = (SpiBus *)pCtx;
+    MIL_SPIQ_Stats st;
+
+    uint32_t key = MIL_INT_Enter();
+
+    MIL_SPIQ_StatsGet(&pB->q, &st);
+
+    MIL_INT_Exit(key);
+
+    pC->isr = pB->isr_count;
+    pC->rx_bytes = st.bytes;
+    pC->tx_bytes = st.bytes;
+    pC->overruns = st.overruns;
+    pC->dropped = st.rejected;
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Enables a SSI as an SPI master with DMA
+ */
+void MIL_InitSPI(uint32_t base){
+
+    MIL_SPI_ClockEnable(base);
+
+    //registers can't be touched until the clock gate is actually open
+    while(!MIL_SPI_ClockReady(base));
+
+    MIL_SPI_Config(base);
+
+}
+
+void MIL_SPI_ClockEnable(uint32_t base){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return; }
+
+    SysCtlPeripheralEnable(HW[i].ssi_periph);
+    SysCtlPeripheralEnable(HW[i].gpio_periph);
+    SysCtlPeripheralEnable(HW[i].timer_periph);
+
+}
+
+bool MIL_SPI_ClockReady(uint32_t base){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return true; }
+
+    return SysCtlPeripheralReady(HW[i].ssi_periph) && SysCtlPeripheralReady(HW[i].gpio_periph) &&
+           SysCtlPeripheralReady(HW[i].timer_periph);
+
+}
+
+void MIL_SPI_Config(uint32_t base){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return; }
+
+    const SpiHw *pHw = &HW[i];
+
+    //a second Config of the same bus, its own periodic read goes
+    if(BUS[i].configured){ MIL_SPI_PeriodicStop(base); }
+
+    switch(base){
+
+        //CLK : PA2
+        //RX  : PA4
+        //TX  : PA5
+        case SSI0_BASE:
+            GPIOPinConfigure(GPIO_PA2_SSI0CLK);
+            GPIOPinConfigure(GPIO_PA4_SSI0RX);
+            GPIOPinConfigure(GPIO_PA5_SSI0TX);
+            GPIOPinTypeSSI(GPIO_PORTA_BASE, GPIO_PIN_2 | GPIO_PIN_4 | GPIO_PIN_5);
+            break;
+
+        //CLK : PD0
+        //RX  : PD2
+        //TX  : PD3
+        case SSI1_BASE:
+            GPIOPinConfigure(GPIO_PD0_SSI1CLK);
+            GPIOPinConfigure(GPIO_PD2_SSI1RX);
+            GPIOPinConfigure(GPIO_PD3_SSI1TX);
+            GPIOPinTypeSSI(GPIO_PORTD_BASE, GPIO_PIN_0 | GPIO_PIN_2 | GPIO_PIN_3);
+            break;
+
+        //CLK : PB4
+        //RX  : PB6
+        //TX  : PB7
+        case SSI2_BASE:
+            GPIOPinConfigure(GPIO_PB4_SSI2CLK);
+            GPIOPinConfigure(GPIO_PB6_SSI2RX);
+            GPIOPinConfigure(GPIO_PB7_SSI2TX);
+            GPIOPinTypeSSI(GPIO_PORTB_BASE, GPIO_PIN_4 | GPIO_PIN_6 | GPIO_PIN_7);
+            break;
+
+        default:
+            break;
+
+    };
+
+    MIL_SPIQ_Init(&BUS[i].q);
+    BUS[i].pPeriodic = 0;
+    BUS[i].isr_count = 0;
+
+    MIL_DMA_Init();
+
+    uDMAChannelAssign(pHw->rx_dma);
+    uDMAChannelAssign(pHw->tx_dma);
+    uDMAChannelAttributeDisable(Channel(pHw->rx_dma), UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(Channel(pHw->tx_dma), UDMA_ATTR_ALL);
+    uDMAChannelAttributeEnable(Channel(pHw->rx_dma), UDMA_ATTR_HIGH_PRIORITY);
+
+    SSIDMAEnable(base, SSI_DMA_RX | SSI_DMA_TX);
+
+    SSIIntRegister(base, BUS_ISR[i]);
+    MIL_INT_PrioritySet(pHw->ssi_int, MIL_INT_PRI_DMA);
+
+    /*
+     * TimerConfigure sets up and stops both halves of a wide timer, so
+     * only the first bus on a timer calls it. SSI0 and SSI1 share
+     * WTIMER2, the second one's Config would stop the first one's
+     * periodic read otherwise
+     */
+    bool timer_ready = false;
+
+    for(int8_t j = 0; j < NUM_BUSES; j++){
+
+        if(j != i && HW[j].timer == pHw->timer && BUS[j].configured){ timer_ready = true; }
+
+    }
+
+    if(!timer_ready){
+
+        TimerConfigure(pHw->timer, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC | TIMER_CFG_B_PERIODIC);
+
+    }
+
+    BUS[i].configured = true;
+
+    TimerIntRegister(pHw->timer, pHw->timer_half, TIMER_ISR[i]);
+    MIL_INT_PrioritySet(pHw->timer_int, MIL_INT_PRI_DMA);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&BUS[i].stat, STAT_NAME[i], StatFill, &BUS[i]);
+#endif
+
+}
+
+void MIL_SPI_DevInit(const MIL_SPI_Dev *pDev){
+
+    GPIOPinTypeGPIOOutput(pDev->cs_port, pDev->cs_pin);
+    GPIOPinWrite(pDev->cs_port, pDev->cs_pin, pDev->cs_pin);
+
+}
+
+/*
+ * Desc: Queues a transaction, never waits
+ */
+bool MIL_SPI_Submit(uint32_t base, MIL_SPI_Xfer *pXfer){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return false; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    if(MIL_SPIQ_Push(&BUS[i].q, pXfer, MIL_DMA_MAX_XFER)){ Start(&BUS[i], &HW[i]); }
+
+    //a refused transaction keeps whatever state it had
+    bool accepted = pXfer->state == MIL_SPI_QUEUED || pXfer->state == MIL_SPI_ACTIVE;
+
+    MIL_INT_Exit(key);
+
+    return accepted;
+
+}
+
+bool MIL_SPI_Transfer(uint32_t base, const MIL_SPI_Dev *pDev, const uint8_t *pTx, uint8_t *pRx, uint16_t len){
+
+    MIL_SPI_Xfer xfer = {pDev, pTx, pRx, len, 0, 0, MIL_SPI_IDLE, 0};
+
+    if(!MIL_SPI_Submit(base, &xfer)){ return false; }
+
+    while(xfer.state != MIL_SPI_DONE);
+
+    return true;
+
+}
+
+void MIL_SPI_PeriodicStart(uint32_t base, MIL_SPI_Xfer *pXfer, uint32_t period_us){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return; }
+
+    const SpiHw *pHw = &HW[i];
+
+    MIL_SPI_PeriodicStop(base);
+
+    BUS[i].pPeriodic = pXfer;
+
+    TimerLoadSet(pHw->timer, pHw->timer_half, MIL_TIME_FromUs(period_us) - 1);
+    TimerIntEnable(pHw->timer, pHw->timer_half == TIMER_A ? TIMER_TIMA_TIMEOUT : TIMER_TIMB_TIMEOUT);
+    TimerEnable(pHw->timer, pHw->timer_half);
+
+}
+
+void MIL_SPI_PeriodicStop(uint32_t base){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return; }
+
+    const SpiHw *pHw = &HW[i];
+
+    TimerDisable(pHw->timer, pHw->timer_half);
+    TimerIntDisable(pHw->timer, pHw->timer_half == TIMER_A ? TIMER_TIMA_TIMEOUT : TIMER_TIMB_TIMEOUT);
+
+    BUS[i].pPeriodic = 0;
+
+}
+
+bool MIL_SPI_Busy(uint32_t base){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return false; }
+
+    return BUS[i].q.pHead != 0;
+
+}
+
+void MIL_SPI_StatsGet(uint32_t base, MIL_SPIQ_Stats *pStats){
+
+    int8_t i = BusIndex(base);
+    if(i < 0){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    MIL_SPIQ_StatsGet(&BUS[i].q, pStats);
+
+    MIL_INT_Exit(key);
+
+}
@@ -0,0 +1,151 @@
+/*
+ * Name: MIL_SPI
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: SPI master with DMA for sensors and ADCs
+ *
+ * What to understand: SPI is a clock line(CLK), a data out line(TX, also
+ *                     called MOSI), a data in line(RX, MISO) and one chip
+ *                     select(CS) per device. While CS is low every clock
+ *                     sends one bit each way at the same time
+ *
+ *                     MIL_SPI moves the bytes with DMA, the CPU only sets a
+ *                     transaction up and gets one interrupt when it is done.
+ *                     Transactions are queued and the next one starts from
+ *                     that interrupt, so the bus runs back to back with no
+ *                     main loop involved(see MIL_SPIQ.h)
+ *
+ *                     A periodic transaction is resubmitted by a timer, for
+ *                     sensors that have to be read at a fixed rate
+ *
+ * Chip Select Note:
+ *      CS is a plain GPIO chosen per device, not the SSI's FSS pin. The
+ *      hardware FSS goes high between bytes in some modes, most sensors
+ *      want CS held low for the whole burst. Set the CS pin up as an output
+ *      that idles high before the first transaction(MIL_SPI_DevInit does it)
+ *
+ * Speed Note:
+ *      The SSI clock is at most the system clock / 2(8MHz at 16MHz), and
+ *      25MHz at most. The bus is set up again between devices with different
+ *      bit rates or modes, which costs a few microseconds, group traffic by
+ *      device where you can. main_spi.c measures throughput on your board
+ *
+ * Hardware Notes:
+ *       The RX DMA channel is high priority so received bytes are always
+ *       taken before the TX side can overrun the 8 byte RX FIFO
+ *
+ *       Each bus's periodic timer is half a wide timer, WTIMER0 and WTIMER1
+ *       belong to MIL_SUART. SSI0 and SSI1 share WTIMER2, the first of them
+ *       to be set up configures the whole timer and the second only takes
+ *       its half, so they can be set up in either order and at any time.
+ *       Nothing else may call TimerConfigure on WTIMER2 or WTIMER3
+ *
+ *       On the launchpad PB6/PB7 are tied to PD0/PD1 through R9/R10, remove
+ *       them to use SSI1 and SSI2 at the same time
+ *
+ * MIL_SPI PIN MAP:
+ *      SSI0:
+ *          CLK :  PA2
+ *          RX  :  PA4
+ *          TX  :  PA5
+ *          DMA :  ch 10 RX, ch 11 TX
+ *          TIMER: WTIMER2 A
+ *      SSI1:
+ *          CLK :  PD0
+ *          RX  :  PD2
+ *          TX  :  PD3
+ *          DMA :  ch 24 RX, ch 25 TX
+ *          TIMER: WTIMER2 B
+ *      SSI2:
+ *          CLK :  PB4
+ *          RX  :  PB6
+ *          TX  :  PB7
+ *          DMA :  ch 12 RX, ch 13 TX
+ *          TIMER: WTIMER3 A
+ *
+ *      NOTE: SSI3 ONLY COMES OUT ON PD0-PD3, THE SAME PINS AS SSI1,
+ *            AND SSI1'S OTHER PINS(PF0-PF3) ARE THE LAUNCHPAD LEDS AND
+ *            SW2, SO SSI3 IS NOT INCLUDED
+ *
+ * Usage:
+ *      MIL_InitSPI(SSI0_BASE);
+ *
+ *      MIL_SPI_Dev imu = {GPIO_PORTA_BASE, GPIO_PIN_3, 4000000, MIL_SPI_MODE_3};
+ *      MIL_SPI_DevInit(&imu);
+ *
+ *      //one off, waits
+ *      MIL_SPI_Transfer(SSI0_BASE, &imu, cmd, reply, 2);
+ *
+ *      //1kHz burst read, ImuDone runs in the interrupt after each one
+ *      static MIL_SPI_Xfer burst = {&imu, BURST_CMD, burst_rx, 15, ImuDone, 0};
+ *      MIL_SPI_PeriodicStart(SSI0_BASE, &burst, 1000);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_SPIQ.h"
+
+#ifndef MIL_SPI_H_
+#define MIL_SPI_H_
+
+/*
+ * Desc: Enables a SSI as an SPI master with DMA
+ *
+ *       8 bit words, transaction complete interrupt at MIL_INT_PRI_DMA.
+ *       Bit rate and mode come from each transaction's device
+ *
+ * Parameters:
+ *            base: SSI TIVA base SSIx_BASE(where x is 0 to 2)
+ */
+void MIL_InitSPI(uint32_t base);
+
+/*
+ * Desc: MIL_InitSPI in two halves like MIL_UART_ClockEnable/ClockReady/Config,
+ *       so the clock waits can overlap with other peripherals'
+ */
+void MIL_SPI_ClockEnable(uint32_t base);
+bool MIL_SPI_ClockReady(uint32_t base);
+void MIL_SPI_Config(uint32_t base);
+
+/*
+ * Desc: Makes a device's CS pin an output and drives it high(idle).
+ *       The CS port's clock has to be on already
+ */
+void MIL_SPI_DevInit(const MIL_SPI_Dev *pDev);
+
+/*
+ * Desc: Queues a transaction, never waits
+ *
+ * Returns: false if it is already queued or len is 0 or over MIL_DMA_MAX_XFER
+ */
+bool MIL_SPI_Submit(uint32_t base, MIL_SPI_Xfer *pXfer);
+
+/*
+ * Desc: One transaction that waits until it is done, for setup writes
+ *       and anything not time critical. Don't call from an ISR
+ *
+ * Returns: false if it couldn't be queued
+ */
+bool MIL_SPI_Transfer(uint32_t base, const MIL_SPI_Dev *pDev, const uint8_t *pTx, uint8_t *pRx, uint16_t len);
+
+/*
+ * Desc: Runs a transaction every period_us from a timer, one per bus.
+ *       Each run goes ahead of everything waiting, behind only the
+ *       transfer already on the wire. A tick that finds the last run
+ *       unfinished is skipped(overruns)
+ */
+void MIL_SPI_PeriodicStart(uint32_t base, MIL_SPI_Xfer *pXfer, uint32_t period_us);
+void MIL_SPI_PeriodicStop(uint32_t base);
+
+/*
+ * Desc: true while anything is queued or running
+ */
+bool MIL_SPI_Busy(uint32_t base);
+
+/*
+ * Desc: copies out the bus counters, busy_ticks is MIL_TIME cycles
+ */
+void MIL_SPI_StatsGet(uint32_t base, MIL_SPIQ_Stats *pStats);
+
+#endif /* MIL_SPI_H_ */
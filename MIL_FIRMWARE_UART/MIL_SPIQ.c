@@ -0,0 +1,155 @@
+/*
+ * Name: MIL_SPIQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Transaction queue for one SPI bus
+ *
+ * Implementation Notes:
+ *       The queue is a linked list through the transactions themselves,
+ *       so it never fills and needs no memory of its own
+ *
+ *       The caller keeps Push and Complete from running at the same time
+ *       (MIL_SPI does Push inside a MIL_INT critical section, Complete
+ *       runs in the ISR)
+ *
+ *       The bus is only set up again when the next device's bit rate or
+ *       mode differs, devices that match share a setup
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_SPIQ.h"
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_SPIQ_Init(MIL_SPIQ *pQ){
+
+    pQ->pHead = 0;
+    pQ->pTail = 0;
+    pQ->depth = 0;
+    pQ->bit_rate = 0;
+    pQ->mode = 0;
+    pQ->start = 0;
+
+    pQ->stats.xfers = 0;
+    pQ->stats.bytes = 0;
+    pQ->stats.busy_ticks = 0;
+    pQ->stats.queue_max = 0;
+    pQ->stats.overruns = 0;
+    pQ->stats.rejected = 0;
+
+}
+
+bool MIL_SPIQ_Push(MIL_SPIQ *pQ, MIL_SPI_Xfer *pXfer, uint16_t max_len){
+
+    uint8_t state = pXfer->state;
+
+    if(state == MIL_SPI_QUEUED || state == MIL_SPI_ACTIVE ||
+       pXfer->len == 0 || pXfer->len > max_len || !pXfer->pDev){
+
+        pQ->stats.rejected++;
+        return false;
+
+    }
+
+    pXfer->state = MIL_SPI_QUEUED;
+    pXfer->pNext = 0;
+
+    if(pQ->pTail){ pQ->pTail->pNext = pXfer; }
+    else{ pQ->pHead = pXfer; }
+
+    pQ->pTail = pXfer;
+
+    if(++pQ->depth > pQ->stats.queue_max){ pQ->stats.queue_max = pQ->depth; }
+
+    return pQ->pHead == pXfer;
+
+}
+
+bool MIL_SPIQ_Periodic(MIL_SPIQ *pQ, MIL_SPI_Xfer *pXfer, uint16_t max_len){
+
+    uint8_t state = pXfer->state;
+
+    if(state == MIL_SPI_QUEUED || state == MIL_SPI_ACTIVE){
+
+        pQ->stats.overruns++;
+        return false;
+
+    }
+
+    MIL_SPI_Xfer *pHead = pQ->pHead;
+
+    if(!pHead || !pHead->pNext){ return MIL_SPIQ_Push(pQ, pXfer, max_len); }
+
+    if(pXfer->len == 0 || pXfer->len > max_len || !pXfer->pDev){
+
+        pQ->stats.rejected++;
+        return false;
+
+    }
+
+    //the head is always running once the bus has been kicked off
+    pXfer->state = MIL_SPI_QUEUED;
+    pXfer->pNext = pHead->pNext;
+    pHead->pNext = pXfer;
+
+    if(++pQ->depth > pQ->stats.queue_max){ pQ->stats.queue_max = pQ->depth; }
+
+    return false;
+
+}
+
+bool MIL_SPIQ_Started(MIL_SPIQ *pQ, uint32_t now){
+
+    MIL_SPI_Xfer *pXfer = pQ->pHead;
+
+    if(!pXfer){ return false; }
+
+    pXfer->state = MIL_SPI_ACTIVE;
+    pQ->start = now;
+
+    //compared by value, a device's rate can change between transactions
+    const MIL_SPI_Dev *pDev = pXfer->pDev;
+
+    if(pQ->bit_rate == pDev->bit_rate && pQ->mode == pDev->mode){ return false; }
+
+    pQ->bit_rate = pDev->bit_rate;
+    pQ->mode = pDev->mode;
+
+    return true;
+
+}
+
+MIL_SPI_Xfer *MIL_SPIQ_Complete(MIL_SPIQ *pQ, uint32_t now, MIL_SPI_Xfer **ppNext){
+
+    MIL_SPI_Xfer *pXfer = pQ->pHead;
+
+    if(!pXfer || pXfer->state != MIL_SPI_ACTIVE){ *ppNext = 0; return 0; }
+
+    pQ->pHead = pXfer->pNext;
+    if(!pQ->pHead){ pQ->pTail = 0; }
+    pQ->depth--;
+
+    pQ->stats.xfers++;
+    pQ->stats.bytes += pXfer->len;
+    pQ->stats.busy_ticks += now - pQ->start;
+
+    pXfer->state = MIL_SPI_DONE;
+
+    *ppNext = pQ->pHead;
+
+    return pXfer;
+
+}
+
+MIL_SPI_Xfer *MIL_SPIQ_Active(const MIL_SPIQ *pQ){
+
+    return (pQ->pHead && pQ->pHead->state == MIL_SPI_ACTIVE) ? pQ->pHead : 0;
+
+}
+
+void MIL_SPIQ_StatsGet(const MIL_SPIQ *pQ, MIL_SPIQ_Stats *pStats){
+
+    *pStats = pQ->stats;
+
+}
@@ -0,0 +1,192 @@
+/*
+ * Name: MIL_SPIQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Transaction queue for one SPI bus, the scheduling half of MIL_SPI
+ *
+ * What to understand: A transaction is one chip select low, len bytes out
+ *                     and len bytes in at the same time(SPI is full duplex),
+ *                     chip select high. Several devices can share a bus, each
+ *                     with its own chip select, bit rate and mode
+ *
+ *                     Transactions are queued and run one after another in
+ *                     the order they were submitted. The next one starts from
+ *                     the completion interrupt of the last, so the bus never
+ *                     waits for the main loop to notice it is free
+ *
+ *                     A periodic transaction(a sensor burst read) is pushed
+ *                     again on every timer tick. If the last run hasn't
+ *                     finished by the next tick that tick is skipped and
+ *                     counted as an overrun, runs never pile up
+ *
+ *                     tools/spi_sim.c runs this code against a simulated SSI, DMA
+ *                     and register map sensor, checks every read against what the
+ *                     sensor held and counts periodic overruns
+ *
+ * Transaction Note:
+ *      Zero a MIL_SPI_Xfer before first use(globals and statics already
+ *      are), its state has to start as MIL_SPI_IDLE
+ *
+ *      A MIL_SPI_Xfer belongs to the queue from submit until its state is
+ *      MIL_SPI_DONE, don't touch its buffers or resubmit it before then.
+ *      The done function runs in the completion interrupt
+ *
+ * Time Note:
+ *      Every function takes now, a free running 32 bit tick count.
+ *      On the board that is MIL_TIME cycles
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_SPIQ_H_
+#define MIL_SPIQ_H_
+
+//transaction states
+#define MIL_SPI_IDLE   0
+#define MIL_SPI_QUEUED 1
+#define MIL_SPI_ACTIVE 2
+#define MIL_SPI_DONE   3
+
+//clock polarity and phase, same numbering as every SPI datasheet
+#define MIL_SPI_MODE_0 0
+#define MIL_SPI_MODE_1 1
+#define MIL_SPI_MODE_2 2
+#define MIL_SPI_MODE_3 3
+
+/*
+ * Desc: one device on a bus
+ *
+ *       cs_port, cs_pin: GPIO driven low for the device's transactions
+ *       bit_rate: SPI clock in Hz
+ *       mode: MIL_SPI_MODE_x
+ */
+typedef struct{
+
+    uint32_t cs_port;
+    uint8_t  cs_pin;
+    uint32_t bit_rate;
+    uint8_t  mode;
+
+}MIL_SPI_Dev;
+
+struct MIL_SPI_Xfer;
+
+/*
+ * Desc: called from the completion interrupt when a transaction is done
+ */
+typedef void (*MIL_SPI_DoneFn)(struct MIL_SPI_Xfer *pXfer);
+
+/*
+ * Desc: one transaction, fill in the first six fields
+ *
+ *       pTx: bytes to send, 0 sends 0xFF
+ *       pRx: where received bytes go, 0 throws them away
+ *       len: 1 to MIL_DMA_MAX_XFER
+ *       pDone: called when it finishes, or 0
+ *       pCtx: yours, for pDone
+ */
+typedef struct MIL_SPI_Xfer{
+
+    const MIL_SPI_Dev *pDev;
+    const uint8_t *pTx;
+    uint8_t *pRx;
+    uint16_t len;
+    MIL_SPI_DoneFn pDone;
+    void *pCtx;
+
+    //private
+    volatile uint8_t state;
+    struct MIL_SPI_Xfer *pNext;
+
+}MIL_SPI_Xfer;
+
+/*
+ * Desc: counters for one bus
+ *
+ *       xfers, bytes: completed
+ *       busy_ticks:   time from each transaction's start to its end, added up
+ *       queue_max:    most transactions waiting at once
+ *       overruns:     periodic ticks skipped because the last run wasn't done
+ *       rejected:     submits refused(already queued, or bad length)
+ */
+typedef struct{
+
+    uint32_t xfers;
+    uint32_t bytes;
+    uint32_t busy_ticks;
+    uint32_t queue_max;
+    uint32_t overruns;
+    uint32_t rejected;
+
+}MIL_SPIQ_Stats;
+
+/*
+ * Desc: one bus, all fields are private
+ */
+typedef struct{
+
+    MIL_SPI_Xfer *pHead;            //running, or next to run
+    MIL_SPI_Xfer *pTail;
+    uint32_t depth;
+
+    uint32_t bit_rate;              //what the bus is set up for, 0 before the first
+    uint8_t  mode;
+    uint32_t start;
+
+    MIL_SPIQ_Stats stats;
+
+}MIL_SPIQ;
+
+void MIL_SPIQ_Init(MIL_SPIQ *pQ);
+
+/*
+ * Desc: Adds a transaction to the end of the queue
+ *
+ * Parameters:
+ *       max_len: the most the hardware can move in one go
+ *
+ * Returns: true if it went straight to the front, start it now
+ *          with MIL_SPIQ_Started. False if it is waiting behind others
+ *          or was rejected(check its state)
+ */
+bool MIL_SPIQ_Push(MIL_SPIQ *pQ, MIL_SPI_Xfer *pXfer, uint16_t max_len);
+
+/*
+ * Desc: Pushes a periodic transaction, or counts an overrun if
+ *       its last run is still queued or running
+ *
+ *       It goes in right behind the running transaction instead of at
+ *       the back, so a sample read waits for at most one other transfer
+ *
+ * Returns: same as MIL_SPIQ_Push
+ */
+bool MIL_SPIQ_Periodic(MIL_SPIQ *pQ, MIL_SPI_Xfer *pXfer, uint16_t max_len);
+
+/*
+ * Desc: Marks the front transaction as running
+ *
+ * Returns: true if the bus has to be set up for its device first
+ *          (different bit rate or mode from the last transaction)
+ */
+bool MIL_SPIQ_Started(MIL_SPIQ *pQ, uint32_t now);
+
+/*
+ * Desc: Ends the running transaction
+ *
+ * Parameters:
+ *       ppNext: gets the next transaction to start, or 0 if the queue is empty
+ *
+ * Returns: the finished transaction(state MIL_SPI_DONE), call its pDone
+ *          AFTER starting the next one so the bus isn't kept waiting
+ */
+MIL_SPI_Xfer *MIL_SPIQ_Complete(MIL_SPIQ *pQ, uint32_t now, MIL_SPI_Xfer **ppNext);
+
+/*
+ * Desc: the running transaction, or 0
+ */
+MIL_SPI_Xfer *MIL_SPIQ_Active(const MIL_SPIQ *pQ);
+
+void MIL_SPIQ_StatsGet(const MIL_SPIQ *pQ, MIL_SPIQ_Stats *pStats);
+
+#endif /* MIL_SPIQ_H_ */
@@ -0,0 +1,145 @@
+/*
+ * Name: MIL_START
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Fast startup for MIL boards and a boot trace to
+ *       measure it
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_START.h"
+
+/*
+ * Desc: one boot trace entry
+ */
+typedef struct{
+
+    const char *pName;
+    uint32_t cycles;
+
+}StartMark;
+
+static StartMark MARKS[MIL_START_MAX_MARKS];
+static uint8_t num_marks;
+static uint32_t reset_cause;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//prints a number in decimal, no library needed
+static void OutUInt(uint32_t base, uint32_t value){
+
+    uint8_t digits[11];
+    int8_t i = 10;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (value % 10); value /= 10; }while(value);
+
+    MIL_UART_OutCString(base, &digits[i]);
+
+}
+
+static void OutResetCause(uint32_t base){
+
+    MIL_UART_OutCString(base, (uint8_t *)"reset:");
+
+    if(reset_cause & SYSCTL_CAUSE_POR){ MIL_UART_OutCString(base, (uint8_t *)" power-on"); }
+    if(reset_cause & SYSCTL_CAUSE_BOR){ MIL_UART_OutCString(base, (uint8_t *)" brownout"); }
+    if(reset_cause & SYSCTL_CAUSE_EXT){ MIL_UART_OutCString(base, (uint8_t *)" pin"); }
+    if(reset_cause & SYSCTL_CAUSE_WDOG0){ MIL_UART_OutCString(base, (uint8_t *)" watchdog"); }
+    if(reset_cause & SYSCTL_CAUSE_SW){ MIL_UART_OutCString(base, (uint8_t *)" software"); }
+
+    MIL_UART_OutCString(base, (uint8_t *)"\r\n");
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts the boot clock, saves the reset cause
+ *       and records the first mark
+ */
+void MIL_START_Begin(void){
+
+    MIL_TIME_Init();
+
+    num_marks = 0;
+
+    //the cause bits stick until cleared, clear them so the next reset reads true
+    reset_cause = SysCtlResetCauseGet();
+    SysCtlResetCauseClear(reset_cause);
+
+    MIL_START_Mark("main");
+
+}
+
+/*
+ * Desc: Enables every listed peripheral and UART clock at once,
+ *       waits for all of them together, then configures the UARTs
+ */
+void MIL_START_Init(const uint32_t *pPeriphs, uint8_t num_periphs,
+                    const MIL_START_UART *pUARTs, uint8_t num_uarts){
+
+    //open every clock gate first
+    for(uint8_t i = 0; i < num_periphs; i++){ SysCtlPeripheralEnable(pPeriphs[i]); }
+    for(uint8_t i = 0; i < num_uarts; i++){ MIL_UART_ClockEnable(pUARTs[i].base); }
+
+    //the gates open in parallel, by the time the first is ready the rest mostly are too
+    for(uint8_t i = 0; i < num_periphs; i++){ while(!SysCtlPeripheralReady(pPeriphs[i])); }
+    for(uint8_t i = 0; i < num_uarts; i++){ while(!MIL_UART_ClockReady(pUARTs[i].base)); }
+
+    MIL_START_Mark("clocks");
+
+    for(uint8_t i = 0; i < num_uarts; i++){ MIL_UART_Config(pUARTs[i].base, pUARTs[i].baud); }
+
+    MIL_START_Mark("uarts");
+
+}
+
+/*
+ * Desc: Records the current time under a name
+ */
+void MIL_START_Mark(const char *pName){
+
+    if(num_marks >= MIL_START_MAX_MARKS){ return; }
+
+    MARKS[num_marks].cycles = MIL_TIME_NOW();
+    MARKS[num_marks].pName = pName;
+    num_marks++;
+
+}
+
+/*
+ * Desc: Prints the reset cause and every mark in microseconds
+ *       since MIL_START_Begin, one per line
+ *
+ *       e.g.  main 0us
+ *             clocks 12us
+ */
+void MIL_START_TraceOut(uint32_t base){
+
+    OutResetCause(base);
+
+    for(uint8_t i = 0; i < num_marks; i++){
+
+        MIL_UART_OutCString(base, (uint8_t *)MARKS[i].pName);
+        MIL_UART_OutCString(base, (uint8_t *)" ");
+        OutUInt(base, MIL_TIME_ToUs(MARKS[i].cycles));
+        MIL_UART_OutCString(base, (uint8_t *)"us\r\n");
+
+    }
+
+}
+
+/*
+ * Desc: The reset cause saved by MIL_START_Begin
+ */
+uint32_t MIL_START_ResetCause(void){
+
+    return reset_cause;
+
+}
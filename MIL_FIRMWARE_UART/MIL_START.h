@@ -0,0 +1,101 @@
+/*
+ * Name: MIL_START
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Fast startup for MIL boards and a boot trace to
+ *       measure it
+ *
+ * What to understand: Every peripheral has a clock gate that takes a few
+ *                     cycles to open after SysCtlPeripheralEnable. The usual
+ *                     enable, wait, configure, enable, wait, configure pattern
+ *                     pays that wait once per peripheral. MIL_START_Init opens
+ *                     every gate first and waits for all of them together,
+ *                     so the waits overlap and are only paid once
+ *
+ *                     MIL_START_Mark saves a timestamp with a name, after
+ *                     startup MIL_START_TraceOut prints them so you can see
+ *                     exactly where boot time goes. The most important number
+ *                     is how long until the first telemetry byte goes out
+ *
+ * Timing Note:
+ *      Times are measured from MIL_START_Begin, which should be the very
+ *      first line of main. The C startup code that runs before main(zeroing
+ *      RAM) is not included
+ *
+ * Usage:
+ *      static const uint32_t PERIPHS[] = {SYSCTL_PERIPH_GPIOF};
+ *      static const MIL_START_UART UARTS[] = {{UART1_BASE, MIL_DEFAULT_BAUD_115K}};
+ *
+ *      MIL_START_Begin();
+ *      MIL_ClkSetInt_16MHz();
+ *      MIL_START_Init(PERIPHS, 1, UARTS, 1);
+ *      ...send first telemetry...
+ *      MIL_START_Mark("first tx");
+ *      MIL_START_TraceOut(UART1_BASE);
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_START_H_
+#define MIL_START_H_
+
+//most marks kept, extra marks are ignored
+#define MIL_START_MAX_MARKS 16
+
+/*
+ * Desc: a UART to bring up in MIL_START_Init
+ */
+typedef struct{
+
+    uint32_t base;
+    uint32_t baud;
+
+}MIL_START_UART;
+
+/*
+ * Desc: Starts the boot clock(see MIL_TIME), saves the reset
+ *       cause and records the first mark. First line of main
+ */
+void MIL_START_Begin(void);
+
+/*
+ * Desc: Enables every listed peripheral and UART clock at once,
+ *       waits for all of them together, then configures the UARTs
+ *       (same settings as MIL_InitUART)
+ *
+ *       Only the UARTs in the list are touched
+ *
+ * Parameters:
+ *       pPeriphs: SYSCTL_PERIPH_x values for everything else you use(GPIO ports, timers)
+ *       num_periphs: entries in pPeriphs(0 is fine)
+ *       pUARTs: UARTs to bring up
+ *       num_uarts: entries in pUARTs(0 is fine)
+ */
+void MIL_START_Init(const uint32_t *pPeriphs, uint8_t num_periphs,
+                    const MIL_START_UART *pUARTs, uint8_t num_uarts);
+
+/*
+ * Desc: Records the current time under a name
+ *
+ * Parameters:
+ *       pName: a string literal, only the pointer is saved
+ */
+void MIL_START_Mark(const char *pName);
+
+/*
+ * Desc: Prints the reset cause and every mark in microseconds
+ *       since MIL_START_Begin, one per line
+ *
+ * Parameters:
+ *       base: UART to print on(must already be initialized)
+ */
+void MIL_START_TraceOut(uint32_t base);
+
+/*
+ * Desc: The reset cause saved by MIL_START_Begin
+ *       (SYSCTL_CAUSE_x bits, SYSCTL_CAUSE_BOR for a brownout)
+ */
+uint32_t MIL_START_ResetCause(void);
+
+#endif /* MIL_START_H_ */
@@ -0,0 +1,251 @@
+/*
+ * Name: MIL_STAT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Live counters from every MIL driver, read over a UART
+ *
+ * Implementation Notes:
+ *       Sources are a linked list through the drivers' own MIL_STAT_Src
+ *       entries, added at the end so ids follow the order drivers were
+ *       started in and stay the same between a LIST and later READs
+ *
+ *       Registering and polling both happen in the main loop, ISRs never
+ *       touch the list. Fill functions only read counters
+ *
+ *       A reply is built whole into REPLY and then sent a FIFO's worth at
+ *       a time. Requests that come in meanwhile wait in the RX FIFO, the
+ *       PC only sends one at a time
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_TIME.h"
+#include "MIL_CRC.h"
+#include "MIL_UART.h"
+#include "MIL_STAT.h"
+
+#define NUM_UARTS 8
+
+/************************STATE******************************/
+
+static MIL_STAT_Src *pFirst;
+static MIL_STAT_Src *pLast;
+
+static uint32_t STAT_BASE;
+
+static uint8_t REQ[MIL_STAT_REQ_LEN];
+static uint8_t req_len;
+
+static uint8_t REPLY[MIL_STAT_REPLY_LEN];
+static uint16_t reply_len;
+static uint16_t reply_pos;
+
+//MIL_UART ports, MIL_STAT_RegisterUART
+static MIL_STAT_Src UART_SRC[NUM_UARTS];
+
+static const char * const UART_NAME[NUM_UARTS] = {
+
+    "UART0", "UART1", "UART2", "UART3",
+    "UART4", "UART5", "UART6", "UART7"
+
+};
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static uint8_t *PutU32(uint8_t *p, uint32_t value){
+
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+
+    return p + 4;
+
+}
+
+static uint8_t *List(uint8_t *p){
+
+    uint8_t *pCount;
+    uint8_t id = 0;
+
+    p = PutU32(p, SysCtlClockGet());
+    pCount = p++;
+
+    for(MIL_STAT_Src *pS = pFirst; pS && id < MIL_STAT_MAX; pS = pS->pNext, id++){
+
+        uint8_t len = 0;
+        while(pS->pName[len] && len < MIL_STAT_NAME_MAX){ len++; }
+
+        *p++ = id;
+        *p++ = len;
+        memcpy(p, pS->pName, len);
+        p += len;
+
+    }
+
+    *pCount = id;
+
+    return p;
+
+}
+
+static uint8_t *Read(uint8_t *p){
+
+    uint8_t *pCount;
+    uint8_t id = 0;
+
+    p = PutU32(p, MIL_TIME_NOW());
+    pCount = p++;
+
+    for(MIL_STAT_Src *pS = pFirst; pS && id < MIL_STAT_MAX; pS = pS->pNext, id++){
+
+        MIL_STAT_Counters c = {0};
+        pS->pFill(pS->pCtx, &c);
+
+        *p++ = id;
+        p = PutU32(p, c.isr);
+        p = PutU32(p, c.rx_bytes);
+        p = PutU32(p, c.tx_bytes);
+        p = PutU32(p, c.overruns);
+        p = PutU32(p, c.errors);
+        p = PutU32(p, c.dropped);
+        p = PutU32(p, c.fifo_high);
+
+    }
+
+    *pCount = id;
+
+    return p;
+
+}
+
+//pCtx is the port's UART_SRC entry, UARTx_BASE are 4KB apart
+static void UartFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    uint32_t index = (uint32_t)((MIL_STAT_Src *)pCtx - UART_SRC);
+    MIL_UART_Stats stats;
+
+    MIL_UART_StatsGet(UART0_BASE + (index << 12), &stats);
+
+    pC->rx_bytes = stats.rx_bytes;
+    pC->tx_bytes = stats.tx_bytes;
+    pC->overruns = stats.overruns;
+    pC->errors = stats.errors;
+
+}
+
+//an unknown command gets an empty reply so the PC isn't left waiting
+static void Build(uint8_t cmd, uint8_t seq){
+
+    uint8_t *p = &REPLY[MIL_STAT_HEADER_LEN];
+
+    if(cmd == MIL_STAT_CMD_LIST){ p = List(p); }
+    else if(cmd == MIL_STAT_CMD_READ){ p = Read(p); }
+
+    uint16_t len = (uint16_t)(p - &REPLY[MIL_STAT_HEADER_LEN]);
+
+    REPLY[0] = MIL_STAT_SOF;
+    REPLY[1] = cmd;
+    REPLY[2] = seq;
+    REPLY[3] = (uint8_t)len;
+    REPLY[4] = (uint8_t)(len >> 8);
+
+    p = PutU32(p, MIL_CRC32(MIL_CRC32_INIT, REPLY, (uint32_t)(p - REPLY)));
+
+    reply_len = (uint16_t)(p - REPLY);
+    reply_pos = 0;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_STAT_Register(MIL_STAT_Src *pSrc, const char *pName, MIL_STAT_FillFn pFill, void *pCtx){
+
+    pSrc->pName = pName;
+    pSrc->pFill = pFill;
+    pSrc->pCtx = pCtx;
+
+    for(MIL_STAT_Src *pS = pFirst; pS; pS = pS->pNext){
+
+        if(pS == pSrc){ return; }
+
+    }
+
+    pSrc->pNext = 0;
+
+    if(pLast){ pLast->pNext = pSrc; }
+    else{ pFirst = pSrc; }
+
+    pLast = pSrc;
+
+}
+
+void MIL_STAT_RegisterUART(uint32_t base){
+
+    uint32_t index = (base - UART0_BASE) >> 12;
+
+    if(index >= NUM_UARTS || base != UART0_BASE + (index << 12)){ return; }
+
+    MIL_STAT_Register(&UART_SRC[index], UART_NAME[index], UartFill, &UART_SRC[index]);
+
+}
+
+void MIL_STAT_Init(uint32_t base){
+
+    STAT_BASE = base;
+    req_len = 0;
+    reply_len = 0;
+    reply_pos = 0;
+
+}
+
+void MIL_STAT_Poll(void){
+
+    if(!STAT_BASE){ return; }
+
+    //one request at a time, the next waits until this reply is out
+    while(reply_pos == reply_len && UARTCharsAvail(STAT_BASE)){
+
+        uint8_t b = (uint8_t)UARTCharGetNonBlocking(STAT_BASE);
+
+        if(req_len == 0 && b != MIL_STAT_SOF){ continue; }
+
+        REQ[req_len++] = b;
+        if(req_len < MIL_STAT_REQ_LEN){ continue; }
+
+        req_len = 0;
+
+        if((REQ[0] ^ REQ[1] ^ REQ[2]) == REQ[3]){ Build(REQ[1], REQ[2]); }
+
+    }
+
+    while(reply_pos < reply_len && UARTSpaceAvail(STAT_BASE)){
+
+        UARTCharPutNonBlocking(STAT_BASE, REPLY[reply_pos++]);
+
+    }
+
+}
+
+bool MIL_STAT_Get(const char *pName, MIL_STAT_Counters *pC){
+
+    for(MIL_STAT_Src *pS = pFirst; pS; pS = pS->pNext){
+
+        if(strcmp(pS->pName, pName) == 0){
+
+            *pC = (MIL_STAT_Counters){0};
+            pS->pFill(pS->pCtx, pC);
+
+            return true;
+
+        }
+
+    }
+
+    return false;
+
+}
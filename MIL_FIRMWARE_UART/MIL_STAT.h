@@ -0,0 +1,186 @@
+/*
+ * Name: MIL_STAT
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Live counters from every MIL driver, read over a UART
+ *       while the board runs
+ *
+ * What to understand: Each driver already counts what its ISRs do(bytes
+ *                     moved, bytes lost, errors) in its own variables. The
+ *                     ISR only ever adds to a counter, so counting costs a
+ *                     load, an add and a store and needs no lock
+ *
+ *                     At Init each driver instance registers itself here
+ *                     with a name and a fill function that copies its
+ *                     counters into the common MIL_STAT_Counters shape.
+ *                     Nothing is copied until somebody asks
+ *
+ *                     MIL_STAT_Poll answers requests from the PC on one
+ *                     UART. tools/mil_stat.py asks every so often and
+ *                     turns the counters into rates(bytes/s, errors/s,
+ *                     ISRs/s) as a table or a live plot
+ *
+ *                     A snapshot is not taken all at once, an ISR can add
+ *                     to one counter while another is being copied. Over
+ *                     a poll interval that doesn't matter for a rate
+ *
+ * What Each Driver Counts:
+ *      LINK, RS485, RXTS: UART RX and TX, errors from the UART's flags
+ *      SHELL:             the same for the shell's UART, dropped lines and
+ *                         replies as dropped
+ *      UARTx:             bytes through the MIL_UART_Char functions(polled
+ *                         code) and their error flags, see below
+ *      UARTQx:            TX only(RX belongs to the caller's ISR)
+ *      SUARTx:            bytes, stop bit errors, every edge and bit ISR
+ *      SPIx:              bytes each way, missed periodic reads as overruns
+ *      PATTERNx:          steps as tx bytes, underruns as overruns
+ *
+ * Config Note:
+ *      With MIL_STAT_EN set to 0 in MIL_CONFIG.h drivers don't register,
+ *      their own counters and StatsGet functions still work
+ *
+ * Wire Protocol(all values little endian):
+ *      Request(PC -> board, 4 bytes):
+ *          [SOF][cmd][seq][SOF ^ cmd ^ seq]
+ *
+ *      Reply(board -> PC):
+ *          [SOF][cmd][seq][len u16][payload, len bytes][crc u32]
+ *          crc is MIL_CRC32 of everything before it
+ *
+ *      LIST payload: [clock_hz u32][count u8] then count times [id u8][name_len u8][name]
+ *      READ payload: [MIL_TIME u32][count u8] then count times [id u8][7 counters u32]
+ *                    counters in MIL_STAT_Counters order
+ *
+ * Usage:
+ *      MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_STAT_Init(UART0_BASE);
+ *      ...the drivers' Init functions register them...
+ *      MIL_STAT_RegisterUART(UART1_BASE);     (a UART used through MIL_UART_Char)
+ *
+ *      while(1){ ... MIL_STAT_Poll(); }
+ *
+ *      python tools/mil_stat.py COM5
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_STAT_H_
+#define MIL_STAT_H_
+
+//most sources a reply carries, later ones are left out
+#ifndef MIL_STAT_MAX
+#define MIL_STAT_MAX 16
+#endif
+
+#define MIL_STAT_SOF 0xA6
+
+#define MIL_STAT_REQ_LEN    4
+#define MIL_STAT_HEADER_LEN 5
+#define MIL_STAT_CRC_LEN    4
+
+//commands
+#define MIL_STAT_CMD_LIST 0x01  //names of everything registered and the clock
+#define MIL_STAT_CMD_READ 0x02  //every source's counters, stamped with MIL_TIME
+
+#define MIL_STAT_NAME_MAX 15
+#define MIL_STAT_FIELDS   7
+
+//longest reply, a READ with MIL_STAT_MAX sources
+#define MIL_STAT_REPLY_LEN (MIL_STAT_HEADER_LEN + 5 + MIL_STAT_MAX * (1 + 4 * MIL_STAT_FIELDS) + MIL_STAT_CRC_LEN)
+
+/*
+ * Desc: what every driver reports, a driver leaves 0 in
+ *       anything it has no way to count
+ *
+ *       isr:       times its ISRs ran
+ *       rx_bytes:  bytes received
+ *       tx_bytes:  bytes sent
+ *       overruns:  bytes the hardware lost(UART overrun), or deadlines
+ *                  missed(SPI periodic reads, pattern underruns)
+ *       errors:    bytes received damaged(framing, parity, break)
+ *       dropped:   bytes lost because the software buffer was full
+ *       fifo_high: most bytes taken from the RX FIFO in one ISR,
+ *                  16 means the FIFO was full and bytes were at risk
+ */
+typedef struct{
+
+    uint32_t isr;
+    uint32_t rx_bytes;
+    uint32_t tx_bytes;
+    uint32_t overruns;
+    uint32_t errors;
+    uint32_t dropped;
+    uint32_t fifo_high;
+
+}MIL_STAT_Counters;
+
+/*
+ * Desc: copies a driver instance's counters out, called from
+ *       MIL_STAT_Poll in the main loop
+ */
+typedef void (*MIL_STAT_FillFn)(void *pCtx, MIL_STAT_Counters *pC);
+
+/*
+ * Desc: one registered driver instance, all fields are private
+ */
+typedef struct MIL_STAT_Src{
+
+    const char *pName;
+    MIL_STAT_FillFn pFill;
+    void *pCtx;
+    struct MIL_STAT_Src *pNext;
+
+}MIL_STAT_Src;
+
+//raises a high water mark, for the driver's ISR
+#define MIL_STAT_HIGH(mark, n) do{ if((n) > (mark)){ (mark) = (n); } }while(0)
+
+/*
+ * Desc: Adds a driver instance, drivers call this from their Init.
+ *       Registering the same pSrc again only updates it
+ *
+ * Parameters:
+ *       pSrc: storage for the entry, lives in the driver
+ *       pName: up to MIL_STAT_NAME_MAX characters, must stay valid
+ *       pFill: copies the counters out
+ *       pCtx: passed back to pFill
+ */
+void MIL_STAT_Register(MIL_STAT_Src *pSrc, const char *pName, MIL_STAT_FillFn pFill, void *pCtx);
+
+/*
+ * Desc: Adds a hardware UART's MIL_UART counters as "UARTx". MIL_UART is
+ *       in every project so it doesn't register itself, that would make
+ *       MIL_STAT.c part of every project too
+ *
+ * Parameters:
+ *       base: UARTx_BASE
+ */
+void MIL_STAT_RegisterUART(uint32_t base);
+
+/*
+ * Desc: Answers requests on a hardware UART, call after the UART
+ *       is set up with MIL_InitUART. The UART shouldn't carry
+ *       anything else
+ *
+ * Parameters:
+ *       base: UARTx_BASE
+ */
+void MIL_STAT_Init(uint32_t base);
+
+/*
+ * Desc: Reads requests and sends replies, as many bytes as the TX
+ *       FIFO takes without waiting. Call every main loop pass
+ */
+void MIL_STAT_Poll(void);
+
+/*
+ * Desc: copies out one source's counters
+ *
+ * Returns: false if nothing is registered under pName
+ */
+bool MIL_STAT_Get(const char *pName, MIL_STAT_Counters *pC);
+
+#endif /* MIL_STAT_H_ */
@@ -0,0 +1,564 @@
+/*
+ * Name: MIL_SUART
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Software UART on GPIO pins
+ *
+ * Implementation Notes:
+ *       TX runs its timer half periodic at the bit time, so bits are evenly
+ *       spaced whatever the ISR latency. The ISR writes the level it worked
+ *       out last time FIRST, then works out the next one, so the pin changes
+ *       a fixed number of cycles after each timeout
+ *
+ *       The stop bit is written at a timeout like any other bit, so the
+ *       byte is only out at the NEXT timeout. With nothing queued the
+ *       timer runs one more time to hold the stop bit before it stops,
+ *       otherwise the next CharPut's start bit would cut it short
+ *
+ *       RX runs its timer half one shot. The edge ISR stamps the start bit
+ *       with MIL_TIME and every sample is scheduled against that stamp
+ *       (stamp + 0.5, 1.5 ... 9.5 bits), so late ISRs never add up over
+ *       the byte. The 0.5 sample checks the start bit is still low, which
+ *       throws out noise spikes
+ *
+ *       The edge interrupt is off from the start bit until the stop bit is
+ *       sampled, data bits going low don't count as start bits
+ *
+ *       Both rings are single writer single reader, no locks needed
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_SUART.h"
+#include "MIL_STAT.h"
+
+#define BUF_MASK (MIL_SUART_BUF_LEN - 1)
+
+//cycles from the edge to the MIL_TIME read in the edge ISR
+#define EDGE_ENTRY_CYCLES 20
+
+//cycles from loading the one shot to its ISR reading the pin
+#define ARM_CYCLES 40
+
+//shortest one shot that still fires after TimerEnable returns
+#define MIN_ARM_CYCLES 20
+
+//RX sample numbers
+#define SAMPLE_START 0
+#define SAMPLE_STOP  9
+
+/************************PIN MAP******************************/
+
+typedef struct{
+
+    uint32_t rx_periph;
+    uint32_t rx_port;
+    uint8_t  rx_pin;
+    uint32_t rx_int;
+
+    uint32_t tx_periph;
+    uint32_t tx_port;
+    uint8_t  tx_pin;
+
+    uint32_t timer_periph;
+    uint32_t timer;
+    uint32_t timer_int_a;
+    uint32_t timer_int_b;
+
+}SuartPins;
+
+static const SuartPins PINS[MIL_SUART_NUM_PORTS] = {
+
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_2, INT_GPIOE,
+     SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_3,
+     SYSCTL_PERIPH_WTIMER0, WTIMER0_BASE, INT_WTIMER0A, INT_WTIMER0B},
+
+    {SYSCTL_PERIPH_GPIOA, GPIO_PORTA_BASE, GPIO_PIN_6, INT_GPIOA,
+     SYSCTL_PERIPH_GPIOA, GPIO_PORTA_BASE, GPIO_PIN_7,
+     SYSCTL_PERIPH_WTIMER1, WTIMER1_BASE, INT_WTIMER1A, INT_WTIMER1B}
+
+};
+
+/************************STATE******************************/
+
+typedef struct{
+
+    const SuartPins *pPins;
+    uint32_t bit_cycles;
+
+    //TX, main loop writes head, ISR reads tail
+    uint8_t  tx_buf[MIL_SUART_BUF_LEN];
+    volatile uint16_t tx_head;
+    volatile uint16_t tx_tail;
+    volatile bool tx_running;
+    bool     tx_stop;           //a stop bit is on the pin until the next timeout
+    uint16_t tx_frame;          //start, data and stop bits still to send, LSB next
+    uint8_t  tx_level;          //pin value for the next timeout
+
+    //RX, ISR writes head, main loop reads tail
+    uint8_t  rx_buf[MIL_SUART_BUF_LEN];
+    volatile uint16_t rx_head;
+    volatile uint16_t rx_tail;
+    uint32_t rx_next;           //MIL_TIME of the next sample
+    uint8_t  rx_sample;
+    uint8_t  rx_data;
+
+    void (*pISR)(void);
+    uint32_t int_flags;
+
+    volatile MIL_SUART_Stats stats;
+    volatile uint32_t isr_count;
+
+#if MIL_STAT_EN
+    MIL_STAT_Src stat;
+#endif
+
+}SuartState;
+
+static SuartState SUART[MIL_SUART_NUM_PORTS];
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static SuartState *PortGet(uint32_t base){
+
+    if(!MIL_SUART_IS_SOFT(base) || (base & 0xFFFF) >= MIL_SUART_NUM_PORTS){ return 0; }
+
+    return &SUART[base & 0xFFFF];
+
+}
+
+//runs the RX one shot so its ISR lands at MIL_TIME when
+static void Arm(const SuartPins *pP, uint32_t when){
+
+    int32_t delay = (int32_t)(when - MIL_TIME_NOW()) - ARM_CYCLES;
+    if(delay < MIN_ARM_CYCLES){ delay = MIN_ARM_CYCLES; }
+
+    TimerLoadSet(pP->timer, TIMER_B, (uint32_t)delay);
+    TimerEnable(pP->timer, TIMER_B);
+
+}
+
+//start bit, 8 data bits, stop bit as a shift register
+static uint16_t Frame(uint8_t data){
+
+    return (uint16_t)(((uint16_t)data << 1) | 0x200);
+
+}
+
+static void TxISR(SuartState *pS){
+
+    uint32_t start = MIL_TIME_NOW();
+    const SuartPins *pP = pS->pPins;
+
+    //pin first, everything else after, so the edge time doesn't wander
+    GPIOPinWrite(pP->tx_port, pP->tx_pin, pS->tx_level ? pP->tx_pin : 0);
+
+    TimerIntClear(pP->timer, TIMER_TIMA_TIMEOUT);
+    pS->isr_count++;
+
+    //a whole bit time of stop bit just ended, the byte is out
+    bool stop_ended = pS->tx_stop;
+
+    if(stop_ended){
+
+        pS->tx_stop = false;
+        pS->stats.tx_bytes++;
+        if(pS->pISR && (pS->int_flags & MIL_TX_INT_EN)){ pS->pISR(); }
+
+    }
+
+    if(pS->tx_frame == 0){
+
+        //otherwise the stop bit was only written just now
+        if(!stop_ended){ pS->tx_stop = true; }
+
+        uint16_t tail = pS->tx_tail;
+
+        if(tail == pS->tx_head){
+
+            if(stop_ended){
+
+                TimerDisable(pP->timer, TIMER_A);
+                pS->tx_running = false;
+
+            }
+            else{
+
+                //one more timeout to hold the stop bit
+                pS->tx_level = 1;
+
+            }
+
+            pS->stats.isr_cycles += MIL_TIME_NOW() - start;
+            return;
+
+        }
+
+        pS->tx_frame = Frame(pS->tx_buf[tail & BUF_MASK]);
+        pS->tx_tail = tail + 1;
+
+    }
+
+    pS->tx_level = pS->tx_frame & 1;
+    pS->tx_frame >>= 1;
+
+    pS->stats.isr_cycles += MIL_TIME_NOW() - start;
+
+}
+
+static void EdgeISR(SuartState *pS){
+
+    //stamp the start bit before anything else
+    uint32_t start = MIL_TIME_NOW();
+    const SuartPins *pP = pS->pPins;
+
+    GPIOIntClear(pP->rx_port, pP->rx_pin);
+    GPIOIntDisable(pP->rx_port, pP->rx_pin);
+    pS->isr_count++;
+
+    pS->rx_sample = SAMPLE_START;
+    pS->rx_data = 0;
+    pS->rx_next = start - EDGE_ENTRY_CYCLES + pS->bit_cycles / 2;
+
+    Arm(pP, pS->rx_next);
+
+    pS->stats.isr_cycles += MIL_TIME_NOW() - start;
+
+}
+
+static void RxDone(SuartState *pS){
+
+    const SuartPins *pP = pS->pPins;
+
+    //edges latched during the data bits are not start bits
+    GPIOIntClear(pP->rx_port, pP->rx_pin);
+    GPIOIntEnable(pP->rx_port, pP->rx_pin);
+
+}
+
+static void RxISR(SuartState *pS){
+
+    uint32_t start = MIL_TIME_NOW();
+    const SuartPins *pP = pS->pPins;
+
+    bool high = GPIOPinRead(pP->rx_port, pP->rx_pin) != 0;
+
+    TimerIntClear(pP->timer, TIMER_TIMB_TIMEOUT);
+    pS->isr_count++;
+
+    uint8_t sample = pS->rx_sample++;
+
+    if(sample == SAMPLE_START){
+
+        if(high){ pS->stats.glitches++; RxDone(pS); goto done; }
+
+    }
+    else if(sample < SAMPLE_STOP){
+
+        pS->rx_data = (uint8_t)((pS->rx_data >> 1) | (high ? 0x80 : 0));
+
+    }
+    else{
+
+        RxDone(pS);
+
+        if(!high){ pS->stats.framing_errors++; goto done; }
+
+        uint16_t head = pS->rx_head;
+
+        if((uint16_t)(head - pS->rx_tail) >= MIL_SUART_BUF_LEN){ pS->stats.rx_dropped++; goto done; }
+
+        pS->rx_buf[head & BUF_MASK] = pS->rx_data;
+        pS->rx_head = head + 1;
+        pS->stats.rx_bytes++;
+
+        if(pS->pISR && (pS->int_flags & MIL_RX_INT_EN)){ pS->pISR(); }
+
+        goto done;
+
+    }
+
+    pS->rx_next += pS->bit_cycles;
+    Arm(pP, pS->rx_next);
+
+done:
+    pS->stats.isr_cycles += MIL_TIME_NOW() - start;
+
+}
+
+//GPIOIntRegister and TimerIntRegister take plain functions, so one set per port
+static void Suart0Tx(void){ TxISR(&SUART[0]); }
+static void Suart0Rx(void){ RxISR(&SUART[0]); }
+static void Suart0Edge(void){ EdgeISR(&SUART[0]); }
+static void Suart1Tx(void){ TxISR(&SUART[1]); }
+static void Suart1Rx(void){ RxISR(&SUART[1]); }
+static void Suart1Edge(void){ EdgeISR(&SUART[1]); }
+
+static void (* const TX_ISR[MIL_SUART_NUM_PORTS])(void) = {Suart0Tx, Suart1Tx};
+static void (* const RX_ISR[MIL_SUART_NUM_PORTS])(void) = {Suart0Rx, Suart1Rx};
+static void (* const EDGE_ISR[MIL_SUART_NUM_PORTS])(void) = {Suart0Edge, Suart1Edge};
+
+#if MIL_STAT_EN
+
+static const char * const STAT_NAME[MIL_SUART_NUM_PORTS] = {"SUART0", "SUART1"};
+
+//a byte is 10 bit ISRs plus an edge, so isr runs about 11 times rx_bytes
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    SuartState *pS = (SuartState *)pCtx;
+
+    pC->isr = pS->isr_count;
+    pC->rx_bytes = pS->stats.rx_bytes;
+    pC->tx_bytes = pS->stats.tx_bytes;
+    pC->errors = pS->stats.framing_errors;
+    pC->dropped = pS->stats.rx_dropped;
+
+}
+
+#endif
+
+#if MIL_UART_SOFT_EN
+
+static const MIL_UART_SoftOps SOFT_OPS = {
+
+    MIL_SUART_ClockEnable,
+    MIL_SUART_ClockReady,
+    MIL_SUART_Config,
+    MIL_SUART_ISRSet,
+    MIL_SUART_ISRPrioritySet,
+    MIL_SUART_CharPut,
+    MIL_SUART_CharGetNonBlocking,
+    MIL_SUART_CharsAvail
+
+};
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_SUART_Init(void){
+
+#if MIL_UART_SOFT_EN
+    MIL_UART_SoftRegister(&SOFT_OPS);
+#endif
+
+}
+
+void MIL_SUART_ClockEnable(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return; }
+
+    const SuartPins *pP = &PINS[base & 0xFFFF];
+
+    SysCtlPeripheralEnable(pP->rx_periph);
+    SysCtlPeripheralEnable(pP->tx_periph);
+    SysCtlPeripheralEnable(pP->timer_periph);
+
+}
+
+bool MIL_SUART_ClockReady(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return false; }
+
+    const SuartPins *pP = &PINS[base & 0xFFFF];
+
+    return SysCtlPeripheralReady(pP->rx_periph) && SysCtlPeripheralReady(pP->tx_periph) &&
+           SysCtlPeripheralReady(pP->timer_periph);
+
+}
+
+void MIL_SUART_Config(uint32_t base, uint32_t baud_rate){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return; }
+
+    uint8_t port = base & 0xFFFF;
+    const SuartPins *pP = &PINS[port];
+
+    pS->pPins = pP;
+    pS->bit_cycles = (SysCtlClockGet() + baud_rate / 2) / baud_rate;
+    pS->tx_head = 0;
+    pS->tx_tail = 0;
+    pS->tx_running = false;
+    pS->tx_stop = false;
+    pS->rx_head = 0;
+    pS->rx_tail = 0;
+    pS->pISR = 0;
+    pS->int_flags = 0;
+    pS->isr_count = 0;
+    MIL_SUART_StatsReset(base);
+
+    //TX idles high
+    GPIOPinTypeGPIOOutput(pP->tx_port, pP->tx_pin);
+    GPIOPinWrite(pP->tx_port, pP->tx_pin, pP->tx_pin);
+
+    //pull up so an unplugged RX reads idle instead of a stream of start bits
+    GPIOPinTypeGPIOInput(pP->rx_port, pP->rx_pin);
+    GPIOPadConfigSet(pP->rx_port, pP->rx_pin, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+    TimerConfigure(pP->timer, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC | TIMER_CFG_B_ONE_SHOT);
+    TimerLoadSet(pP->timer, TIMER_A, pS->bit_cycles - 1);
+
+    TimerIntRegister(pP->timer, TIMER_A, TX_ISR[port]);
+    TimerIntRegister(pP->timer, TIMER_B, RX_ISR[port]);
+    TimerIntEnable(pP->timer, TIMER_TIMA_TIMEOUT | TIMER_TIMB_TIMEOUT);
+
+    GPIOIntTypeSet(pP->rx_port, pP->rx_pin, GPIO_FALLING_EDGE);
+    GPIOIntRegister(pP->rx_port, EDGE_ISR[port]);
+
+    //bit timing is the whole job, sit with the timers in the MIL plan
+    MIL_SUART_ISRPrioritySet(base, MIL_INT_PRI_TIMER);
+
+    RxDone(pS);
+
+#if MIL_STAT_EN
+    MIL_STAT_Register(&pS->stat, STAT_NAME[port], StatFill, pS);
+#endif
+
+}
+
+void MIL_SUART_ISRSet(uint32_t base, uint32_t int_flags, void (*pISR)(void)){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    pS->pISR = pISR;
+    pS->int_flags = int_flags;
+
+    MIL_INT_Exit(key);
+
+}
+
+void MIL_SUART_ISRPrioritySet(uint32_t base, uint8_t priority){
+
+    SuartState *pS = PortGet(base);
+    if(!pS || !pS->pPins){ return; }
+
+    MIL_INT_PrioritySet(pS->pPins->rx_int, priority);
+    MIL_INT_PrioritySet(pS->pPins->timer_int_a, priority);
+    MIL_INT_PrioritySet(pS->pPins->timer_int_b, priority);
+
+}
+
+/*
+ * Desc: Queues a byte, waits while the TX buffer is full
+ */
+void MIL_SUART_CharPut(uint32_t base, uint8_t data){
+
+    SuartState *pS = PortGet(base);
+    if(!pS || !pS->pPins){ return; }
+
+    uint16_t head = pS->tx_head;
+
+    while((uint16_t)(head - pS->tx_tail) >= MIL_SUART_BUF_LEN);
+
+    pS->tx_buf[head & BUF_MASK] = data;
+    pS->tx_head = head + 1;
+
+    if(pS->tx_running){ return; }
+
+    const SuartPins *pP = pS->pPins;
+    uint32_t key = MIL_INT_Enter();
+
+    //an idle line, start the first frame by hand
+    if(!pS->tx_running){
+
+        uint16_t tail = pS->tx_tail;
+        uint16_t frame = Frame(pS->tx_buf[tail & BUF_MASK]);
+        pS->tx_tail = tail + 1;
+
+        //start bit now, the first timeout writes data bit 0
+        GPIOPinWrite(pP->tx_port, pP->tx_pin, 0);
+        frame >>= 1;
+        pS->tx_level = frame & 1;
+        pS->tx_frame = frame >> 1;
+
+        pS->tx_running = true;
+        TimerLoadSet(pP->timer, TIMER_A, pS->bit_cycles - 1);
+        TimerEnable(pP->timer, TIMER_A);
+
+    }
+
+    MIL_INT_Exit(key);
+
+}
+
+/*
+ * Desc: Takes a received byte
+ */
+int32_t MIL_SUART_CharGetNonBlocking(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return -1; }
+
+    uint16_t tail = pS->rx_tail;
+
+    if(tail == pS->rx_head){ return -1; }
+
+    uint8_t data = pS->rx_buf[tail & BUF_MASK];
+
+    //byte is copied out before the ISR can reuse it
+    pS->rx_tail = tail + 1;
+
+    return data;
+
+}
+
+bool MIL_SUART_CharsAvail(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+
+    return pS && pS->rx_tail != pS->rx_head;
+
+}
+
+bool MIL_SUART_Busy(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+
+    return pS && pS->tx_running;
+
+}
+
+void MIL_SUART_StatsGet(uint32_t base, MIL_SUART_Stats *pStats){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    *pStats = *(MIL_SUART_Stats *)&pS->stats;
+
+    MIL_INT_Exit(key);
+
+}
+
+void MIL_SUART_StatsReset(uint32_t base){
+
+    SuartState *pS = PortGet(base);
+    if(!pS){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    pS->stats.rx_bytes = 0;
+    pS->stats.tx_bytes = 0;
+    pS->stats.framing_errors = 0;
+    pS->stats.glitches = 0;
+    pS->stats.rx_dropped = 0;
+    pS->stats.isr_cycles = 0;
+
+    MIL_INT_Exit(key);
+
+}
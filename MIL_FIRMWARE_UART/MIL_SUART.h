@@ -0,0 +1,167 @@
+/*
+ * Name: MIL_SUART
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Software UART, extra serial ports on plain GPIO pins
+ *       driven by a timer interrupt
+ *
+ * What to understand: A UART is just a pin going low for a start bit,
+ *                     then 8 data bits, then high for a stop bit, each
+ *                     held for one bit time. Without UART hardware the
+ *                     CPU does it in interrupts:
+ *
+ *                        TX: a timer fires every bit time and the ISR
+ *                            writes the next bit to the pin
+ *
+ *                        RX: the falling edge of the start bit interrupts,
+ *                            then a timer fires in the MIDDLE of each bit
+ *                            (1.5, 2.5 ... bit times after the edge) and the
+ *                            ISR reads the pin. The middle is where the bit
+ *                            is most stable, so clock mismatch and ISR latency
+ *                            have half a bit of room either way
+ *
+ *                     Every bit is an interrupt, so these ports cost CPU
+ *                     time that the hardware UARTs don't. Use a hardware
+ *                     UART first and these when you run out
+ *
+ * Same API Note:
+ *      Each port has a base like the hardware UARTs(MIL_SUART0_BASE ...).
+ *      MIL_InitUART, MIL_UART_OutArray, MIL_UART_OutCString, MIL_UART_InitISR
+ *      and the MIL_UART_Char functions all take these bases too, so code
+ *      written against MIL_UART works on either kind of port unchanged.
+ *      Call MIL_SUART_Init once first, it is what points MIL_UART here
+ *
+ *      The driverlib UART functions(UARTCharGet, UARTIntStatus ...) only
+ *      work on hardware UARTs. An ISR passed to MIL_UART_InitISR for a
+ *      software port is called from the RX timer ISR after each byte, read
+ *      the byte with MIL_UART_CharGetNonBlocking
+ *
+ * Speed Note:
+ *      The limit is ISR time, not pin speed. Each bit costs one interrupt of
+ *      roughly 100 cycles on each active direction, so a port sending and
+ *      receiving at once needs about 200 cycles per bit time:
+ *
+ *          16MHz:  9600 baud ~12% CPU, 19200 ~25%, 38400 ~50%
+ *          80MHz:  5x the baud for the same share
+ *
+ *      Past that, ISR latency eats into the half bit of sampling margin.
+ *      Any MIL_INT critical section longer than a quarter bit delays
+ *      samples enough to cause errors. main_suart.c measures the real
+ *      limit and CPU load per port on your board with a loopback wire
+ *
+ * Hardware Notes:
+ *       The RX edge interrupt takes over the GPIO port interrupt of the RX
+ *       pin, nothing else on that port can use GPIO interrupts
+ *
+ *       Each port uses one wide timer, A half for TX and B half for RX.
+ *       Wide timers are not used by MIL_TIMER
+ *
+ * MIL_SUART PIN MAP(edit the table in MIL_SUART.c to move a port):
+ *      SUART0:
+ *          RX :  PE2
+ *          TX :  PE3
+ *          TIMER: WTIMER0
+ *      SUART1:
+ *          RX :  PA6
+ *          TX :  PA7
+ *          TIMER: WTIMER1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_SUART_H_
+#define MIL_SUART_H_
+
+#define MIL_SUART_NUM_PORTS 2
+
+//not real peripheral addresses, MIL_UART sends these bases here
+#define MIL_SUART0_BASE 0xFFFF0000
+#define MIL_SUART1_BASE 0xFFFF0001
+
+#define MIL_SUART_IS_SOFT(base) (((base) & 0xFFFF0000) == 0xFFFF0000)
+
+//power of 2, bytes buffered each way per port
+#ifndef MIL_SUART_BUF_LEN
+#define MIL_SUART_BUF_LEN 64
+#endif
+
+/*
+ * Desc: per port counters
+ *
+ *       rx_bytes, tx_bytes: bytes moved
+ *       framing_errors:     stop bit read low(baud mismatch or late samples)
+ *       glitches:           falling edges that were gone by mid start bit
+ *       rx_dropped:         bytes lost because nobody read them in time
+ *       isr_cycles:         cycles spent in this port's ISRs, compare with
+ *                           MIL_TIME over the same period for CPU load
+ */
+typedef struct{
+
+    uint32_t rx_bytes;
+    uint32_t tx_bytes;
+    uint32_t framing_errors;
+    uint32_t glitches;
+    uint32_t rx_dropped;
+    uint32_t isr_cycles;
+
+}MIL_SUART_Stats;
+
+/*
+ * Desc: Hands these functions to MIL_UART(MIL_UART_SoftRegister) so the
+ *       MIL_UART functions take MIL_SUARTx_BASE, call once before
+ *       MIL_InitUART on a software port
+ */
+void MIL_SUART_Init(void);
+
+/*
+ * Desc: Same split as MIL_UART_ClockEnable/ClockReady/Config, these are
+ *       what MIL_InitUART calls for a software port
+ *
+ * Parameters:
+ *            base: MIL_SUARTx_BASE
+ *            baud_rate: your communication speed(see MIL_BAUD defines)
+ */
+void MIL_SUART_ClockEnable(uint32_t base);
+bool MIL_SUART_ClockReady(uint32_t base);
+void MIL_SUART_Config(uint32_t base, uint32_t baud_rate);
+
+/*
+ * Desc: Calls pISR after every received byte(MIL_RX_INT_EN) and/or every
+ *       sent byte(MIL_TX_INT_EN), from the port's timer ISR
+ */
+void MIL_SUART_ISRSet(uint32_t base, uint32_t int_flags, void (*pISR)(void));
+
+/*
+ * Desc: Moves the port's edge and timer interrupts off MIL_INT_PRI_TIMER
+ */
+void MIL_SUART_ISRPrioritySet(uint32_t base, uint8_t priority);
+
+/*
+ * Desc: Queues a byte, waits while the TX buffer is full
+ */
+void MIL_SUART_CharPut(uint32_t base, uint8_t data);
+
+/*
+ * Desc: Takes a received byte
+ *
+ * Returns: the byte, or -1 if none has arrived
+ */
+int32_t MIL_SUART_CharGetNonBlocking(uint32_t base);
+
+/*
+ * Desc: true if a received byte is waiting
+ */
+bool MIL_SUART_CharsAvail(uint32_t base);
+
+/*
+ * Desc: true while bytes are still going out
+ */
+bool MIL_SUART_Busy(uint32_t base);
+
+void MIL_SUART_StatsGet(uint32_t base, MIL_SUART_Stats *pStats);
+void MIL_SUART_StatsReset(uint32_t base);
+
+#endif /* MIL_SUART_H_ */
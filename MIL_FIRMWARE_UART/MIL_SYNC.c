@@ -0,0 +1,276 @@
+/*
+ * Name: MIL_SYNC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Two way time sync over a UART
+ *
+ * Implementation Notes:
+ *       Receive timestamps come from MIL_RXTS, the stamp of a frame
+ *       is the stamp of its SOF byte
+ *
+ *       Send timestamps are taken just before the SOF byte goes into an
+ *       empty TX FIFO, inside a MIL_INT critical section so no ISR can
+ *       sneak in between the stamp and the write. The small fixed lag until
+ *       the start bit actually leaves is the same on both boards and
+ *       cancels out of the offset
+ *
+ *       The parser restarts on any byte MIL_RXTS flags as start of frame,
+ *       so a torn frame can never swallow the next one even though SOF
+ *       can also show up inside the timestamps
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_RXTS.h"
+#include "MIL_SYNC.h"
+
+#define RX_BUF_LEN 32
+
+/************************STATE******************************/
+
+static uint32_t SYNC_BASE;
+static MIL_SYNC_Role ROLE;
+
+static MIL_RXTS_Byte RX_BUF[RX_BUF_LEN];
+static MIL_SYNCCLK CLOCK;
+
+//frame being received
+static uint8_t FRAME[MIL_SYNC_RESP_LEN];
+static uint8_t frame_len;
+static uint32_t frame_stamp;
+
+//slave exchange in progress
+static bool waiting;
+static uint8_t seq;
+static uint32_t t1;
+static uint32_t last_request;
+static uint32_t period_cycles;
+static uint32_t timeout_cycles;
+
+static uint32_t requests;
+static uint32_t timeouts;
+static uint32_t bad_frames;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static void PutU32(uint8_t *pDst, uint32_t value){
+
+    pDst[0] = (uint8_t)value;
+    pDst[1] = (uint8_t)(value >> 8);
+    pDst[2] = (uint8_t)(value >> 16);
+    pDst[3] = (uint8_t)(value >> 24);
+
+}
+
+static uint32_t GetU32(const uint8_t *pSrc){
+
+    return (uint32_t)pSrc[0] | ((uint32_t)pSrc[1] << 8) |
+           ((uint32_t)pSrc[2] << 16) | ((uint32_t)pSrc[3] << 24);
+
+}
+
+/*
+ * Desc: sends a frame and returns the MIL_TIME its SOF went out at
+ *
+ *       pFrame[0] is sent separately so the rest of the frame can hold
+ *       that time(the master's t3)
+ */
+static uint32_t SendStamped(uint8_t *pFrame, uint8_t len, uint8_t *pStampDst){
+
+    //the stamp is only good if the SOF starts the moment it is written
+    while(UARTBusy(SYNC_BASE));
+
+    uint32_t key = MIL_INT_Enter();
+
+    uint32_t stamp = MIL_TIME_NOW();
+    UARTCharPut(SYNC_BASE, pFrame[0]);
+
+    MIL_INT_Exit(key);
+
+    if(pStampDst){ PutU32(pStampDst, stamp); }
+
+    MIL_UART_OutArray(SYNC_BASE, &pFrame[1], len - 1);
+
+    return stamp;
+
+}
+
+static void MasterFrame(void){
+
+    if(FRAME[1] != MIL_SYNC_REQ){ bad_frames++; return; }
+
+    uint8_t reply[MIL_SYNC_RESP_LEN];
+
+    reply[0] = MIL_SYNC_SOF;
+    reply[1] = MIL_SYNC_RESP;
+    reply[2] = FRAME[2];
+    PutU32(&reply[3], frame_stamp);
+
+    SendStamped(reply, MIL_SYNC_RESP_LEN, &reply[7]);
+
+    requests++;
+
+}
+
+static void SlaveFrame(void){
+
+    if(!waiting || FRAME[1] != MIL_SYNC_RESP || FRAME[2] != seq){ bad_frames++; return; }
+
+    waiting = false;
+
+    MIL_SYNCCLK_Update(&CLOCK, t1, GetU32(&FRAME[3]), GetU32(&FRAME[7]),
+                       frame_stamp, MIL_TIME_NOW());
+
+}
+
+//feeds one received byte to the parser
+static void RxByte(const MIL_RXTS_Byte *pRx){
+
+    uint8_t expect = (ROLE == MIL_SYNC_MASTER) ? MIL_SYNC_REQ_LEN : MIL_SYNC_RESP_LEN;
+
+    if(pRx->sof){
+
+        if(frame_len){ bad_frames++; }
+        frame_len = 0;
+
+    }
+
+    if(pRx->error){
+
+        if(frame_len){ bad_frames++; }
+        frame_len = 0;
+        return;
+
+    }
+
+    if(frame_len == 0){
+
+        if(pRx->data != MIL_SYNC_SOF){ return; }
+        frame_stamp = pRx->stamp;
+
+    }
+
+    FRAME[frame_len++] = pRx->data;
+
+    if(frame_len < expect){ return; }
+
+    frame_len = 0;
+
+    if(ROLE == MIL_SYNC_MASTER){ MasterFrame(); }
+    else{ SlaveFrame(); }
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts sync on an initialized UART
+ */
+void MIL_SYNC_Init(uint32_t base, uint32_t baud_rate, MIL_SYNC_Role role){
+
+    SYNC_BASE = base;
+    ROLE = role;
+
+    frame_len = 0;
+    waiting = false;
+    seq = 0;
+    requests = 0;
+    timeouts = 0;
+    bad_frames = 0;
+
+    period_cycles = MIL_TIME_FromUs(MIL_SYNC_PERIOD_MS * 1000);
+    timeout_cycles = MIL_TIME_FromUs(MIL_SYNC_TIMEOUT_MS * 1000);
+
+    MIL_SYNCCLK_Init(&CLOCK, MIL_TIME_NOW());
+
+    //the first request goes out on the first poll
+    last_request = MIL_TIME_NOW() - period_cycles;
+
+    //trigger on every byte, frames are short
+    MIL_RXTS_Init(base, baud_rate, 1, RX_BUF, RX_BUF_LEN);
+
+}
+
+/*
+ * Desc: Answers requests(master) or runs an exchange when one is due(slave)
+ */
+void MIL_SYNC_Poll(void){
+
+    MIL_RXTS_Byte rx;
+
+    while(MIL_RXTS_Get(SYNC_BASE, &rx)){ RxByte(&rx); }
+
+    uint32_t now = MIL_TIME_NOW();
+
+    //keeps the 64 bit count going even if nobody calls MIL_SYNC_Now
+    MIL_SYNCCLK_Read(&CLOCK, now);
+
+    if(ROLE != MIL_SYNC_SLAVE){ return; }
+
+    if(waiting && (now - t1) > timeout_cycles){
+
+        waiting = false;
+        timeouts++;
+
+    }
+
+    if(!waiting && (now - last_request) >= period_cycles){
+
+        uint8_t req[MIL_SYNC_REQ_LEN] = {MIL_SYNC_SOF, MIL_SYNC_REQ, ++seq};
+
+        t1 = SendStamped(req, MIL_SYNC_REQ_LEN, 0);
+        last_request = t1;
+        waiting = true;
+        requests++;
+
+    }
+
+}
+
+/*
+ * Desc: Current time in master cycles
+ */
+uint64_t MIL_SYNC_Now(void){
+
+    return MIL_SYNCCLK_Read(&CLOCK, MIL_TIME_NOW());
+
+}
+
+/*
+ * Desc: true on the master, true on a slave after its first exchange
+ */
+bool MIL_SYNC_Synced(void){
+
+    return ROLE == MIL_SYNC_MASTER || MIL_SYNCCLK_Synced(&CLOCK);
+
+}
+
+/*
+ * Desc: copies out the statistics
+ */
+void MIL_SYNC_StatsGet(MIL_SYNC_Stats *pStats){
+
+    MIL_SYNCCLK_StatsGet(&CLOCK, &pStats->clock);
+    pStats->requests = requests;
+    pStats->timeouts = timeouts;
+    pStats->bad_frames = bad_frames;
+
+}
+
+/*
+ * Desc: clears the counters and the worst sync error
+ */
+void MIL_SYNC_StatsReset(void){
+
+    MIL_SYNCCLK_StatsReset(&CLOCK);
+    requests = 0;
+    timeouts = 0;
+    bad_frames = 0;
+
+}
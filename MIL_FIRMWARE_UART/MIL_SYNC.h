@@ -0,0 +1,131 @@
+/*
+ * Name: MIL_SYNC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Keeps the clocks of several boards in step over a UART
+ *       link(PTP style two way time sync)
+ *
+ * What to understand: One board is the master, its MIL_TIME is "the" time.
+ *                     Each slave asks the master what time it is every
+ *                     MIL_SYNC_PERIOD_MS:
+ *
+ *                        slave  --- request ---> master
+ *                        slave  <--- reply ----  master
+ *
+ *                     Both boards timestamp the start bit of every frame
+ *                     they send and receive(MIL_RXTS on the receive side),
+ *                     which gives the four timestamps MIL_SYNCCLK needs to
+ *                     work out the offset and the link delay
+ *
+ *                     MIL_SYNC_Now gives the master's time on every board,
+ *                     use it to timestamp anything that has to line up
+ *                     across boards
+ *
+ * Accuracy Note:
+ *      Stamps are good to about one bit time, so at 115.2k expect a sync
+ *      error of a few microseconds. Faster baud rates sync tighter
+ *
+ * Wire Protocol(all values little endian):
+ *      Request(slave -> master, 3 bytes):  [SOF][REQ][seq]
+ *      Reply(master -> slave, 11 bytes):   [SOF][RESP][seq][t2 u32][t3 u32]
+ *
+ * Usage:
+ *      //master board
+ *      MIL_SYNC_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, MIL_SYNC_MASTER);
+ *
+ *      //slave boards
+ *      MIL_SYNC_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, MIL_SYNC_SLAVE);
+ *
+ *      //both, in the main loop
+ *      MIL_SYNC_Poll();
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_SYNCCLK.h"
+
+#ifndef MIL_SYNC_H_
+#define MIL_SYNC_H_
+
+//how often a slave syncs
+#define MIL_SYNC_PERIOD_MS 250
+
+//a slave gives up on a reply after this long
+#define MIL_SYNC_TIMEOUT_MS 50
+
+#define MIL_SYNC_SOF  0x53
+#define MIL_SYNC_REQ  0x01
+#define MIL_SYNC_RESP 0x02
+
+#define MIL_SYNC_REQ_LEN  3
+#define MIL_SYNC_RESP_LEN 11
+
+typedef enum{
+
+    MIL_SYNC_MASTER,
+    MIL_SYNC_SLAVE
+
+}MIL_SYNC_Role;
+
+/*
+ * Desc: link and clock statistics
+ *
+ *       clock:      offset(the sync error), delay and drift, see MIL_SYNCCLK.h
+ *       requests:   requests sent(slave) or answered(master)
+ *       timeouts:   requests that never got a reply(slave)
+ *       bad_frames: frames thrown away for errors or wrong seq
+ */
+typedef struct{
+
+    MIL_SYNCCLK_Stats clock;
+    uint32_t requests;
+    uint32_t timeouts;
+    uint32_t bad_frames;
+
+}MIL_SYNC_Stats;
+
+/*
+ * Desc: Starts sync on a UART that is already set up with MIL_InitUART,
+ *       MIL_TIME_Init must have been called
+ *
+ *       The UART is used only for sync, its RX interrupt belongs
+ *       to MIL_RXTS
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       baud_rate: the baud rate the UART was initialized with
+ *       role: MIL_SYNC_MASTER or MIL_SYNC_SLAVE
+ */
+void MIL_SYNC_Init(uint32_t base, uint32_t baud_rate, MIL_SYNC_Role role);
+
+/*
+ * Desc: Answers requests(master) or runs an exchange when one is due(slave)
+ *       only waits if the UART is still sending, call from the main loop
+ */
+void MIL_SYNC_Poll(void);
+
+/*
+ * Desc: Current time in master cycles, the low 32 bits match the master's
+ *       MIL_TIME. Never goes backwards once synced
+ *
+ *       Main loop only, not from ISRs
+ */
+uint64_t MIL_SYNC_Now(void);
+
+/*
+ * Desc: true on the master, true on a slave after its first exchange
+ */
+bool MIL_SYNC_Synced(void);
+
+/*
+ * Desc: copies out the statistics
+ */
+void MIL_SYNC_StatsGet(MIL_SYNC_Stats *pStats);
+
+/*
+ * Desc: clears the counters and the worst sync error
+ */
+void MIL_SYNC_StatsReset(void);
+
+#endif /* MIL_SYNC_H_ */
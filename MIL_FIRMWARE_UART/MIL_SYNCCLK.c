@@ -0,0 +1,197 @@
+/*
+ * Name: MIL_SYNCCLK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Disciplined clock for MIL_SYNC
+ *
+ * Implementation Notes:
+ *       The clock is a straight line through an anchor point:
+ *
+ *          clock(local) = anchor_sync + e + e * freq / 2^32
+ *          e = local - anchor_local(signed, so past timestamps work too)
+ *
+ *       Every update moves the anchor to the current time before changing
+ *       freq, so the line bends there instead of jumping
+ *
+ *       Steering is a PI loop on offset / interval(the rate error that
+ *       would explain the offset). The integral part learns the oscillator
+ *       difference, the proportional part removes the remaining offset
+ *       over the next interval. With KP = 1/2 and KI = 1/4 the offset
+ *       shrinks to ~0.7x every exchange
+ *
+ *       A step fixes the whole offset at once and, when the interval is
+ *       known, the whole rate error too. This is what gets a 1% oscillator
+ *       error under control in two exchanges
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "MIL_SYNCCLK.h"
+
+//move the anchor up before e gets near the int32 limit
+#define REANCHOR_CYCLES 0x40000000
+
+/************************PRIVATE FUNCTIONS******************************/
+
+//clock value at local without the never-backwards clamp
+static uint64_t Eval(const MIL_SYNCCLK *pClk, uint32_t local){
+
+    int32_t e = (int32_t)(local - pClk->anchor_local);
+
+    //|e| < 2^31 and |freq| < 2^28, the product fits easily in 64 bits
+    return pClk->anchor_sync + (int64_t)e + (((int64_t)e * pClk->freq) >> 32);
+
+}
+
+static int32_t Clamp(int64_t value){
+
+    if(value > MIL_SYNCCLK_MAX_FREQ){ return MIL_SYNCCLK_MAX_FREQ; }
+    if(value < -MIL_SYNCCLK_MAX_FREQ){ return -MIL_SYNCCLK_MAX_FREQ; }
+
+    return (int32_t)value;
+
+}
+
+static void Anchor(MIL_SYNCCLK *pClk, uint64_t sync, uint32_t local){
+
+    pClk->anchor_sync = sync;
+    pClk->anchor_local = local;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Starts a clock that counts local cycles(not synced yet)
+ */
+void MIL_SYNCCLK_Init(MIL_SYNCCLK *pClk, uint32_t local){
+
+    Anchor(pClk, local, local);
+    pClk->last_read = local;
+    pClk->freq = 0;
+    pClk->freq_i = 0;
+    pClk->synced = false;
+    pClk->have_last = false;
+    pClk->last_t4 = 0;
+
+    pClk->stats.offset = 0;
+    pClk->stats.offset_max = 0;
+    pClk->stats.delay = 0;
+    pClk->stats.freq_ppb = 0;
+    pClk->stats.updates = 0;
+    pClk->stats.steps = 0;
+
+}
+
+/*
+ * Desc: Clock value at a local MIL_TIME
+ */
+uint64_t MIL_SYNCCLK_Read(MIL_SYNCCLK *pClk, uint32_t local){
+
+    uint64_t now = Eval(pClk, local);
+
+    if((int32_t)(local - pClk->anchor_local) > REANCHOR_CYCLES){ Anchor(pClk, now, local); }
+
+    if(now < pClk->last_read){ return pClk->last_read; }
+
+    pClk->last_read = now;
+
+    return now;
+
+}
+
+/*
+ * Desc: Feeds in one exchange and steers the clock
+ */
+void MIL_SYNCCLK_Update(MIL_SYNCCLK *pClk, uint32_t t1, uint32_t t2,
+                        uint32_t t3, uint32_t t4, uint32_t local){
+
+    //both slave timestamps on this clock, only the low 32 bits matter
+    uint32_t c1 = (uint32_t)Eval(pClk, t1);
+    uint32_t c4 = (uint32_t)Eval(pClk, t4);
+
+    int32_t offset = (int32_t)(((int64_t)(int32_t)(t2 - c1) + (int32_t)(t3 - c4)) / 2);
+    int32_t delay = ((int32_t)(c4 - c1) - (int32_t)(t3 - t2)) / 2;
+
+    uint32_t mag = (offset < 0) ? -(uint32_t)offset : (uint32_t)offset;
+
+    //rate error that would explain the offset, in 2^-32 units
+    int32_t interval = (int32_t)(t4 - pClk->last_t4);
+    bool have_rate = pClk->have_last && interval > 0;
+    int64_t rate = have_rate ? (((int64_t)offset << 32) / interval) : 0;
+
+    uint64_t now = Eval(pClk, local);
+
+    if(!pClk->synced || mag > MIL_SYNCCLK_STEP_CYCLES){
+
+        pClk->freq_i = Clamp((int64_t)pClk->freq_i + rate);
+        pClk->freq = pClk->freq_i;
+
+        uint64_t stepped = now + (int64_t)offset;
+
+        /*
+         * The first sync takes the master's 32 bit time as is, so does a
+         * step that would go below 0. Either way the 64 bit count restarts
+         */
+        if(!pClk->synced || (offset < 0 && (uint64_t)(-(int64_t)offset) > now)){
+
+            stepped = (uint32_t)stepped;
+
+        }
+
+        //the only place the clock may go backwards
+        Anchor(pClk, stepped, local);
+        pClk->last_read = pClk->anchor_sync;
+
+        pClk->synced = true;
+        pClk->stats.steps++;
+        pClk->stats.offset_max = 0;
+
+    }
+    else{
+
+        pClk->freq_i = Clamp((int64_t)pClk->freq_i + (rate >> MIL_SYNCCLK_KI_SHIFT));
+        pClk->freq = Clamp((int64_t)pClk->freq_i + (rate >> MIL_SYNCCLK_KP_SHIFT));
+
+        Anchor(pClk, now, local);
+
+        if(mag > pClk->stats.offset_max){ pClk->stats.offset_max = mag; }
+
+    }
+
+    pClk->have_last = true;
+    pClk->last_t4 = t4;
+
+    pClk->stats.offset = offset;
+    pClk->stats.delay = delay;
+    pClk->stats.freq_ppb = (int32_t)(((int64_t)pClk->freq * 1000000000) >> 32);
+    pClk->stats.updates++;
+
+}
+
+/*
+ * Desc: true once the first exchange has set the clock
+ */
+bool MIL_SYNCCLK_Synced(const MIL_SYNCCLK *pClk){
+
+    return pClk->synced;
+
+}
+
+/*
+ * Desc: copies out the sync statistics
+ */
+void MIL_SYNCCLK_StatsGet(const MIL_SYNCCLK *pClk, MIL_SYNCCLK_Stats *pStats){
+
+    *pStats = pClk->stats;
+
+}
+
+/*
+ * Desc: restarts offset_max
+ */
+void MIL_SYNCCLK_StatsReset(MIL_SYNCCLK *pClk){
+
+    pClk->stats.offset_max = 0;
+
+}
@@ -0,0 +1,143 @@
+/*
+ * Name: MIL_SYNCCLK
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: A clock that is steered to follow another board's clock,
+ *       the math half of MIL_SYNC
+ *
+ * What to understand: MIL_ClkSetInt_16MHz runs off the internal oscillator,
+ *                     which can be off by up to 1%. Two boards started
+ *                     together are already 10ms apart after one second
+ *
+ *                     A disciplined clock counts local MIL_TIME cycles but
+ *                     runs slightly faster or slower(freq) so that it counts
+ *                     at the master's rate. Every exchange with the master
+ *                     measures how far off it still is(offset). A small
+ *                     offset is removed by nudging freq, never by jumping,
+ *                     so the clock never runs backwards
+ *
+ *                     tools/sync_sim.c runs this code on two simulated boards with
+ *                     their own oscillator error and a jittery link, and prints the
+ *                     true sync error next to the error the slave thinks it has
+ *
+ * Timestamps Note:
+ *      An exchange is the usual four timestamps:
+ *          t1: slave sends request    (slave local cycles)
+ *          t2: master receives it     (master cycles)
+ *          t3: master sends reply     (master cycles)
+ *          t4: slave receives reply   (slave local cycles)
+ *
+ *      Delays that are the same in both directions cancel out of the offset
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_SYNCCLK_H_
+#define MIL_SYNCCLK_H_
+
+//offsets bigger than this(cycles) are fixed by jumping, 1ms at 16MHz
+#define MIL_SYNCCLK_STEP_CYCLES 16000
+
+//freq limit, 5% in 2^-32 units. Keeps the clock always moving forward
+#define MIL_SYNCCLK_MAX_FREQ 214748365
+
+//loop gains as right shifts of offset / interval, see MIL_SYNCCLK.c
+#define MIL_SYNCCLK_KP_SHIFT 1
+#define MIL_SYNCCLK_KI_SHIFT 2
+
+/*
+ * Desc: how well the clock is following the master
+ *
+ *       offset:     master minus this clock at the last exchange(cycles),
+ *                   the sync error
+ *       offset_max: largest |offset| since the last step or stats reset
+ *       delay:      one way link delay measured at the last exchange(cycles)
+ *       freq_ppb:   rate correction in parts per billion, positive means
+ *                   the local oscillator is slower than the master's
+ *       updates:    exchanges used
+ *       steps:      times the clock had to jump instead of slew
+ */
+typedef struct{
+
+    int32_t  offset;
+    uint32_t offset_max;
+    int32_t  delay;
+    int32_t  freq_ppb;
+    uint32_t updates;
+    uint32_t steps;
+
+}MIL_SYNCCLK_Stats;
+
+/*
+ * Desc: one disciplined clock, all fields are private
+ */
+typedef struct{
+
+    uint64_t anchor_sync;   //clock value at anchor_local
+    uint32_t anchor_local;
+    uint64_t last_read;     //never go below this
+
+    int32_t  freq;          //rate correction in 2^-32 units
+    int32_t  freq_i;        //integral part of freq
+
+    bool     synced;
+    bool     have_last;     //last_t4 is valid
+    uint32_t last_t4;
+
+    MIL_SYNCCLK_Stats stats;
+
+}MIL_SYNCCLK;
+
+/*
+ * Desc: Starts a clock that counts local cycles(not synced yet)
+ *
+ * Parameters:
+ *       pClk: the clock
+ *       local: current MIL_TIME
+ */
+void MIL_SYNCCLK_Init(MIL_SYNCCLK *pClk, uint32_t local);
+
+/*
+ * Desc: Clock value at a local MIL_TIME
+ *
+ *       Call at least once every minute or so, the clock only
+ *       understands local times within ~2 minutes of the last call
+ *
+ * Parameters:
+ *       pClk: the clock
+ *       local: current MIL_TIME
+ *
+ * Returns: the clock in master cycles, the low 32 bits match the
+ *          master's MIL_TIME once synced. Never goes backwards except
+ *          at a step(see MIL_SYNCCLK_Stats steps)
+ */
+uint64_t MIL_SYNCCLK_Read(MIL_SYNCCLK *pClk, uint32_t local);
+
+/*
+ * Desc: Feeds in one exchange and steers the clock
+ *
+ * Parameters:
+ *       pClk: the clock
+ *       t1 - t4: the exchange timestamps(see top of file)
+ *       local: current MIL_TIME, must be after t4
+ */
+void MIL_SYNCCLK_Update(MIL_SYNCCLK *pClk, uint32_t t1, uint32_t t2,
+                        uint32_t t3, uint32_t t4, uint32_t local);
+
+/*
+ * Desc: true once the first exchange has set the clock
+ */
+bool MIL_SYNCCLK_Synced(const MIL_SYNCCLK *pClk);
+
+/*
+ * Desc: copies out the sync statistics
+ */
+void MIL_SYNCCLK_StatsGet(const MIL_SYNCCLK *pClk, MIL_SYNCCLK_Stats *pStats);
+
+/*
+ * Desc: restarts offset_max
+ */
+void MIL_SYNCCLK_StatsReset(MIL_SYNCCLK *pClk);
+
+#endif /* MIL_SYNCCLK_H_ */
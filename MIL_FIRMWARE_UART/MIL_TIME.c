@@ -0,0 +1,52 @@
+/*
+ * Name: MIL_TIME
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Cycle accurate timestamps for measuring how long things take
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "driverlib/sysctl.h"
+
+#include "MIL_TIME.h"
+
+/*
+ * Desc: Starts the cycle counter from 0
+ */
+void MIL_TIME_Init(void){
+
+    //the DWT is part of the debug block, it has to be switched on first
+    HWREG(MIL_TIME_DEMCR) |= MIL_TIME_DEMCR_TRCENA;
+
+    HWREG(MIL_TIME_DWT_CYCCNT) = 0;
+    HWREG(MIL_TIME_DWT_CTRL) |= MIL_TIME_CYCCNTENA;
+
+}
+
+/*
+ * Desc: current timestamp in CPU cycles
+ */
+uint32_t MIL_TIME_Now(void){
+
+    return MIL_TIME_NOW();
+
+}
+
+/*
+ * Desc: converts a number of cycles into microseconds
+ */
+uint32_t MIL_TIME_ToUs(uint32_t cycles){
+
+    return cycles / (SysCtlClockGet() / 1000000);
+
+}
+
+/*
+ * Desc: converts microseconds into a number of cycles
+ */
+uint32_t MIL_TIME_FromUs(uint32_t us){
+
+    return us * (SysCtlClockGet() / 1000000);
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Name: MIL_TIME
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Cycle accurate timestamps for measuring how long things take
+ *
+ * What to understand: The Cortex-M4 core has a debug unit(DWT) with a
+ *                     32 bit counter that goes up by one every CPU clock.
+ *                     Reading it is a single load, so it is cheap enough to
+ *                     timestamp things inside ISRs
+ *
+ *                     At 16MHz one count is 62.5ns and the counter wraps
+ *                     every ~268 seconds. Subtracting two timestamps with
+ *                     unsigned math still gives the right answer across a
+ *                     wrap as long as less than one full wrap went by
+ *
+ * Debugger Note:
+ *      The counter keeps running with or without a debugger attached,
+ *      MIL_TIME_Init turns it on
+ */
+
+#include <stdint.h>
+#include "inc/hw_types.h"
+
+#ifndef MIL_TIME_H_
+#define MIL_TIME_H_
+
+//DWT cycle counter registers(see the ARMv7-M architecture manual)
+#define MIL_TIME_DEMCR      0xE000EDFC
+#define MIL_TIME_DEMCR_TRCENA 0x01000000
+#define MIL_TIME_DWT_CTRL   0xE0001000
+#define MIL_TIME_DWT_CYCCNT 0xE0001004
+#define MIL_TIME_CYCCNTENA  0x00000001
+
+/*
+ * Desc: current timestamp in CPU cycles
+ *
+ *       a macro so it costs one load even without optimization,
+ *       it is used on ISR hot paths
+ */
+#define MIL_TIME_NOW() (HWREG(MIL_TIME_DWT_CYCCNT))
+
+/*
+ * Desc: Starts the cycle counter from 0
+ *       call this as early in main as possible
+ */
+void MIL_TIME_Init(void);
+
+/*
+ * Desc: current timestamp in CPU cycles
+ */
+uint32_t MIL_TIME_Now(void);
+
+/*
+ * Desc: converts a number of cycles into microseconds
+ *       using the current system clock
+ */
+uint32_t MIL_TIME_ToUs(uint32_t cycles);
+
+/*
+ * Desc: converts microseconds into a number of cycles
+ *       using the current system clock
+ */
+uint32_t MIL_TIME_FromUs(uint32_t us);
+
+#endif /* MIL_TIME_H_ */
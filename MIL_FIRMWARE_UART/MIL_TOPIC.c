@@ -0,0 +1,276 @@
+/*
+ * Name: MIL_TOPIC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Publish/subscribe between ISRs and the main loop
+ *
+ * Implementation Notes:
+ *       seq is twice the publish count, plus one while a publish is being
+ *       written. Publish n lives in slot n & 1, so publish n + 1 writes the
+ *       other slot and publish n + 2 is the first that touches slot n again.
+ *       That one starts by setting seq to 2n + 3, so a reader that copied
+ *       slot n is good as long as seq is still under 2n + 3 afterwards
+ *
+ *       Queues have one writer(the publisher moves head) and one reader
+ *       (the subscriber moves tail). Indexes run free and wrap, depth is a
+ *       power of 2 so the wrap lands on a whole number of laps
+ *
+ *       BARRIER keeps the compiler(and the CPU, on the host) from moving
+ *       the slot copy outside the seq updates around it
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "MIL_POOL.h"
+#include "MIL_TOPIC.h"
+
+#define BARRIER() __sync_synchronize()
+
+/************************STATE******************************/
+
+static MIL_TOPIC *TOPICS;
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static void Register(MIL_TOPIC *pTopic){
+
+    for(MIL_TOPIC *pT = TOPICS; pT; pT = pT->pNext){
+
+        if(pT == pTopic){ return; }
+
+    }
+
+    pTopic->pNext = TOPICS;
+    TOPICS = pTopic;
+
+}
+
+//puts one sample on every queue that has room
+static void Fan(MIL_TOPIC *pTopic, const void *pData, uint8_t *pBlock){
+
+    for(MIL_TOPIC_Sub *pS = pTopic->pSubs; pS; pS = pS->pNext){
+
+        if(!pS->pQueue){ continue; }
+
+        uint16_t head = pS->head;
+        uint16_t waiting = (uint16_t)(head - pS->tail);
+
+        if(waiting >= pS->depth){ pS->dropped++; continue; }
+
+        if(pBlock){ MIL_POOL_Retain(pBlock); }
+
+        memcpy(&pS->pQueue[(head & (pS->depth - 1)) * pTopic->size], pData, pTopic->size);
+
+        BARRIER();
+        pS->head = head + 1;
+
+        if(waiting + 1u > pS->lag_max){ pS->lag_max = waiting + 1u; }
+
+    }
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_TOPIC_Init(MIL_TOPIC *pTopic, const char *pName, uint16_t size, uint8_t *pSlots){
+
+    pTopic->pName = pName;
+    pTopic->size = size;
+    pTopic->blocks = false;
+    pTopic->pSlots = pSlots;
+    pTopic->seq = 0;
+    pTopic->pSubs = 0;
+    pTopic->window_seq = 0;
+    pTopic->window_start = 0;
+    pTopic->rate = 0;
+
+    Register(pTopic);
+
+}
+
+void MIL_TOPIC_InitBlocks(MIL_TOPIC *pTopic, const char *pName){
+
+    MIL_TOPIC_Init(pTopic, pName, sizeof(uint8_t *), 0);
+
+    pTopic->blocks = true;
+
+}
+
+bool MIL_TOPIC_Subscribe(MIL_TOPIC *pTopic, MIL_TOPIC_Sub *pSub, uint8_t *pQueue, uint16_t depth){
+
+    if(pQueue && (depth == 0 || (depth & (depth - 1)))){ return false; }
+    if(!pQueue && pTopic->blocks){ return false; }
+
+    pSub->pTopic = pTopic;
+    pSub->pQueue = pQueue;
+    pSub->depth = pQueue ? depth : 0;
+    pSub->head = 0;
+    pSub->tail = 0;
+    pSub->dropped = 0;
+    pSub->last = pTopic->seq >> 1;
+    pSub->missed = 0;
+    pSub->lag_max = 0;
+
+    pSub->pNext = pTopic->pSubs;
+    pTopic->pSubs = pSub;
+
+    return true;
+
+}
+
+bool MIL_TOPIC_Publish(MIL_TOPIC *pTopic, const void *pData, uint16_t size){
+
+    if(pTopic->blocks || size != pTopic->size){ return false; }
+
+    uint32_t seq = pTopic->seq;
+    uint32_t n = (seq >> 1) + 1;
+
+    //odd while writing, readers of publish n - 2 know their slot is going
+    pTopic->seq = seq + 1;
+    BARRIER();
+
+    memcpy(&pTopic->pSlots[(n & 1) * size], pData, size);
+
+    BARRIER();
+    pTopic->seq = seq + 2;
+
+    Fan(pTopic, pData, 0);
+
+    return true;
+
+}
+
+bool MIL_TOPIC_PublishBlock(MIL_TOPIC *pTopic, uint8_t *pBlock){
+
+    if(!pTopic->blocks){ MIL_POOL_Release(pBlock); return false; }
+
+    pTopic->seq += 2;
+
+    Fan(pTopic, &pBlock, pBlock);
+
+    //the caller's reference, each queue holds its own now
+    MIL_POOL_Release(pBlock);
+
+    return true;
+
+}
+
+uint32_t MIL_TOPIC_Read(MIL_TOPIC *pTopic, void *pOut, uint16_t size){
+
+    if(pTopic->blocks || size != pTopic->size){ return 0; }
+
+    while(1){
+
+        uint32_t seq = pTopic->seq;
+        uint32_t n = seq >> 1;
+
+        if(n == 0){ return 0; }
+
+        BARRIER();
+        memcpy(pOut, &pTopic->pSlots[(n & 1) * size], size);
+        BARRIER();
+
+        //slot n is only rewritten once seq reaches 2n + 3
+        if((uint32_t)(pTopic->seq - 2 * n) < 3){ return n; }
+
+    }
+
+}
+
+bool MIL_TOPIC_Poll(MIL_TOPIC_Sub *pSub, void *pOut, uint16_t size){
+
+    uint32_t n = MIL_TOPIC_Read(pSub->pTopic, pOut, size);
+
+    if(n == 0 || n == pSub->last){ return false; }
+
+    uint32_t behind = n - pSub->last;
+
+    pSub->missed += behind - 1;
+    if(behind > pSub->lag_max){ pSub->lag_max = behind; }
+    pSub->last = n;
+
+    return true;
+
+}
+
+bool MIL_TOPIC_Take(MIL_TOPIC_Sub *pSub, void *pOut, uint16_t size){
+
+    MIL_TOPIC *pTopic = pSub->pTopic;
+
+    if(!pSub->pQueue || size != pTopic->size){ return false; }
+
+    uint16_t tail = pSub->tail;
+
+    if(tail == pSub->head){ return false; }
+
+    BARRIER();
+    memcpy(pOut, &pSub->pQueue[(tail & (pSub->depth - 1)) * size], size);
+    BARRIER();
+
+    //sample is copied out before the publisher can reuse the spot
+    pSub->tail = tail + 1;
+
+    return true;
+
+}
+
+void MIL_TOPIC_Tick(uint32_t now, uint32_t ticks_per_s){
+
+    for(MIL_TOPIC *pT = TOPICS; pT; pT = pT->pNext){
+
+        uint32_t elapsed = now - pT->window_start;
+
+        if(elapsed < ticks_per_s){ continue; }
+
+        uint32_t seq = pT->seq;
+        uint32_t count = (seq >> 1) - (pT->window_seq >> 1);
+
+        pT->rate = (uint32_t)(((uint64_t)count * ticks_per_s + elapsed / 2) / elapsed);
+        pT->window_seq = seq;
+        pT->window_start = now;
+
+    }
+
+}
+
+MIL_TOPIC *MIL_TOPIC_Next(const MIL_TOPIC *pTopic){
+
+    return pTopic ? pTopic->pNext : TOPICS;
+
+}
+
+const char *MIL_TOPIC_Name(const MIL_TOPIC *pTopic){
+
+    return pTopic->pName;
+
+}
+
+void MIL_TOPIC_StatsGet(const MIL_TOPIC *pTopic, MIL_TOPIC_Stats *pStats){
+
+    pStats->publishes = pTopic->seq >> 1;
+    pStats->rate = pTopic->rate;
+    pStats->subscribers = 0;
+
+    for(const MIL_TOPIC_Sub *pS = pTopic->pSubs; pS; pS = pS->pNext){ pStats->subscribers++; }
+
+}
+
+void MIL_TOPIC_SubStatsGet(const MIL_TOPIC_Sub *pSub, MIL_TOPIC_SubStats *pStats){
+
+    if(pSub->pQueue){
+
+        pStats->lag = (uint16_t)(pSub->head - pSub->tail);
+        pStats->dropped = pSub->dropped;
+
+    }
+    else{
+
+        pStats->lag = (pSub->pTopic->seq >> 1) - pSub->last;
+        pStats->dropped = pSub->missed;
+
+    }
+
+    pStats->lag_max = pSub->lag_max;
+
+}
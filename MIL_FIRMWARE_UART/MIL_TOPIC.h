@@ -0,0 +1,254 @@
+/*
+ * Name: MIL_TOPIC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Publish/subscribe between ISRs and the main loop,
+ *       instead of shared globals
+ *
+ * What to understand: A topic is one kind of data(IMU samples, the button
+ *                     state, motor commands) with a fixed size. Whoever
+ *                     makes the data publishes it, anyone who needs it reads
+ *                     or subscribes, and neither side has to know the other
+ *
+ *                     There are two ways to get data out of a topic:
+ *
+ *                        latest value: MIL_TOPIC_Read always gives the
+ *                                      newest sample. It never waits and
+ *                                      never sees half of one sample and
+ *                                      half of the next, even when the
+ *                                      publisher is an ISR
+ *
+ *                        queued:       a subscriber with a queue gets every
+ *                                      sample in order, until its queue is
+ *                                      full(then new ones are dropped and
+ *                                      counted)
+ *
+ *                     Large payloads don't have to be copied at all, publish
+ *                     a MIL_POOL block with MIL_TOPIC_PublishBlock and each
+ *                     queued subscriber gets its own reference to it
+ *
+ *                     tools/topic_sim.c interrupts this code with a timer signal
+ *                     at random points and checks no read comes back torn, queued
+ *                     subscribers see every sample in order and every MIL_POOL
+ *                     block gets back to the pool
+ *
+ * Latest Value Note:
+ *      Each topic keeps the last two samples. The publisher always writes
+ *      the older one, so a reader that interrupts a publish still finds the
+ *      newest complete sample untouched. A reader only has to try again if
+ *      the publisher interrupts IT twice in the middle of one copy, which
+ *      an ISR reader never sees(seqlock style, with no waiting)
+ *
+ * Rules:
+ *      One publisher per topic(one ISR, or the main loop). Two publishers
+ *      need a MIL_INT critical section around MIL_TOPIC_Publish
+ *
+ *      Each queued subscriber is read from one place only
+ *
+ *      Set up topics and subscribers at startup, before anything publishes
+ *
+ * Usage:
+ *      typedef struct{ int16_t x, y, z; }Accel;
+ *
+ *      uint8_t ACCEL_SLOTS[MIL_TOPIC_SLOTS_LEN(sizeof(Accel))];
+ *      MIL_TOPIC accel_topic;
+ *      MIL_TOPIC_Init(&accel_topic, "accel", sizeof(Accel), ACCEL_SLOTS);
+ *
+ *      //sensor ISR
+ *      MIL_TOPIC_PUBLISH(&accel_topic, &sample);
+ *
+ *      //control loop, always the newest
+ *      MIL_TOPIC_READ(&accel_topic, &sample);
+ *
+ *      //logger, every sample
+ *      uint8_t LOG_Q[MIL_TOPIC_QUEUE_LEN(sizeof(Accel), 16)];
+ *      MIL_TOPIC_Sub log_sub;
+ *      MIL_TOPIC_Subscribe(&accel_topic, &log_sub, LOG_Q, 16);
+ *      while(MIL_TOPIC_TAKE(&log_sub, &sample)){ ... }
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef MIL_TOPIC_H_
+#define MIL_TOPIC_H_
+
+//bytes a topic needs for its two latest value slots
+#define MIL_TOPIC_SLOTS_LEN(size) (2 * (size))
+
+//bytes a subscriber needs for a queue of depth samples
+#define MIL_TOPIC_QUEUE_LEN(size, depth) ((size) * (depth))
+
+//size checked versions, the value's type has to be the topic's size
+#define MIL_TOPIC_PUBLISH(pTopic, pValue) MIL_TOPIC_Publish((pTopic), (pValue), sizeof(*(pValue)))
+#define MIL_TOPIC_READ(pTopic, pValue)    MIL_TOPIC_Read((pTopic), (pValue), sizeof(*(pValue)))
+#define MIL_TOPIC_TAKE(pSub, pValue)      MIL_TOPIC_Take((pSub), (pValue), sizeof(*(pValue)))
+
+struct MIL_TOPIC_Sub;
+
+/*
+ * Desc: one topic, all fields are private
+ */
+typedef struct MIL_TOPIC{
+
+    const char *pName;
+    uint16_t size;
+    bool blocks;                    //payloads are MIL_POOL block pointers
+
+    uint8_t *pSlots;
+    volatile uint32_t seq;          //2 x publishes, odd while one is being written
+
+    struct MIL_TOPIC_Sub *pSubs;
+    struct MIL_TOPIC *pNext;        //every topic, for MIL_TOPIC_Next
+
+    //rate measurement, MIL_TOPIC_Tick
+    uint32_t window_seq;
+    uint32_t window_start;
+    uint32_t rate;
+
+}MIL_TOPIC;
+
+/*
+ * Desc: one subscriber, all fields are private
+ */
+typedef struct MIL_TOPIC_Sub{
+
+    MIL_TOPIC *pTopic;
+    struct MIL_TOPIC_Sub *pNext;
+
+    //queued subscribers
+    uint8_t *pQueue;
+    uint16_t depth;
+    volatile uint16_t head;         //publisher writes
+    volatile uint16_t tail;         //subscriber reads
+    volatile uint32_t dropped;
+
+    //latest value subscribers
+    uint32_t last;                  //publish number last seen
+    uint32_t missed;
+
+    uint32_t lag_max;
+
+}MIL_TOPIC_Sub;
+
+/*
+ * Desc: counters for one topic
+ *
+ *       publishes:   since startup
+ *       rate:        publishes per second over the last MIL_TOPIC_Tick window
+ *       subscribers: how many
+ */
+typedef struct{
+
+    uint32_t publishes;
+    uint32_t rate;
+    uint8_t subscribers;
+
+}MIL_TOPIC_Stats;
+
+/*
+ * Desc: counters for one subscriber
+ *
+ *       lag:     samples waiting in the queue now(queued), or samples published
+ *                since the last MIL_TOPIC_Poll(latest value)
+ *       lag_max: worst lag seen
+ *       dropped: samples lost, queue full(queued) or skipped over(latest value)
+ */
+typedef struct{
+
+    uint32_t lag;
+    uint32_t lag_max;
+    uint32_t dropped;
+
+}MIL_TOPIC_SubStats;
+
+/*
+ * Desc: Sets up a topic for copied payloads
+ *
+ * Parameters:
+ *       pTopic: the topic
+ *       pName: shown in reports, keep it short
+ *       size: bytes per sample
+ *       pSlots: MIL_TOPIC_SLOTS_LEN(size) bytes that live as long as the topic
+ */
+void MIL_TOPIC_Init(MIL_TOPIC *pTopic, const char *pName, uint16_t size, uint8_t *pSlots);
+
+/*
+ * Desc: Sets up a topic that passes MIL_POOL blocks without copying them,
+ *       only queued subscribers can read it
+ */
+void MIL_TOPIC_InitBlocks(MIL_TOPIC *pTopic, const char *pName);
+
+/*
+ * Desc: Adds a subscriber
+ *
+ * Parameters:
+ *       pTopic: the topic
+ *       pSub: the subscriber
+ *       pQueue: MIL_TOPIC_QUEUE_LEN(size, depth) bytes for a queued subscriber,
+ *               0 for a latest value subscriber(MIL_TOPIC_Poll)
+ *       depth: queue length, a power of 2
+ *
+ * Returns: false if depth isn't a power of 2 or a block topic has no queue
+ */
+bool MIL_TOPIC_Subscribe(MIL_TOPIC *pTopic, MIL_TOPIC_Sub *pSub, uint8_t *pQueue, uint16_t depth);
+
+/*
+ * Desc: Publishes one sample, copied into the topic and every queue
+ *
+ * Returns: false if size isn't the topic's size or it is a block topic
+ */
+bool MIL_TOPIC_Publish(MIL_TOPIC *pTopic, const void *pData, uint16_t size);
+
+/*
+ * Desc: Publishes a MIL_POOL block without copying it. Every queued
+ *       subscriber gets a reference, the caller's reference is used up
+ *       (so with no subscribers the block goes straight back to the pool)
+ *
+ * Returns: false if this isn't a block topic, the block is released anyway
+ */
+bool MIL_TOPIC_PublishBlock(MIL_TOPIC *pTopic, uint8_t *pBlock);
+
+/*
+ * Desc: Copies out the newest sample, safe from any ISR
+ *
+ * Returns: the sample's publish number(counts up from 1),
+ *          0 if nothing has been published yet or size is wrong
+ */
+uint32_t MIL_TOPIC_Read(MIL_TOPIC *pTopic, void *pOut, uint16_t size);
+
+/*
+ * Desc: For a latest value subscriber, copies out the newest sample
+ *       if there has been one since the last call
+ *
+ * Returns: true if pOut holds a new sample
+ */
+bool MIL_TOPIC_Poll(MIL_TOPIC_Sub *pSub, void *pOut, uint16_t size);
+
+/*
+ * Desc: For a queued subscriber, takes the oldest waiting sample
+ *       (for a block topic pOut gets the block pointer, release it when done)
+ *
+ * Returns: false if the queue is empty or size is wrong
+ */
+bool MIL_TOPIC_Take(MIL_TOPIC_Sub *pSub, void *pOut, uint16_t size);
+
+/*
+ * Desc: Updates every topic's publish rate, call from the main loop
+ *
+ * Parameters:
+ *       now: current tick(MIL_TIME_NOW() on the board)
+ *       ticks_per_s: how fast now counts, rates update once this much has passed
+ */
+void MIL_TOPIC_Tick(uint32_t now, uint32_t ticks_per_s);
+
+/*
+ * Desc: Walks every topic, 0 gives the first, returns 0 after the last
+ */
+MIL_TOPIC *MIL_TOPIC_Next(const MIL_TOPIC *pTopic);
+
+const char *MIL_TOPIC_Name(const MIL_TOPIC *pTopic);
+void MIL_TOPIC_StatsGet(const MIL_TOPIC *pTopic, MIL_TOPIC_Stats *pStats);
+void MIL_TOPIC_SubStatsGet(const MIL_TOPIC_Sub *pSub, MIL_TOPIC_SubStats *pStats);
+
+#endif /* MIL_TOPIC_H_ */
@@ -0,0 +1,255 @@
+/*
+ * Name: MIL_TXQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Priority classes for bytes waiting to go out one UART
+ *
+ * Implementation Notes:
+ *       Each class is a byte ring. A frame goes in as a header then its
+ *       data:
+ *
+ *          [len][push time u32][data]
+ *
+ *       Push writes the whole frame before moving head, so Next never sees
+ *       half a frame. Next moves tail a byte at a time, so space comes back
+ *       as the frame drains rather than when it ends
+ *
+ *       Classes are only picked between frames, once a frame starts it
+ *       runs to the end even if a higher class fills up meanwhile
+ *
+ *       The token bucket counts credit in ticks: every tick that passes is
+ *       a tick of credit, every byte costs byte_ticks. Credit is only added
+ *       when Next looks at the class, capped at burst bytes worth
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_TXQ.h"
+
+#define BUF_MASK (MIL_TXQ_BUF_LEN - 1)
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static void Refill(MIL_TXQ_Class *pC, uint32_t now){
+
+    uint32_t elapsed = now - pC->refill_time;
+    pC->refill_time = now;
+
+    if(pC->credit_max - pC->credit <= elapsed){ pC->credit = pC->credit_max; }
+    else{ pC->credit += elapsed; }
+
+}
+
+static uint32_t Get32(const MIL_TXQ_Class *pC, uint16_t at){
+
+    return (uint32_t)pC->buf[at & BUF_MASK] |
+           ((uint32_t)pC->buf[(uint16_t)(at + 1) & BUF_MASK] << 8) |
+           ((uint32_t)pC->buf[(uint16_t)(at + 2) & BUF_MASK] << 16) |
+           ((uint32_t)pC->buf[(uint16_t)(at + 3) & BUF_MASK] << 24);
+
+}
+
+//starts the frame at the front of a class if its rate limit allows
+static bool Start(MIL_TXQ *pQ, uint8_t cls, uint32_t now){
+
+    MIL_TXQ_Class *pC = &pQ->cls[cls];
+    uint16_t tail = pC->tail;
+
+    if(tail == pC->head){ return false; }
+
+    uint8_t len = pC->buf[tail & BUF_MASK];
+
+    if(pC->byte_ticks){
+
+        uint32_t cost = len * pC->byte_ticks;
+
+        Refill(pC, now);
+
+        if(pC->credit < cost){
+
+            if(!pC->waiting){ pC->throttled++; pC->waiting = true; }
+            return false;
+
+        }
+
+        pC->credit -= cost;
+        pC->waiting = false;
+
+    }
+
+    uint32_t latency = now - Get32(pC, tail + 1);
+
+    pC->lat_last = latency;
+    if(latency > pC->lat_max){ pC->lat_max = latency; }
+    pC->lat_total += latency;
+    pC->lat_frames++;
+
+    pC->frames++;
+    pC->bytes += len;
+
+    pC->tail = tail + MIL_TXQ_HEADER_LEN;
+    pQ->cur = (int8_t)cls;
+    pQ->cur_left = len;
+
+    return true;
+
+}
+
+/************************PUBLIC FUNCTIONS******************************/
+
+void MIL_TXQ_Init(MIL_TXQ *pQ, uint32_t now){
+
+    for(uint8_t c = 0; c < MIL_TXQ_CLASSES; c++){
+
+        MIL_TXQ_Class *pC = &pQ->cls[c];
+
+        pC->head = 0;
+        pC->tail = 0;
+        pC->byte_ticks = 0;
+        pC->credit_max = 0;
+        pC->credit = 0;
+        pC->refill_time = now;
+        pC->waiting = false;
+        pC->frames = 0;
+        pC->bytes = 0;
+        pC->throttled = 0;
+        pC->dropped = 0;
+        MIL_TXQ_LatencyReset(pQ, c);
+
+    }
+
+    pQ->cur = -1;
+    pQ->cur_left = 0;
+
+}
+
+void MIL_TXQ_RateSet(MIL_TXQ *pQ, uint8_t cls, uint32_t byte_ticks, uint16_t burst, uint32_t now){
+
+    if(cls >= MIL_TXQ_CLASSES){ return; }
+
+    MIL_TXQ_Class *pC = &pQ->cls[cls];
+
+    //a frame bigger than the bucket could never start
+    if(burst < MIL_TXQ_MAX_FRAME){ burst = MIL_TXQ_MAX_FRAME; }
+
+    //keep burst * byte_ticks inside 32 bits
+    if(byte_ticks > UINT32_MAX / burst){ byte_ticks = UINT32_MAX / burst; }
+
+    pC->byte_ticks = byte_ticks;
+    pC->credit_max = byte_ticks * burst;
+    pC->credit = pC->credit_max;
+    pC->refill_time = now;
+    pC->waiting = false;
+
+}
+
+bool MIL_TXQ_Push(MIL_TXQ *pQ, uint8_t cls, const uint8_t *pData, uint16_t len, uint32_t now){
+
+    if(cls >= MIL_TXQ_CLASSES || len == 0 || len > MIL_TXQ_MAX_FRAME){ return false; }
+
+    MIL_TXQ_Class *pC = &pQ->cls[cls];
+
+    if(MIL_TXQ_Space(pQ, cls) < len + MIL_TXQ_HEADER_LEN){
+
+        pC->dropped++;
+        return false;
+
+    }
+
+    uint16_t head = pC->head;
+
+    pC->buf[head & BUF_MASK] = (uint8_t)len;
+    pC->buf[(uint16_t)(head + 1) & BUF_MASK] = (uint8_t)now;
+    pC->buf[(uint16_t)(head + 2) & BUF_MASK] = (uint8_t)(now >> 8);
+    pC->buf[(uint16_t)(head + 3) & BUF_MASK] = (uint8_t)(now >> 16);
+    pC->buf[(uint16_t)(head + 4) & BUF_MASK] = (uint8_t)(now >> 24);
+
+    for(uint16_t i = 0; i < len; i++){
+
+        pC->buf[(uint16_t)(head + MIL_TXQ_HEADER_LEN + i) & BUF_MASK] = pData[i];
+
+    }
+
+    //the whole frame is in before Next can see it
+    pC->head = head + MIL_TXQ_HEADER_LEN + len;
+
+    return true;
+
+}
+
+uint16_t MIL_TXQ_Space(const MIL_TXQ *pQ, uint8_t cls){
+
+    if(cls >= MIL_TXQ_CLASSES){ return 0; }
+
+    const MIL_TXQ_Class *pC = &pQ->cls[cls];
+
+    return (uint16_t)(MIL_TXQ_BUF_LEN - (uint16_t)(pC->head - pC->tail));
+
+}
+
+int16_t MIL_TXQ_Next(MIL_TXQ *pQ, uint32_t now){
+
+    if(pQ->cur < 0){
+
+        uint8_t c = 0;
+
+        while(c < MIL_TXQ_CLASSES && !Start(pQ, c, now)){ c++; }
+
+        if(c == MIL_TXQ_CLASSES){ return -1; }
+
+    }
+
+    MIL_TXQ_Class *pC = &pQ->cls[pQ->cur];
+    uint16_t tail = pC->tail;
+    uint8_t data = pC->buf[tail & BUF_MASK];
+
+    pC->tail = tail + 1;
+
+    if(--pQ->cur_left == 0){ pQ->cur = -1; }
+
+    return data;
+
+}
+
+bool MIL_TXQ_Empty(const MIL_TXQ *pQ){
+
+    if(pQ->cur >= 0){ return false; }
+
+    for(uint8_t c = 0; c < MIL_TXQ_CLASSES; c++){
+
+        if(pQ->cls[c].head != pQ->cls[c].tail){ return false; }
+
+    }
+
+    return true;
+
+}
+
+void MIL_TXQ_StatsGet(const MIL_TXQ *pQ, uint8_t cls, MIL_TXQ_Stats *pStats){
+
+    if(cls >= MIL_TXQ_CLASSES){ return; }
+
+    const MIL_TXQ_Class *pC = &pQ->cls[cls];
+
+    pStats->frames = pC->frames;
+    pStats->bytes = pC->bytes;
+    pStats->dropped = pC->dropped;
+    pStats->throttled = pC->throttled;
+    pStats->lat_last = pC->lat_last;
+    pStats->lat_max = pC->lat_max;
+    pStats->lat_avg = pC->lat_frames ? (uint32_t)(pC->lat_total / pC->lat_frames) : 0;
+
+}
+
+void MIL_TXQ_LatencyReset(MIL_TXQ *pQ, uint8_t cls){
+
+    if(cls >= MIL_TXQ_CLASSES){ return; }
+
+    MIL_TXQ_Class *pC = &pQ->cls[cls];
+
+    pC->lat_last = 0;
+    pC->lat_max = 0;
+    pC->lat_total = 0;
+    pC->lat_frames = 0;
+
+}
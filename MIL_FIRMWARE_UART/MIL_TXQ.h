@@ -0,0 +1,192 @@
+/*
+ * Name: MIL_TXQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Priority classes for bytes waiting to go out one UART,
+ *       the scheduling half of MIL_UARTQ
+ *
+ * What to understand: Plain MIL_UART_OutArray sends in the order things were
+ *                     written, so a short control reply written after a big
+ *                     log dump waits for the whole dump to leave first
+ *
+ *                     MIL_TXQ keeps one queue per class instead. Each time
+ *                     a frame finishes, the next one comes from the highest
+ *                     class(lowest number) that has something waiting, so
+ *                     a control reply only ever waits for the one frame that
+ *                     was already going out
+ *
+ *                     Frames are never cut up or mixed, the receiver still
+ *                     sees whole frames, just in a different order
+ *
+ *                     A class can also be rate limited with a token bucket:
+ *                     it earns credit at its rate, up to its burst, and a
+ *                     frame only starts if the class has credit for all of
+ *                     it. This keeps logging from using the whole line even
+ *                     when nothing more important is waiting
+ *
+ *                     tools/txq_sim.c floods a simulated UART with log frames
+ *                     and measures how long a control frame waits with one class,
+ *                     with priorities and with the logs rate limited
+ *
+ * Time Note:
+ *      Every function takes now, a free running 32 bit tick count.
+ *      On the board that is MIL_TIME cycles
+ *
+ * Latency Note:
+ *      Queue latency is from MIL_TXQ_Push to the frame's first byte leaving
+ *      MIL_TXQ. The worst a class waits for lower classes is one of their
+ *      frames, so keep bulk frames short(a log line, not a whole buffer) if
+ *      control latency matters
+ *
+ * Thread Note:
+ *      Each class has one writer(MIL_TXQ_Push) and one reader(MIL_TXQ_Next),
+ *      neither needs a lock. Don't push to the same class from main and
+ *      an ISR without a MIL_INT critical section around the push
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_CONFIG.h"
+
+#ifndef MIL_TXQ_H_
+#define MIL_TXQ_H_
+
+//number of classes, class 0 goes first
+#ifndef MIL_TXQ_CLASSES
+#define MIL_TXQ_CLASSES 3
+#endif
+
+#define MIL_TXQ_CONTROL 0
+#define MIL_TXQ_NORMAL  1
+#define MIL_TXQ_BULK    2
+
+//power of 2, bytes queued per class including a 5 byte header per frame
+#ifndef MIL_TXQ_BUF_LEN
+#define MIL_TXQ_BUF_LEN 512
+#endif
+
+#define MIL_TXQ_MAX_FRAME 255
+#define MIL_TXQ_HEADER_LEN 5
+
+/*
+ * Desc: counters for one class
+ *
+ *       frames, bytes: sent
+ *       dropped:       frames refused by MIL_TXQ_Push because the queue was full
+ *       throttled:     frames that had to wait for rate limit credit
+ *       lat_last:      queue latency of the last frame started(ticks)
+ *       lat_max:       worst queue latency since the last reset(ticks)
+ *       lat_avg:       average queue latency since the last reset(ticks)
+ */
+typedef struct{
+
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t dropped;
+    uint32_t throttled;
+    uint32_t lat_last;
+    uint32_t lat_max;
+    uint32_t lat_avg;
+
+}MIL_TXQ_Stats;
+
+/*
+ * Desc: one class, all fields are private
+ */
+typedef struct{
+
+    uint8_t  buf[MIL_TXQ_BUF_LEN];
+    volatile uint16_t head;     //Push writes
+    volatile uint16_t tail;     //Next reads
+
+    //token bucket, credit is kept in ticks so nothing needs dividing
+    uint32_t byte_ticks;        //cost of one byte, 0 is unlimited
+    uint32_t credit_max;
+    uint32_t credit;
+    uint32_t refill_time;
+    bool     waiting;           //current frame already counted as throttled
+
+    //Next side counters
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t throttled;
+    uint32_t lat_last;
+    uint32_t lat_max;
+    uint64_t lat_total;
+    uint32_t lat_frames;
+
+    //Push side counter
+    uint32_t dropped;
+
+}MIL_TXQ_Class;
+
+/*
+ * Desc: all the classes for one UART, all fields are private
+ */
+typedef struct{
+
+    MIL_TXQ_Class cls[MIL_TXQ_CLASSES];
+
+    int8_t   cur;               //class of the frame going out, -1 between frames
+    uint16_t cur_left;          //its bytes still to go
+
+}MIL_TXQ;
+
+/*
+ * Desc: Empties every class and removes rate limits
+ */
+void MIL_TXQ_Init(MIL_TXQ *pQ, uint32_t now);
+
+/*
+ * Desc: Rate limits one class
+ *
+ * Parameters:
+ *       pQ: the queues
+ *       cls: class number
+ *       byte_ticks: ticks each byte costs(clock / bytes per second),
+ *                   0 removes the limit
+ *       burst: bytes the class can send back to back after a quiet spell,
+ *              never less than MIL_TXQ_MAX_FRAME so every frame can go
+ *       now: current tick
+ */
+void MIL_TXQ_RateSet(MIL_TXQ *pQ, uint8_t cls, uint32_t byte_ticks, uint16_t burst, uint32_t now);
+
+/*
+ * Desc: Queues one frame, copied so the caller can reuse it
+ *
+ * Returns: false if the class is full or len is 0 or over MIL_TXQ_MAX_FRAME
+ */
+bool MIL_TXQ_Push(MIL_TXQ *pQ, uint8_t cls, const uint8_t *pData, uint16_t len, uint32_t now);
+
+/*
+ * Desc: Bytes MIL_TXQ_Push can take for a class right now,
+ *       including the frame header
+ */
+uint16_t MIL_TXQ_Space(const MIL_TXQ *pQ, uint8_t cls);
+
+/*
+ * Desc: Takes the next byte to put on the wire
+ *
+ * Returns: the byte, or -1 if nothing can go yet(all empty, or everything
+ *          waiting is rate limited)
+ */
+int16_t MIL_TXQ_Next(MIL_TXQ *pQ, uint32_t now);
+
+/*
+ * Desc: true if nothing is queued or going out
+ */
+bool MIL_TXQ_Empty(const MIL_TXQ *pQ);
+
+/*
+ * Desc: copies out one class's counters
+ */
+void MIL_TXQ_StatsGet(const MIL_TXQ *pQ, uint8_t cls, MIL_TXQ_Stats *pStats);
+
+/*
+ * Desc: clears the latency figures of one class so lat_max
+ *       covers a fresh period, the other counters keep counting
+ */
+void MIL_TXQ_LatencyReset(MIL_TXQ *pQ, uint8_t cls);
+
+#endif /* MIL_TXQ_H_ */
@@ -67,20 +67,88 @@
  */
 #include <stdbool.h>
 #include <stdint.h>
-#include "inc/hw_can.h"
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
-#include "driverlib/can.h"
 #include "driverlib/gpio.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
-#include "utils/uartstdio.h"
 
+#include "MIL_CONFIG.h"
+#include "MIL_INT.h"
+#if MIL_UART_SOFT_EN
+#include "MIL_SUART.h"
+#endif
+#if MIL_UART_CAPTURE_EN
+#include "MIL_CAP.h"
+#endif
 #include"MIL_UART.h"
 
+#define NUM_UARTS 8
+
+#if MIL_UART_SOFT_EN
+//set by MIL_SUART_Init, MIL_SUART.h is only here for the base macros
+static const MIL_UART_SoftOps *pSoftOps = 0;
+#endif
+
+static volatile MIL_UART_Stats STATS[NUM_UARTS];
+
+/*
+ * Desc: a hardware UART's counters, 0 for anything else
+ *       UARTx_BASE are 4KB apart starting at UART0_BASE
+ */
+static volatile MIL_UART_Stats *StatsFor(uint32_t base){
+
+    uint32_t index = (base - UART0_BASE) >> 12;
+
+    if(index >= NUM_UARTS || base != UART0_BASE + (index << 12)){ return 0; }
+
+    return &STATS[index];
+
+}
+
+/*
+ * Desc: returns the clock gates a UART and its pins need
+ *       false for an invalid base
+ */
+static bool UARTPeriphGet(uint32_t base, uint32_t *pUART, uint32_t *pGPIO){
+
+    switch(base){
+
+#if MIL_UART0_EN
+        case UART0_BASE: *pUART = SYSCTL_PERIPH_UART0; *pGPIO = SYSCTL_PERIPH_GPIOA; break;
+#endif
+#if MIL_UART1_EN
+        case UART1_BASE: *pUART = SYSCTL_PERIPH_UART1; *pGPIO = SYSCTL_PERIPH_GPIOB; break;
+#endif
+#if MIL_UART2_EN
+        case UART2_BASE: *pUART = SYSCTL_PERIPH_UART2; *pGPIO = SYSCTL_PERIPH_GPIOD; break;
+#endif
+#if MIL_UART3_EN
+        case UART3_BASE: *pUART = SYSCTL_PERIPH_UART3; *pGPIO = SYSCTL_PERIPH_GPIOC; break;
+#endif
+#if MIL_UART4_EN
+        case UART4_BASE: *pUART = SYSCTL_PERIPH_UART4; *pGPIO = SYSCTL_PERIPH_GPIOC; break;
+#endif
+#if MIL_UART5_EN
+        case UART5_BASE: *pUART = SYSCTL_PERIPH_UART5; *pGPIO = SYSCTL_PERIPH_GPIOE; break;
+#endif
+#if MIL_UART6_EN
+        case UART6_BASE: *pUART = SYSCTL_PERIPH_UART6; *pGPIO = SYSCTL_PERIPH_GPIOD; break;
+#endif
+#if MIL_UART7_EN
+        case UART7_BASE: *pUART = SYSCTL_PERIPH_UART7; *pGPIO = SYSCTL_PERIPH_GPIOE; break;
+#endif
+        default: return false;
+
+    };
+
+    return true;
+
+}
+
 /*
  * Desc: Enables a specified UART base
  *       at a specified baud rate
@@ -107,90 +175,159 @@
  */
 void MIL_InitUART(uint32_t base,uint32_t baud_rate){
 
+    MIL_UART_ClockEnable(base);
+
+    //registers can't be touched until the clock gate is actually open
+    while(!MIL_UART_ClockReady(base));
+
+    MIL_UART_Config(base, baud_rate);
+
+}
+
+/*
+ * Desc: Turns on the clocks for a UART and its GPIO port
+ *       without waiting for them
+ *
+ * Parameters:
+ *            base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ */
+void MIL_UART_ClockEnable(uint32_t base){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ if(pSoftOps){ pSoftOps->pClockEnable(base); } return; }
+#endif
+
+    uint32_t uart_periph;
+    uint32_t gpio_periph;
+
+    if(!UARTPeriphGet(base, &uart_periph, &gpio_periph)){ return; }
+
+    SysCtlPeripheralEnable(uart_periph);
+    SysCtlPeripheralEnable(gpio_periph);
+
+}
+
+/*
+ * Desc: Checks if the clocks turned on by MIL_UART_ClockEnable
+ *       are ready
+ *
+ * Parameters:
+ *            base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ */
+bool MIL_UART_ClockReady(uint32_t base){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ return pSoftOps ? pSoftOps->pClockReady(base) : true; }
+#endif
+
+    uint32_t uart_periph;
+    uint32_t gpio_periph;
+
+    if(!UARTPeriphGet(base, &uart_periph, &gpio_periph)){ return true; }
+
+    return SysCtlPeripheralReady(uart_periph) && SysCtlPeripheralReady(gpio_periph);
+
+}
+
+/*
+ * Desc: Sets up the pins and line settings of a UART whose
+ *       clocks are already ready, the second half of MIL_InitUART
+ *
+ * Parameters:
+ *            base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *            baud_rate: your communication speed(see MIL_BAUD defines)
+ */
+void MIL_UART_Config(uint32_t base,uint32_t baud_rate){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ if(pSoftOps){ pSoftOps->pConfig(base, baud_rate); } return; }
+#endif
+
     switch(base){
 
+#if MIL_UART0_EN
         //RX :  PA0
         //TX :  PA1
         case UART0_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
             GPIOPinConfigure(GPIO_PA0_U0RX);
             GPIOPinConfigure(GPIO_PA1_U0TX);
             GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
             break;
+#endif
 
+#if MIL_UART1_EN
         //RX :  PB0
         //TX :  PB1
         case UART1_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART1);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
             GPIOPinConfigure(GPIO_PB0_U1RX);
             GPIOPinConfigure(GPIO_PB1_U1TX);
             GPIOPinTypeUART(GPIO_PORTB_BASE, GPIO_PIN_0 | GPIO_PIN_1);
             break;
+#endif
 
+#if MIL_UART2_EN
         //RX :  PD6
         //TX :  PD7
         case UART2_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART2);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOD);
             GPIOPinConfigure(GPIO_PD6_U2RX);
             GPIOPinConfigure(GPIO_PD7_U2TX);
             GPIOPinTypeUART(GPIO_PORTD_BASE, GPIO_PIN_6 | GPIO_PIN_7);
             break;
+#endif
 
+#if MIL_UART3_EN
         //RX :  PC6
         //TX :  PC7
         case UART3_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART3);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
             GPIOPinConfigure(GPIO_PC6_U3RX);
             GPIOPinConfigure(GPIO_PC7_U3TX);
             GPIOPinTypeUART(GPIO_PORTC_BASE, GPIO_PIN_6 | GPIO_PIN_7);
             break;
+#endif
 
+#if MIL_UART4_EN
         //RX :  PC4
         //TX :  PC5
         case UART4_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART4);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
             GPIOPinConfigure(GPIO_PC4_U4RX);
             GPIOPinConfigure(GPIO_PC5_U4TX);
             GPIOPinTypeUART(GPIO_PORTC_BASE, GPIO_PIN_4 | GPIO_PIN_5);
             break;
+#endif
 
+#if MIL_UART5_EN
         //RX :  PE4
         //TX :  PE5
         case UART5_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART5);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
             GPIOPinConfigure(GPIO_PE4_U5RX);
             GPIOPinConfigure(GPIO_PE5_U5TX);
             GPIOPinTypeUART(GPIO_PORTE_BASE, GPIO_PIN_4 | GPIO_PIN_5);
             break;
+#endif
 
+#if MIL_UART6_EN
         //RX :  PD4
         //TX :  PD5
         case UART6_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART6);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOD);
             GPIOPinConfigure(GPIO_PD4_U6RX);
             GPIOPinConfigure(GPIO_PD5_U6TX);
             GPIOPinTypeUART(GPIO_PORTD_BASE, GPIO_PIN_4 | GPIO_PIN_5);
             break;
+#endif
 
+#if MIL_UART7_EN
         //RX :  PE0
         //TX :  PE1
         case UART7_BASE:
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_UART7);
-            SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
             GPIOPinConfigure(GPIO_PE0_U7RX);
             GPIOPinConfigure(GPIO_PE1_U7TX);
             GPIOPinTypeUART(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1);
             break;
+#endif
 
+        //not a UART, or compiled out in MIL_CONFIG.h
         default:
-            break;
+            return;
 
     };
 
@@ -205,10 +342,13 @@ void MIL_InitUART(uint32_t base,uint32_t baud_rate){
 
     UARTFIFODisable(base);
 
+    MIL_UART_StatsReset(base);
 
 
 }
 
+#if MIL_UART_ISR_EN
+
 /*
  * Desc: This function will enable specified interrupts
  *       for the specified module
@@ -227,16 +367,82 @@ void MIL_InitUART(uint32_t base,uint32_t baud_rate){
  *                             an RX interrupt. So this is the only one I
  *                             recommend setting ,but everything is based on
  *                             the needs of the project
+ *
+ *        PRIORITY NOTE: the interrupt is set to MIL_INT_PRI_UART so
+ *                       timer and GPIO ISRs can interrupt a long UART ISR
  */
 void MIL_UART_InitISR(uint32_t base,uint32_t int_flags,void (*pISR)(void)){
 
+#if MIL_UART_SOFT_EN
+    //software ports call pISR from their own timer ISR
+    if(MIL_SUART_IS_SOFT(base)){ if(pSoftOps){ pSoftOps->pISRSet(base, int_flags, pISR); } return; }
+#endif
+
     /*INTERRUPTS*/
     //Peripheral Interrupt configs
     UARTIntEnable(base,int_flags);
     UARTIntRegister(base, pISR);
 
+    //UART sits below timers and GPIO in the MIL priority plan(see MIL_INT.h)
+    MIL_UART_ISRPrioritySet(base, MIL_INT_PRI_UART);
+
 }
 
+/*
+ * Desc: Changes the NVIC priority of a UART interrupt
+ *       MIL_UART_InitISR already sets MIL_INT_PRI_UART, only
+ *       call this if a UART needs to be treated differently
+ *
+ * Parameters:
+ *        base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *        priority: one of the MIL_INT_PRI defines
+ */
+void MIL_UART_ISRPrioritySet(uint32_t base, uint8_t priority){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ if(pSoftOps){ pSoftOps->pISRPrioritySet(base, priority); } return; }
+#endif
+
+    uint32_t interrupt;
+
+    switch(base){
+
+#if MIL_UART0_EN
+        case UART0_BASE: interrupt = INT_UART0; break;
+#endif
+#if MIL_UART1_EN
+        case UART1_BASE: interrupt = INT_UART1; break;
+#endif
+#if MIL_UART2_EN
+        case UART2_BASE: interrupt = INT_UART2; break;
+#endif
+#if MIL_UART3_EN
+        case UART3_BASE: interrupt = INT_UART3; break;
+#endif
+#if MIL_UART4_EN
+        case UART4_BASE: interrupt = INT_UART4; break;
+#endif
+#if MIL_UART5_EN
+        case UART5_BASE: interrupt = INT_UART5; break;
+#endif
+#if MIL_UART6_EN
+        case UART6_BASE: interrupt = INT_UART6; break;
+#endif
+#if MIL_UART7_EN
+        case UART7_BASE: interrupt = INT_UART7; break;
+#endif
+        default: return;
+
+    };
+
+    IntPrioritySet(interrupt, priority);
+
+}
+
+#endif
+
+#if MIL_UART_FIFO_EN
+
 /*
  * Desc: FIFO is disabled by default in MIL_InitUART
  *       this function enables it and allows you to
@@ -257,6 +463,11 @@ void MIL_UART_InitISR(uint32_t base,uint32_t int_flags,void (*pISR)(void)){
  */
 void MIL_UART_FIFOEn(uint32_t base, uint8_t int_depth){
 
+#if MIL_UART_SOFT_EN
+    //software ports are always buffered
+    if(MIL_SUART_IS_SOFT(base)){ return; }
+#endif
+
     uint32_t rxlevel;
     uint32_t txlevel;
     if(int_depth >= 7){
@@ -295,6 +506,10 @@ void MIL_UART_FIFOEn(uint32_t base, uint8_t int_depth){
     UARTFIFOEnable(base);
 }
 
+#endif
+
+#if MIL_UART_LOG_EN
+
 /*
  * Desc: send out a an array of data a predefined length
  *
@@ -306,7 +521,7 @@ void MIL_UART_FIFOEn(uint32_t base, uint8_t int_depth){
  */
 void MIL_UART_OutArray(uint32_t base, uint8_t *pMsg,uint8_t len){
 
-    for(uint8_t i = 0; i < len;i++){ UARTCharPut(base,pMsg[i]);}
+    for(uint8_t i = 0; i < len;i++){ MIL_UART_CharPut(base,pMsg[i]);}
 
 }
 
@@ -328,8 +543,143 @@ void MIL_UART_OutArray(uint32_t base, uint8_t *pMsg,uint8_t len){
  */
 void MIL_UART_OutCString(uint32_t base, uint8_t *pMsg){
 
-    do{ UARTCharPut(base,*pMsg); pMsg++;}while(*pMsg);
+    do{ MIL_UART_CharPut(base,*pMsg); pMsg++;}while(*pMsg);
 
 }
 
+#endif
+
+/*
+ * Desc: UARTCharPut for any MIL_UART base, hardware or software
+ *       waits while the port can't take another byte
+ */
+void MIL_UART_CharPut(uint32_t base, uint8_t data){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ if(pSoftOps){ pSoftOps->pCharPut(base, data); } }
+    else{ UARTCharPut(base, data); }
+#else
+    UARTCharPut(base, data);
+#endif
+
+    volatile MIL_UART_Stats *pStats = StatsFor(base);
+    if(pStats){ pStats->tx_bytes++; }
+
+#if MIL_UART_CAPTURE_EN
+    MIL_CAP_Record(base, true, data);
+#endif
+
+}
+
+/*
+ * Desc: UARTCharGetNonBlocking for any MIL_UART base
+ *       returns -1 if no byte is waiting
+ */
+int32_t MIL_UART_CharGetNonBlocking(uint32_t base){
+
+    int32_t data;
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ data = pSoftOps ? pSoftOps->pCharGetNonBlocking(base) : -1; }
+    else{ data = UARTCharGetNonBlocking(base); }
+#else
+    data = UARTCharGetNonBlocking(base);
+#endif
+
+    volatile MIL_UART_Stats *pStats = StatsFor(base);
+
+    if(pStats && data >= 0){
+
+        //the flags driverlib leaves above the byte
+        uint8_t error = (uint8_t)((data >> 8) & 0x0F);
+
+        pStats->rx_bytes++;
+
+        if(error & UART_RXERROR_OVERRUN){ pStats->overruns++; }
+        else if(error){ pStats->errors++; }
+
+    }
+
+#if MIL_UART_CAPTURE_EN
+    if(data >= 0){ MIL_CAP_Record(base, false, (uint8_t)data); }
+#endif
+
+    return data;
+
+}
+
+/*
+ * Desc: UARTCharGet for any MIL_UART base, waits for a byte
+ */
+uint8_t MIL_UART_CharGet(uint32_t base){
+
+    int32_t data;
+
+    while((data = MIL_UART_CharGetNonBlocking(base)) < 0);
+
+    return (uint8_t)data;
+
+}
+
+/*
+ * Desc: UARTCharsAvail for any MIL_UART base
+ */
+bool MIL_UART_CharsAvail(uint32_t base){
+
+#if MIL_UART_SOFT_EN
+    if(MIL_SUART_IS_SOFT(base)){ return pSoftOps && pSoftOps->pCharsAvail(base); }
+#endif
+
+    return UARTCharsAvail(base);
+
+}
+
+/*
+ * Desc: Copies out a hardware UART's counters, zeros for anything else
+ */
+void MIL_UART_StatsGet(uint32_t base, MIL_UART_Stats *pStats){
+
+    volatile MIL_UART_Stats *pS = StatsFor(base);
+
+    if(!pS){
+
+        pStats->rx_bytes = 0;
+        pStats->tx_bytes = 0;
+        pStats->overruns = 0;
+        pStats->errors = 0;
+        return;
+
+    }
+
+    //no lock, MIL_UART stays free of MIL_INT.c and each counter is one word
+    pStats->rx_bytes = pS->rx_bytes;
+    pStats->tx_bytes = pS->tx_bytes;
+    pStats->overruns = pS->overruns;
+    pStats->errors = pS->errors;
+
+}
+
+void MIL_UART_StatsReset(uint32_t base){
+
+    volatile MIL_UART_Stats *pS = StatsFor(base);
+    if(!pS){ return; }
+
+    pS->rx_bytes = 0;
+    pS->tx_bytes = 0;
+    pS->overruns = 0;
+    pS->errors = 0;
+
+}
+
+#if MIL_UART_SOFT_EN
+
+/*
+ * Desc: Sends software bases to pOps, see MIL_SUART_Init
+ */
+void MIL_UART_SoftRegister(const MIL_UART_SoftOps *pOps){
+
+    pSoftOps = pOps;
+
+}
 
+#endif
@@ -64,11 +64,39 @@
  *            WE'RE MISSING ONE POSSIBLE
  *            UART PIN SET, UART1 CAN ALSO USE PC4/PC5 AS RX/TX
  *            WHICH IS ALSO USED BY UART4
+ *
+ * Software UART Note:
+ *      Every function here also takes MIL_SUART0_BASE and MIL_SUART1_BASE,
+ *      extra ports bit banged on GPIO pins(see MIL_SUART.h for pins and
+ *      limits). Use the MIL_UART_Char functions instead of the driverlib
+ *      UARTChar ones if code should work on both kinds of port
+ *
+ *      MIL_UART never calls MIL_SUART by name, MIL_SUART_Init hands it a
+ *      table of functions instead. Call MIL_SUART_Init once before
+ *      MIL_InitUART on a software port, projects without software ports
+ *      don't need MIL_SUART.c at all. Until then a software base acts
+ *      like an invalid one
+ *
+ * Config Note:
+ *      UARTs and features you don't use can be compiled out in
+ *      MIL_CONFIG.h. A UART that is compiled out is treated like an
+ *      invalid base, a feature that is compiled out has no function
+ *
+ *      With MIL_UART_CAPTURE_EN on, every byte through MIL_UART_CharPut
+ *      and MIL_UART_CharGet(NonBlocking) is also recorded by MIL_CAP
+ *
+ * Stats Note:
+ *      Each hardware UART counts the bytes through MIL_UART_CharPut and
+ *      MIL_UART_CharGet(NonBlocking), and the error flags received bytes
+ *      came with. Drivers that move bytes in their own ISR count them
+ *      themselves. MIL_UART doesn't register with MIL_STAT, so MIL_STAT.c
+ *      stays optional, MIL_STAT_RegisterUART does it from the MIL_STAT side
  */
 
 #include "driverlib/uart.h"
-#include "utils/uartstdio.h"
+#include "MIL_CONFIG.h"
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifndef MIL_UART_H_
 #define MIL_UART_H_
@@ -135,6 +163,27 @@
  */
 void MIL_InitUART(uint32_t base,uint32_t baud_rate);
 
+/*
+ * Desc: MIL_InitUART is split in two halves so several
+ *       peripherals can be started at once(see MIL_START)
+ *
+ *       MIL_UART_ClockEnable turns on the UART and GPIO port
+ *       clocks without waiting, MIL_UART_ClockReady says when they
+ *       are up and MIL_UART_Config does the rest of MIL_InitUART
+ *
+ *       DON'T call MIL_UART_Config before MIL_UART_ClockReady
+ *       returns true, touching a peripheral that isn't clocked
+ *       yet causes a bus fault
+ *
+ * Parameters:
+ *            base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *            baud_rate: your communication speed(see MIL_BAUD defines)
+ */
+void MIL_UART_ClockEnable(uint32_t base);
+bool MIL_UART_ClockReady(uint32_t base);
+void MIL_UART_Config(uint32_t base,uint32_t baud_rate);
+
+#if MIL_UART_ISR_EN
 /*
  * Desc: This function will enable specified interrupts
  *       for the specified module
@@ -153,9 +202,25 @@ void MIL_InitUART(uint32_t base,uint32_t baud_rate);
  *                             an RX interrupt. So this is the only one I
  *                             recommend setting ,but everything is based on
  *                             the needs of the project
+ *
+ *        PRIORITY NOTE: the interrupt is set to MIL_INT_PRI_UART so
+ *                       timer and GPIO ISRs can interrupt a long UART ISR
  */
 void MIL_UART_InitISR(uint32_t base,uint32_t int_flags,void (*pISR)(void));
 
+/*
+ * Desc: Changes the NVIC priority of a UART interrupt
+ *       MIL_UART_InitISR already sets MIL_INT_PRI_UART, only
+ *       call this if a UART needs to be treated differently
+ *
+ * Parameters:
+ *        base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *        priority: one of the MIL_INT_PRI defines(see MIL_INT.h)
+ */
+void MIL_UART_ISRPrioritySet(uint32_t base, uint8_t priority);
+#endif
+
+#if MIL_UART_FIFO_EN
 /*
  * Desc: FIFO is disabled by default in MIL_InitUART
  *       this function enables it and allows you to
@@ -175,7 +240,9 @@ void MIL_UART_InitISR(uint32_t base,uint32_t int_flags,void (*pISR)(void));
  *
  */
 void MIL_UART_FIFOEn(uint32_t base, uint8_t int_depth);
+#endif
 
+#if MIL_UART_LOG_EN
 /*
  * Desc: send out a an array of data a predefined length
  *
@@ -202,6 +269,69 @@ void MIL_UART_OutArray(uint32_t base, uint8_t *pMsg,uint8_t len);
  * pMsg : a pointer to your data(note arrays in C are pointers)
  */
 void MIL_UART_OutCString(uint32_t base, uint8_t *pMsg);
+#endif
 
+/*
+ * Desc: The driverlib UARTChar functions for any MIL_UART base,
+ *       hardware UARTx_BASE or software MIL_SUARTx_BASE
+ *
+ *       MIL_UART_CharPut waits while the port is full
+ *       MIL_UART_CharGet waits for a byte
+ *       MIL_UART_CharGetNonBlocking returns -1 if no byte is waiting
+ */
+void MIL_UART_CharPut(uint32_t base, uint8_t data);
+uint8_t MIL_UART_CharGet(uint32_t base);
+int32_t MIL_UART_CharGetNonBlocking(uint32_t base);
+bool MIL_UART_CharsAvail(uint32_t base);
+
+/*
+ * Desc: per hardware UART counters, reset by MIL_UART_Config
+ *
+ *       rx_bytes, tx_bytes: bytes through the MIL_UART_Char functions
+ *       overruns:           bytes received with the overrun flag, bytes
+ *                           before them were lost in the FIFO
+ *       errors:             bytes received with a framing, parity or
+ *                           break error
+ */
+typedef struct{
+
+    uint32_t rx_bytes;
+    uint32_t tx_bytes;
+    uint32_t overruns;
+    uint32_t errors;
+
+}MIL_UART_Stats;
+
+/*
+ * Desc: copies out or clears a UART's counters, all zero for
+ *       software and invalid bases
+ */
+void MIL_UART_StatsGet(uint32_t base, MIL_UART_Stats *pStats);
+void MIL_UART_StatsReset(uint32_t base);
+
+#if MIL_UART_SOFT_EN
+/*
+ * Desc: what MIL_UART calls for a MIL_SUARTx_BASE, one function per
+ *       MIL_UART function that takes a base
+ */
+typedef struct{
+
+    void    (*pClockEnable)(uint32_t base);
+    bool    (*pClockReady)(uint32_t base);
+    void    (*pConfig)(uint32_t base, uint32_t baud_rate);
+    void    (*pISRSet)(uint32_t base, uint32_t int_flags, void (*pISR)(void));
+    void    (*pISRPrioritySet)(uint32_t base, uint8_t priority);
+    void    (*pCharPut)(uint32_t base, uint8_t data);
+    int32_t (*pCharGetNonBlocking)(uint32_t base);
+    bool    (*pCharsAvail)(uint32_t base);
+
+}MIL_UART_SoftOps;
+
+/*
+ * Desc: Sends software bases to pOps from now on, MIL_SUART_Init
+ *       calls this, there's no need to call it yourself
+ */
+void MIL_UART_SoftRegister(const MIL_UART_SoftOps *pOps);
+#endif
 
 #endif /* MIL_UART_H_ */
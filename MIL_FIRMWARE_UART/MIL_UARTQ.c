@@ -0,0 +1,276 @@
+/*
+ * Name: MIL_UARTQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Priority classes for UART output
+ *
+ * Implementation Notes:
+ *       MIL_UARTQ_Send runs in the main loop and only moves MIL_TXQ heads,
+ *       the ISR only moves tails, so the queues need no lock. Anything that
+ *       touches both sides at once(Kick, stats, rate changes) runs inside a
+ *       MIL_INT critical section
+ *
+ *       The TX interrupt only fires when the FIFO drains past its trigger
+ *       level, so once MIL_TXQ_Next runs dry nothing wakes the ISR again.
+ *       Kick refills the FIFO by hand after each send and from
+ *       MIL_UARTQ_Poll, the same way MIL_LINK does
+ *
+ *       Classes only switch between frames, but up to a FIFO's worth of a
+ *       lower class frame can already be in the UART when a control frame
+ *       is queued. That is at most 16 byte times on top of MIL_TXQ's figures
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_SUART.h"
+#include "MIL_TXQ.h"
+#include "MIL_STAT.h"
+#include "MIL_UARTQ.h"
+
+/************************STATE******************************/
+
+typedef struct{
+
+    uint32_t base;              //0 while the port is free
+    MIL_TXQ txq;
+    uint32_t rx_flags;
+    void (*pRxISR)(void);
+
+    volatile uint32_t isr_count;
+
+#if MIL_STAT_EN
+    MIL_STAT_Src stat;
+    char name[8];
+#endif
+
+}UartqPort;
+
+static UartqPort PORTS[MIL_UARTQ_NUM_PORTS];
+
+/************************PRIVATE FUNCTIONS******************************/
+
+static UartqPort *PortGet(uint32_t base){
+
+    for(uint8_t i = 0; i < MIL_UARTQ_NUM_PORTS; i++){
+
+        if(PORTS[i].base == base){ return &PORTS[i]; }
+
+    }
+
+    return 0;
+
+}
+
+//moves queued bytes into the TX FIFO until one of them runs out
+static void FillFIFO(UartqPort *pP){
+
+    uint32_t now = MIL_TIME_NOW();
+
+    while(UARTSpaceAvail(pP->base)){
+
+        int16_t data = MIL_TXQ_Next(&pP->txq, now);
+        if(data < 0){ break; }
+
+        UARTCharPutNonBlocking(pP->base, (uint8_t)data);
+
+    }
+
+}
+
+static void Kick(UartqPort *pP){
+
+    uint32_t key = MIL_INT_Enter();
+
+    FillFIFO(pP);
+
+    MIL_INT_Exit(key);
+
+}
+
+static void PortISR(UartqPort *pP){
+
+    uint32_t status = UARTIntStatus(pP->base, true);
+
+    pP->isr_count++;
+
+    if(status & MIL_TX_INT_EN){
+
+        UARTIntClear(pP->base, MIL_TX_INT_EN);
+        FillFIFO(pP);
+
+    }
+
+    //the user's ISR clears its own flags
+    if((status & pP->rx_flags) && pP->pRxISR){ pP->pRxISR(); }
+
+}
+
+//UARTIntRegister takes plain functions, so one per port
+static void Port0ISR(void){ PortISR(&PORTS[0]); }
+static void Port1ISR(void){ PortISR(&PORTS[1]); }
+
+static void (* const PORT_ISR[MIL_UARTQ_NUM_PORTS])(void) = {Port0ISR, Port1ISR};
+
+#if MIL_STAT_EN
+
+//bytes sent are already counted per class by MIL_TXQ
+static void StatFill(void *pCtx, MIL_STAT_Counters *pC){
+
+    UartqPort *pP = (UartqPort *)pCtx;
+    MIL_TXQ_Stats st;
+
+    pC->isr = pP->isr_count;
+
+    for(uint8_t cls = 0; cls < MIL_TXQ_CLASSES; cls++){
+
+        uint32_t key = MIL_INT_Enter();
+
+        MIL_TXQ_StatsGet(&pP->txq, cls, &st);
+
+        MIL_INT_Exit(key);
+
+        pC->tx_bytes += st.bytes;
+
+    }
+
+}
+
+#endif
+
+/************************PUBLIC FUNCTIONS******************************/
+
+/*
+ * Desc: Takes over TX on an initialized hardware UART
+ */
+bool MIL_UARTQ_Init(uint32_t base, uint32_t rx_flags, void (*pRxISR)(void)){
+
+    //software ports have no TX FIFO or TX interrupt to drive
+    if(base == 0 || MIL_SUART_IS_SOFT(base)){ return false; }
+
+    UartqPort *pP = PortGet(base);
+    uint8_t i = 0;
+
+    while(!pP && i < MIL_UARTQ_NUM_PORTS){
+
+        if(PORTS[i].base == 0){ pP = &PORTS[i]; }
+        else{ i++; }
+
+    }
+
+    if(!pP){ return false; }
+
+    pP->base = base;
+    pP->rx_flags = rx_flags;
+    pP->pRxISR = pRxISR;
+    pP->isr_count = 0;
+    MIL_TXQ_Init(&pP->txq, MIL_TIME_NOW());
+
+    MIL_UART_FIFOEn(base, 4);
+    MIL_UART_InitISR(base, MIL_TX_INT_EN | rx_flags, PORT_ISR[pP - PORTS]);
+
+#if MIL_STAT_EN
+    //named by slot, UARTQ0 is the first port started
+    memcpy(pP->name, "UARTQ0", 7);
+    pP->name[5] = (char)('0' + (pP - PORTS));
+    MIL_STAT_Register(&pP->stat, pP->name, StatFill, pP);
+#endif
+
+    return true;
+
+}
+
+void MIL_UARTQ_RateSet(uint32_t base, uint8_t cls, uint32_t bytes_per_s, uint16_t burst){
+
+    UartqPort *pP = PortGet(base);
+    if(!pP){ return; }
+
+    uint32_t byte_ticks = bytes_per_s ? (SysCtlClockGet() + bytes_per_s / 2) / bytes_per_s : 0;
+
+    uint32_t key = MIL_INT_Enter();
+
+    MIL_TXQ_RateSet(&pP->txq, cls, byte_ticks, burst, MIL_TIME_NOW());
+
+    MIL_INT_Exit(key);
+
+}
+
+/*
+ * Desc: Queues one frame, never blocks
+ */
+bool MIL_UARTQ_Send(uint32_t base, uint8_t cls, const uint8_t *pData, uint16_t len){
+
+    UartqPort *pP = PortGet(base);
+    if(!pP){ return false; }
+
+    if(!MIL_TXQ_Push(&pP->txq, cls, pData, len, MIL_TIME_NOW())){ return false; }
+
+    Kick(pP);
+
+    return true;
+
+}
+
+bool MIL_UARTQ_SendCString(uint32_t base, uint8_t cls, const char *pStr){
+
+    uint16_t len = 0;
+
+    while(pStr[len] && len <= MIL_TXQ_MAX_FRAME){ len++; }
+
+    return MIL_UARTQ_Send(base, cls, (const uint8_t *)pStr, len);
+
+}
+
+/*
+ * Desc: Restarts output on every port
+ */
+void MIL_UARTQ_Poll(void){
+
+    for(uint8_t i = 0; i < MIL_UARTQ_NUM_PORTS; i++){
+
+        if(PORTS[i].base && !MIL_TXQ_Empty(&PORTS[i].txq)){ Kick(&PORTS[i]); }
+
+    }
+
+}
+
+bool MIL_UARTQ_Busy(uint32_t base){
+
+    UartqPort *pP = PortGet(base);
+    if(!pP){ return false; }
+
+    return !MIL_TXQ_Empty(&pP->txq) || UARTBusy(base);
+
+}
+
+void MIL_UARTQ_StatsGet(uint32_t base, uint8_t cls, MIL_TXQ_Stats *pStats){
+
+    UartqPort *pP = PortGet(base);
+    if(!pP){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    MIL_TXQ_StatsGet(&pP->txq, cls, pStats);
+
+    MIL_INT_Exit(key);
+
+}
+
+void MIL_UARTQ_LatencyReset(uint32_t base, uint8_t cls){
+
+    UartqPort *pP = PortGet(base);
+    if(!pP){ return; }
+
+    uint32_t key = MIL_INT_Enter();
+
+    MIL_TXQ_LatencyReset(&pP->txq, cls);
+
+    MIL_INT_Exit(key);
+
+}
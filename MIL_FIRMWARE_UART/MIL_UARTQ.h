@@ -0,0 +1,124 @@
+/*
+ * Name: MIL_UARTQ
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Priority classes for UART output, so control messages
+ *       don't wait behind logging
+ *
+ * What to understand: MIL_UART_OutArray waits until every byte is in the
+ *                     UART and sends in the order it was called, so a
+ *                     control reply written after a log dump goes out after
+ *                     the whole dump
+ *
+ *                     MIL_UARTQ_Send never waits. It queues a frame in one
+ *                     of MIL_TXQ_CLASSES classes and the TX interrupt sends
+ *                     from the highest class(MIL_TXQ_CONTROL) first, only
+ *                     switching classes between frames. Lower classes can be
+ *                     rate limited so logging never takes the whole line.
+ *                     See MIL_TXQ.h for how the scheduling works
+ *
+ *                     Each class keeps its own queue latency figures, how
+ *                     long frames waited between MIL_UARTQ_Send and going
+ *                     out, so you can check control traffic stays bounded
+ *                     with logging turned all the way up
+ *
+ * Interrupt Note:
+ *      MIL_UARTQ owns the UART's interrupt. If the same UART also receives,
+ *      pass your RX ISR to MIL_UARTQ_Init, it is called for every UART
+ *      interrupt that isn't TX. The FIFO is on(MIL_UART_FIFOEn depth 4), so
+ *      include UART_INT_RT in your flags to get the bytes below the trigger
+ *
+ *      Don't mix MIL_UART_OutArray and MIL_UARTQ_Send on the same UART,
+ *      their bytes would interleave in the middle of frames
+ *
+ * Usage:
+ *      MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+ *      MIL_UARTQ_Init(UART0_BASE, 0, 0);
+ *
+ *      //logs get at most 2000 bytes a second
+ *      MIL_UARTQ_RateSet(UART0_BASE, MIL_TXQ_BULK, 2000, 512);
+ *
+ *      MIL_UARTQ_Send(UART0_BASE, MIL_TXQ_CONTROL, reply, reply_len);
+ *      MIL_UARTQ_Send(UART0_BASE, MIL_TXQ_BULK, log_line, log_len);
+ *
+ *      //main loop, restarts rate limited classes once they have credit
+ *      MIL_UARTQ_Poll();
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MIL_TXQ.h"
+
+#ifndef MIL_UARTQ_H_
+#define MIL_UARTQ_H_
+
+//UARTs that can use MIL_UARTQ at once
+#define MIL_UARTQ_NUM_PORTS 2
+
+/*
+ * Desc: Takes over TX on an initialized hardware UART
+ *
+ * Parameters:
+ *       base: UART TIVA base UARTx_BASE(where x is 0 to 7)
+ *       rx_flags: UART interrupts for pRxISR(MIL_RX_INT_EN | UART_INT_RT), or 0
+ *       pRxISR: your ISR for those interrupts, or 0
+ *
+ * Returns: false if every port is taken or base is a software UART
+ */
+bool MIL_UARTQ_Init(uint32_t base, uint32_t rx_flags, void (*pRxISR)(void));
+
+/*
+ * Desc: Rate limits one class, a limit of 0 removes it
+ *
+ * Parameters:
+ *       base: a UART started with MIL_UARTQ_Init
+ *       cls: MIL_TXQ_CONTROL, MIL_TXQ_NORMAL or MIL_TXQ_BULK
+ *       bytes_per_s: average rate the class can use
+ *       burst: bytes it can send back to back after a quiet spell
+ */
+void MIL_UARTQ_RateSet(uint32_t base, uint8_t cls, uint32_t bytes_per_s, uint16_t burst);
+
+/*
+ * Desc: Queues one frame, never blocks
+ *
+ * Parameters:
+ *       base: a UART started with MIL_UARTQ_Init
+ *       cls: class to send it in
+ *       pData: the frame, copied so the caller can reuse it
+ *       len: 1 to MIL_TXQ_MAX_FRAME
+ *
+ * Returns: false if the class is full(counted in dropped) or len is out of range
+ */
+bool MIL_UARTQ_Send(uint32_t base, uint8_t cls, const uint8_t *pData, uint16_t len);
+
+/*
+ * Desc: MIL_UARTQ_Send for a C string, the 0x00 is not sent
+ */
+bool MIL_UARTQ_SendCString(uint32_t base, uint8_t cls, const char *pStr);
+
+/*
+ * Desc: Restarts output on every port, call every main loop pass
+ *
+ *       The TX interrupt stops when nothing can go out, including when
+ *       the only frames waiting are rate limited. This picks them up
+ *       once their class has earned the credit
+ */
+void MIL_UARTQ_Poll(void);
+
+/*
+ * Desc: true while anything is queued or still in the UART
+ */
+bool MIL_UARTQ_Busy(uint32_t base);
+
+/*
+ * Desc: copies out one class's counters, latencies are MIL_TIME cycles
+ */
+void MIL_UARTQ_StatsGet(uint32_t base, uint8_t cls, MIL_TXQ_Stats *pStats);
+
+/*
+ * Desc: starts a fresh latency period for one class(lat_max, lat_avg)
+ */
+void MIL_UARTQ_LatencyReset(uint32_t base, uint8_t cls);
+
+#endif /* MIL_UARTQ_H_ */
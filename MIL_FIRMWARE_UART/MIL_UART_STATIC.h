@@ -0,0 +1,251 @@
+/*
+ * Name: MIL_UART_STATIC
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: UARTs fixed at compile time, checked by the compiler
+ *       and set up with straight register writes
+ *
+ * What to understand: MIL_InitUART works everything out while the program
+ *                     runs. Pick a baud rate the clock can't make and you
+ *                     only find out when the terminal shows garbage
+ *
+ *                     MIL_UART_STATIC makes a UART "instance" from a UART
+ *                     number, clock and baud rate that are all known when
+ *                     compiling. The divisors are worked out by the compiler,
+ *                     and a baud rate that is off by more than 2%(the most a
+ *                     UART link tolerates) stops the build with a message
+ *
+ *                     Every function of the instance is a handful of register
+ *                     writes with the addresses already filled in, no switch
+ *                     on the base and no SysCtlClockGet
+ *
+ * Clock Note:
+ *      clock_hz has to be the clock the board actually runs at,
+ *      MIL_16MHz(MIL_CLK.h) for MIL_ClkSetInt_16MHz. The compiler can't check that
+ *
+ * Usage(at file scope, not inside a function):
+ *      MIL_UART_STATIC(DEBUG, 1, MIL_16MHz, MIL_DEFAULT_BAUD_115K)
+ *
+ *      DEBUG_Init();
+ *      DEBUG_OutCString("hello\r\n");
+ *      MIL_UART_InitISR(DEBUG_BASE, ...);  //regular MIL_UART functions still work
+ *
+ *      This one fails the build(3M is more than 16MHz can make):
+ *      MIL_UART_STATIC(FAST, 1, MIL_16MHz, 3000000)
+ *
+ * Pins: the same as MIL_UART(see the pin map in MIL_UART.h)
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_gpio.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
+
+#include "MIL_CLK.h"
+
+#ifndef MIL_UART_STATIC_H_
+#define MIL_UART_STATIC_H_
+
+//largest baud rate error allowed, in percent
+#define MIL_UART_STATIC_MAX_ERR 2
+
+/************************COMPILE TIME CHECKS******************************/
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define MIL_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#else
+//pre C11 compilers: a negative array size is an error, msg only shows up as the name
+#define MIL_STATIC_ASSERT(cond, msg) extern char MIL_STATIC_ASSERT_FAILED[(cond) ? 1 : -1]
+#endif
+
+/************************PER UART TABLE******************************/
+
+/*
+ * For UART n:
+ *      BASE:   UART registers
+ *      PORT:   GPIO port registers
+ *      PORTN:  GPIO port number(A = 0) for the clock gating registers
+ *      PINS:   RX and TX pin mask
+ *      PCTL:   pin mux value, function 1 on both pins
+ *      LOCKED: pins that have to be unlocked first(PD7 is an NMI pin)
+ */
+#define MIL_UARTS_BASE_0   UART0_BASE
+#define MIL_UARTS_PORT_0   GPIO_PORTA_BASE
+#define MIL_UARTS_PORTN_0  0
+#define MIL_UARTS_PINS_0   0x03
+#define MIL_UARTS_PCTL_0   0x00000011
+#define MIL_UARTS_LOCKED_0 0x00
+
+#define MIL_UARTS_BASE_1   UART1_BASE
+#define MIL_UARTS_PORT_1   GPIO_PORTB_BASE
+#define MIL_UARTS_PORTN_1  1
+#define MIL_UARTS_PINS_1   0x03
+#define MIL_UARTS_PCTL_1   0x00000011
+#define MIL_UARTS_LOCKED_1 0x00
+
+#define MIL_UARTS_BASE_2   UART2_BASE
+#define MIL_UARTS_PORT_2   GPIO_PORTD_BASE
+#define MIL_UARTS_PORTN_2  3
+#define MIL_UARTS_PINS_2   0xC0
+#define MIL_UARTS_PCTL_2   0x11000000
+#define MIL_UARTS_LOCKED_2 0x80
+
+#define MIL_UARTS_BASE_3   UART3_BASE
+#define MIL_UARTS_PORT_3   GPIO_PORTC_BASE
+#define MIL_UARTS_PORTN_3  2
+#define MIL_UARTS_PINS_3   0xC0
+#define MIL_UARTS_PCTL_3   0x11000000
+#define MIL_UARTS_LOCKED_3 0x00
+
+#define MIL_UARTS_BASE_4   UART4_BASE
+#define MIL_UARTS_PORT_4   GPIO_PORTC_BASE
+#define MIL_UARTS_PORTN_4  2
+#define MIL_UARTS_PINS_4   0x30
+#define MIL_UARTS_PCTL_4   0x00110000
+#define MIL_UARTS_LOCKED_4 0x00
+
+#define MIL_UARTS_BASE_5   UART5_BASE
+#define MIL_UARTS_PORT_5   GPIO_PORTE_BASE
+#define MIL_UARTS_PORTN_5  4
+#define MIL_UARTS_PINS_5   0x30
+#define MIL_UARTS_PCTL_5   0x00110000
+#define MIL_UARTS_LOCKED_5 0x00
+
+#define MIL_UARTS_BASE_6   UART6_BASE
+#define MIL_UARTS_PORT_6   GPIO_PORTD_BASE
+#define MIL_UARTS_PORTN_6  3
+#define MIL_UARTS_PINS_6   0x30
+#define MIL_UARTS_PCTL_6   0x00110000
+#define MIL_UARTS_LOCKED_6 0x00
+
+#define MIL_UARTS_BASE_7   UART7_BASE
+#define MIL_UARTS_PORT_7   GPIO_PORTE_BASE
+#define MIL_UARTS_PORTN_7  4
+#define MIL_UARTS_PINS_7   0x03
+#define MIL_UARTS_PCTL_7   0x00000011
+#define MIL_UARTS_LOCKED_7 0x00
+
+//the extra step lets n be a macro itself
+#define MIL_UARTS_GET(field, n)  MIL_UARTS_GET_(field, n)
+#define MIL_UARTS_GET_(field, n) MIL_UARTS_##field##_##n
+
+/************************DIVISOR MATH******************************/
+
+/*
+ * Same math as UARTConfigSetExpClk. The divisor is clock / (16 * baud)
+ * in 1/64ths, or clock / (8 * baud) in high speed mode(HSE) for baud
+ * rates above clock / 16
+ */
+#define MIL_UARTS_HSE(clk, baud)  ((baud) * 16ULL > (clk))
+#define MIL_UARTS_DIV(clk, baud)  \
+    ((((clk) * 8ULL) / (MIL_UARTS_HSE(clk, baud) ? (baud) / 2 : (baud)) + 1) / 2)
+#define MIL_UARTS_IBRD(clk, baud) (MIL_UARTS_DIV(clk, baud) / 64)
+#define MIL_UARTS_FBRD(clk, baud) (MIL_UARTS_DIV(clk, baud) % 64)
+
+//baud rate the hardware really makes(a 0 divisor is caught by MIL_UARTS_REACHABLE)
+#define MIL_UARTS_ACTUAL(clk, baud) \
+    (((clk) * 4ULL * (MIL_UARTS_HSE(clk, baud) ? 2 : 1)) / (MIL_UARTS_DIV(clk, baud) ? MIL_UARTS_DIV(clk, baud) : 1))
+
+//the divisor has to fit the 16 bit integer register and can't be 0
+#define MIL_UARTS_REACHABLE(clk, baud) \
+    ((baud) * 8ULL <= (clk) && MIL_UARTS_IBRD(clk, baud) >= 1 && MIL_UARTS_IBRD(clk, baud) <= 0xFFFF)
+
+#define MIL_UARTS_ERR_OK(clk, baud) \
+    (MIL_UARTS_ACTUAL(clk, baud) * 100 <= (baud) * (100ULL + MIL_UART_STATIC_MAX_ERR) && \
+     MIL_UARTS_ACTUAL(clk, baud) * 100 >= (baud) * (100ULL - MIL_UART_STATIC_MAX_ERR))
+
+/************************INSTANCE******************************/
+
+/*
+ * Desc: Makes a UART instance called name, configured for
+ *       8 bit words, no parity, one stop bit, FIFO off(same as MIL_InitUART)
+ *
+ *       Gives:
+ *          name_BASE           UARTx_BASE, for the regular MIL_UART functions
+ *          name_ACTUAL_BAUD    the baud rate the hardware really makes
+ *          name_Init()         clocks, pins and line settings
+ *          name_Put(c)         sends a byte, waits for FIFO space
+ *          name_Get()          waits for and returns a byte
+ *          name_Avail()        true if a byte is waiting
+ *          name_OutCString(s)  sends a C string(not the 0 at the end)
+ *
+ * Parameters:
+ *       name: instance name
+ *       uart: UART number 0 to 7
+ *       clock_hz: system clock
+ *       baud: baud rate
+ */
+#define MIL_UART_STATIC(name, uart, clock_hz, baud)                                        \
+                                                                                            \
+MIL_STATIC_ASSERT(MIL_UARTS_REACHABLE(clock_hz, baud),                                      \
+                  #name ": baud rate can't be made from this clock");                       \
+MIL_STATIC_ASSERT(MIL_UARTS_ERR_OK(clock_hz, baud),                                         \
+                  #name ": baud rate error is over MIL_UART_STATIC_MAX_ERR percent");       \
+                                                                                            \
+enum{                                                                                       \
+    name##_BASE = MIL_UARTS_GET(BASE, uart),                                                \
+    name##_ACTUAL_BAUD = (int)MIL_UARTS_ACTUAL(clock_hz, baud)                              \
+};                                                                                          \
+                                                                                            \
+static inline void name##_Init(void){                                                      \
+                                                                                            \
+    const uint32_t port = MIL_UARTS_GET(PORT, uart);                                        \
+    const uint32_t pins = MIL_UARTS_GET(PINS, uart);                                        \
+    const uint32_t pctl = MIL_UARTS_GET(PCTL, uart);                                        \
+                                                                                            \
+    HWREG(SYSCTL_RCGCUART) |= (1u << (uart));                                               \
+    HWREG(SYSCTL_RCGCGPIO) |= (1u << MIL_UARTS_GET(PORTN, uart));                           \
+    while(!(HWREG(SYSCTL_PRUART) & (1u << (uart))));                                        \
+    while(!(HWREG(SYSCTL_PRGPIO) & (1u << MIL_UARTS_GET(PORTN, uart))));                    \
+                                                                                            \
+    if(MIL_UARTS_GET(LOCKED, uart)){                                                        \
+        HWREG(port + GPIO_O_LOCK) = GPIO_LOCK_KEY;                                          \
+        HWREG(port + GPIO_O_CR) |= MIL_UARTS_GET(LOCKED, uart);                             \
+        HWREG(port + GPIO_O_LOCK) = 0;                                                      \
+    }                                                                                       \
+                                                                                            \
+    /*every pctl nibble is 1, times 0xF gives the nibble mask*/                             \
+    HWREG(port + GPIO_O_PCTL) = (HWREG(port + GPIO_O_PCTL) & ~(pctl * 0xF)) | pctl;         \
+    HWREG(port + GPIO_O_AFSEL) |= pins;                                                     \
+    HWREG(port + GPIO_O_DEN) |= pins;                                                       \
+                                                                                            \
+    HWREG(name##_BASE + UART_O_CTL) = 0;                                                    \
+    HWREG(name##_BASE + UART_O_IBRD) = (uint32_t)MIL_UARTS_IBRD(clock_hz, baud);            \
+    HWREG(name##_BASE + UART_O_FBRD) = (uint32_t)MIL_UARTS_FBRD(clock_hz, baud);            \
+    HWREG(name##_BASE + UART_O_LCRH) = UART_LCRH_WLEN_8;                                    \
+    HWREG(name##_BASE + UART_O_CC) = 0;                                                     \
+    HWREG(name##_BASE + UART_O_CTL) = UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE |       \
+                                      (MIL_UARTS_HSE(clock_hz, baud) ? UART_CTL_HSE : 0);   \
+                                                                                            \
+}                                                                                           \
+                                                                                            \
+static inline void name##_Put(uint8_t c){                                                  \
+                                                                                            \
+    while(HWREG(name##_BASE + UART_O_FR) & UART_FR_TXFF);                                   \
+    HWREG(name##_BASE + UART_O_DR) = c;                                                     \
+                                                                                            \
+}                                                                                           \
+                                                                                            \
+static inline bool name##_Avail(void){                                                     \
+                                                                                            \
+    return !(HWREG(name##_BASE + UART_O_FR) & UART_FR_RXFE);                                \
+                                                                                            \
+}                                                                                           \
+                                                                                            \
+static inline uint8_t name##_Get(void){                                                    \
+                                                                                            \
+    while(!name##_Avail());                                                                 \
+    return (uint8_t)HWREG(name##_BASE + UART_O_DR);                                         \
+                                                                                            \
+}                                                                                           \
+                                                                                            \
+static inline void name##_OutCString(const char *pMsg){                                    \
+                                                                                            \
+    while(*pMsg){ name##_Put((uint8_t)*pMsg++); }                                           \
+                                                                                            \
+}
+
+#endif /* MIL_UART_STATIC_H_ */
@@ -0,0 +1,46 @@
+/*
+ * Name: MIL_UART_Bootloader
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Serial bootloader image, see MIL_BOOT.h
+ *
+ *       Build this as its own CCS project with the normal linker
+ *       file(starting at 0x0) and flash it once with JTAG. After that
+ *       applications are loaded with tools/mil_flash.py:
+ *
+ *          python mil_flash.py COM5 my_app.bin
+ *
+ *       Applications must be linked at MIL_BOOT_APP_BASE(0x4000)
+ *
+ * Files needed in the project:
+ *       main_boot.c, MIL_BOOT.c, MIL_CRC.c, MIL_DMA.c, MIL_UART.c, MIL_CLK.c
+ *
+ * Hardware Notes:
+ * UART 0 on Port A(launchpad debug USB virtual COM port)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_BOOT.h"
+
+/************************DEFINES******************************/
+
+//how long to listen for the flasher after reset
+#define BOOT_WAIT_MS 200
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+
+    //never returns
+    MIL_BOOT_Run(BOOT_WAIT_MS);
+
+}
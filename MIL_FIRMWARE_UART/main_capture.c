@@ -0,0 +1,124 @@
+/*
+ * Name: MIL_UART_Capture_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate recording UART traffic with MIL_CAP
+ *
+ *       UART1 runs the same polled echo as main_polled.c, but through
+ *       MIL_UART_CharGet/CharPut so every byte is captured. The capture
+ *       streams out UART0(the launchpad's USB serial port) as it happens
+ *
+ *       On the PC save UART0 to a file, then replay it:
+ *          Linux:   stty -F /dev/ttyACM0 921600 raw && cat /dev/ttyACM0 > echo.cap
+ *          Windows: most serial terminals have "log to file"(binary)
+ *
+ *          tools/uart_replay echo.cap
+ *
+ *       Each byte on UART1 costs 8 bytes on UART0 and the echo doubles
+ *       that, so even at 8 times the echo's baud the capture port only
+ *       keeps up with half of UART1's line rate. Typing never fills the
+ *       ring, pasting a long block will. The red LED comes on when a
+ *       record is lost
+ *
+ *       Hold SW1 to pause the capture(MIL_CAP_Enable), what is already in
+ *       the ring still goes out
+ *
+ *       Set MIL_UART_CAPTURE_EN to 1 in MIL_CONFIG.h for this demo
+ *
+ * Hardware Notes:
+ * UART 1 on Port B(the traffic)
+ * PB0 - UART RX
+ * PB1 - UART TX
+ *
+ * UART 0 on Port A(USB, the capture)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ *
+ * PF1 - red LED, records lost
+ * PF4 - SW1, pause
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_CAP.h"
+
+#if !MIL_UART_CAPTURE_EN
+#error "main_capture.c needs MIL_UART_CAPTURE_EN set to 1 in MIL_CONFIG.h"
+#endif
+
+/************************DEFINES******************************/
+
+#define RED_LED_PIN GPIO_PIN_1
+#define SW1_PIN GPIO_PIN_4
+
+#define CAPTURE_BAUD 921600
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    InitGPIO();
+
+    MIL_InitUART(UART0_BASE, CAPTURE_BAUD);
+    MIL_UART_FIFOEn(UART0_BASE, 4);
+
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_CAP_Init(UART0_BASE);
+
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)"By Marquez Jones");
+
+    MIL_CAP_Stats stats;
+
+    while(1){
+
+        //the echo from main_polled.c
+        if(MIL_UART_CharsAvail(UART1_BASE)){
+
+            uint8_t rx_data = MIL_UART_CharGet(UART1_BASE);
+
+            MIL_UART_CharPut(UART1_BASE, rx_data);
+
+        }
+
+        MIL_CAP_Enable(GPIOPinRead(GPIO_PORTF_BASE, SW1_PIN) != 0);
+        MIL_CAP_Poll();
+
+        MIL_CAP_StatsGet(&stats);
+        GPIOPinWrite(GPIO_PORTF_BASE, RED_LED_PIN, stats.lost ? RED_LED_PIN : 0);
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, RED_LED_PIN);
+
+    //SW1 pulls PF4 low when pressed
+    GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, SW1_PIN);
+    GPIOPadConfigSet(GPIO_PORTF_BASE, SW1_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Name: MIL_UART_FastBoot_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate bringing a board up quickly
+ *       with MIL_START and reading back where the time went
+ *
+ *       The board sends one telemetry line as soon as it can, then
+ *       prints the boot trace. Compare the "first tx" time against
+ *       main_polled.c style startup(initialize and wait one peripheral
+ *       at a time) to see the difference
+ *
+ *       To test brownout recovery, dip the supply below ~2.9V, the
+ *       trace will report "reset: brownout"
+ *
+ * Hardware Notes:
+ * UART 1 on Port B
+ * PB0 - UART RX
+ * PB1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_UART.h"
+#include "MIL_START.h"
+
+/************************DEFINES******************************/
+
+#define LED_PINS (GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+/************************STARTUP LISTS******************************/
+
+//everything besides the UARTs
+static const uint32_t PERIPHS[] = {
+
+    SYSCTL_PERIPH_GPIOF,
+
+};
+
+//only the UARTs this board actually uses
+static const MIL_START_UART UARTS[] = {
+
+    {UART1_BASE, MIL_DEFAULT_BAUD_115K},
+
+};
+
+#define NUM_PERIPHS (sizeof(PERIPHS) / sizeof(PERIPHS[0]))
+#define NUM_UARTS   (sizeof(UARTS) / sizeof(UARTS[0]))
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    //first thing, starts the boot clock
+    MIL_START_Begin();
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_START_Mark("clk");
+
+    MIL_START_Init(PERIPHS, NUM_PERIPHS, UARTS, NUM_UARTS);
+
+    //first telemetry out the door
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)"up\r\n");
+    MIL_START_Mark("first tx");
+
+    //things that can wait until after telemetry is flowing
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, LED_PINS);
+    GPIOPinWrite(GPIO_PORTF_BASE, LED_PINS, LED_PINS);
+    MIL_START_Mark("leds");
+
+    MIL_START_TraceOut(UART1_BASE);
+
+    while(1){
+
+    }
+
+}
@@ -0,0 +1,185 @@
+/*
+ * Name: MIL_UART_Format_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will compare how long MIL_FMT, TivaWare's usnprintf and
+ *       the C library's snprintf take to turn numbers into text
+ *
+ *       usnprintf is the same kind of format string walker UARTprintf
+ *       uses. UARTprintf itself isn't timed because most of its time is
+ *       spent waiting on the UART, not formatting
+ *
+ *       Each test formats the same 256 numbers and reports the average
+ *       MIL_TIME cycles per number on UART0(the launchpad's USB serial
+ *       port), then the demo sends a telemetry line every 100ms built
+ *       with MIL_FMT_Buf
+ *
+ *       Host results and a check against snprintf: tools/fmt_bench.c
+ *
+ * Hardware Notes:
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "utils/ustdlib.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_FMT.h"
+
+/************************DEFINES******************************/
+
+#define NUM_VALUES 256
+#define TELEM_US 100000
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void Flush(void *pCtx, uint8_t *pData, uint16_t len);
+void Result(MIL_FMT_Buf *pB, const char *pName, uint32_t mil, uint32_t ustd, uint32_t libc);
+
+/************************GLOBALS******************************/
+
+uint32_t values[NUM_VALUES];
+float floats[NUM_VALUES];
+volatile uint32_t sink;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+
+    IntMasterEnable();
+
+    //a spread of lengths, 1 to 10 digits
+    uint32_t seed = 1;
+    for(uint16_t i = 0; i < NUM_VALUES; i++){
+
+        seed = seed * 1664525 + 1013904223;
+        values[i] = seed >> (i % 32);
+        floats[i] = (float)(int32_t)values[i] / 1024.0f;
+
+    }
+
+    uint8_t out[MIL_FMT_MAX_LEN];
+    char ref[32];
+    uint32_t start;
+    uint32_t mil, ustd, libc;
+
+    uint8_t line[64];
+    MIL_FMT_Buf b;
+    MIL_FMT_BufInit(&b, line, sizeof(line), Flush, 0);
+
+    MIL_FMT_AddStr(&b, "cycles per number   MIL_FMT  usnprintf  snprintf\r\n");
+
+    //decimal
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += MIL_FMT_U32(out, values[i]); }
+    mil = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += usnprintf(ref, sizeof(ref), "%u", values[i]); }
+    ustd = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += snprintf(ref, sizeof(ref), "%lu", (unsigned long)values[i]); }
+    libc = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    Result(&b, "decimal u32", mil, ustd, libc);
+
+    //hex
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += MIL_FMT_Hex(out, values[i], 8); }
+    mil = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += usnprintf(ref, sizeof(ref), "%08X", values[i]); }
+    ustd = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += snprintf(ref, sizeof(ref), "%08lX", (unsigned long)values[i]); }
+    libc = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    Result(&b, "hex 8 digits", mil, ustd, libc);
+
+    //float, usnprintf has no %f so it gets 0
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += MIL_FMT_Float(out, floats[i], 3); }
+    mil = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    start = MIL_TIME_NOW();
+    for(uint16_t i = 0; i < NUM_VALUES; i++){ sink += snprintf(ref, sizeof(ref), "%.3f", (double)floats[i]); }
+    libc = (MIL_TIME_NOW() - start) / NUM_VALUES;
+
+    Result(&b, "float 3 decimals", mil, 0, libc);
+
+    MIL_FMT_Flush(&b);
+
+    uint32_t telem_cycles = MIL_TIME_FromUs(TELEM_US);
+    uint32_t last = MIL_TIME_NOW();
+    uint32_t count = 0;
+
+    while(1){
+
+        if((MIL_TIME_NOW() - last) < telem_cycles){ continue; }
+        last += telem_cycles;
+
+        //made up readings, a counter, a Q16.16 angle and a float voltage
+        int32_t angle_q16 = (int32_t)(count * 7919) - (180 << 16);
+        float volts = 3.3f * (float)(count % 100) / 100.0f;
+
+        MIL_FMT_AddStr(&b, "n=");
+        MIL_FMT_AddU32(&b, count);
+        MIL_FMT_AddStr(&b, " angle=");
+        MIL_FMT_AddFixed(&b, angle_q16, 16, 3);
+        MIL_FMT_AddStr(&b, " volts=");
+        MIL_FMT_AddFloat(&b, volts, 2);
+        MIL_FMT_AddStr(&b, " id=0x");
+        MIL_FMT_AddHex(&b, count * 2654435761u, 8);
+        MIL_FMT_AddStr(&b, "\r\n");
+        MIL_FMT_Flush(&b);
+
+        count++;
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void Flush(void *pCtx, uint8_t *pData, uint16_t len){
+
+    (void)pCtx;
+
+    MIL_UART_OutArray(UART0_BASE, pData, (uint8_t)len);
+
+}
+
+void Result(MIL_FMT_Buf *pB, const char *pName, uint32_t mil, uint32_t ustd, uint32_t libc){
+
+    MIL_FMT_AddStr(pB, "  ");
+    MIL_FMT_AddStr(pB, pName);
+    MIL_FMT_AddStr(pB, ": ");
+    MIL_FMT_AddU32(pB, mil);
+    MIL_FMT_AddStr(pB, "  ");
+    MIL_FMT_AddU32(pB, ustd);
+    MIL_FMT_AddStr(pB, "  ");
+    MIL_FMT_AddU32(pB, libc);
+    MIL_FMT_AddStr(pB, "\r\n");
+
+}
@@ -0,0 +1,169 @@
+/*
+ * Name: MIL_UART_Latency_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate why interrupt priorities matter
+ *       by measuring worst case ISR entry latency of a timer
+ *       while a slow UART ISR keeps firing
+ *
+ *       A periodic timer counts down and reloads when it times out.
+ *       The value it has counted down by when its ISR starts is exactly
+ *       how long the ISR waited, so the timer measures its own latency
+ *
+ *       The test runs twice:
+ *          before: every interrupt left at priority 0(reset default)
+ *          after:  MIL_INT priority plan, the timer preempts the UART ISR
+ *
+ *       Results are printed in CPU cycles and microseconds
+ *
+ * Hardware Notes:
+ * UART 1 on Port B
+ * PB0 - UART RX
+ * PB1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/uart.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+
+/************************DEFINES******************************/
+
+//timer period in cycles(1kHz at 16MHz)
+#define TIMER_PERIOD 16000
+
+//how long the fake slow UART ISR runs, ~200us at 16MHz(3 cycles per loop)
+#define SLOW_ISR_LOOPS 1066
+
+//how long each test runs
+#define TEST_MS 500
+
+/************************GLOBALS******************************/
+
+static volatile uint32_t max_latency;
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void TimerISR(void);
+void SlowUartISR(void);
+uint32_t RunTest(void);
+void OutResult(const char *pName, uint32_t cycles);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    //the ISR is only ever pended from software below, no UART flags needed
+    MIL_UART_InitISR(UART1_BASE, 0, SlowUartISR);
+    IntEnable(INT_UART1);
+
+    //periodic timer measuring its own latency
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0));
+    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(TIMER0_BASE, TIMER_A, TIMER_PERIOD - 1);
+    TimerIntRegister(TIMER0_BASE, TIMER_A, TimerISR);
+    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+
+    IntMasterEnable();
+
+    //before: everything at the reset default
+    MIL_UART_ISRPrioritySet(UART1_BASE, 0x00);
+    MIL_INT_PrioritySet(INT_TIMER0A, 0x00);
+    OutResult("before", RunTest());
+
+    //after: MIL plan
+    MIL_UART_ISRPrioritySet(UART1_BASE, MIL_INT_PRI_UART);
+    MIL_INT_PrioritySet(INT_TIMER0A, MIL_INT_PRI_TIMER);
+    OutResult("after", RunTest());
+
+    while(1){
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void TimerISR(void){
+
+    //cycles since the timeout, read first so nothing else adds to it
+    uint32_t latency = (TIMER_PERIOD - 1) - TimerValueGet(TIMER0_BASE, TIMER_A);
+
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+
+    if(latency > max_latency){ max_latency = latency; }
+
+}
+
+void SlowUartISR(void){
+
+    //stand in for a UART ISR that does too much work
+    SysCtlDelay(SLOW_ISR_LOOPS);
+
+}
+
+/*
+ * Desc: runs the timer for TEST_MS while pending the slow
+ *       UART ISR at an unrelated rate, returns the worst latency
+ */
+uint32_t RunTest(void){
+
+    uint32_t test_cycles = MIL_TIME_FromUs(TEST_MS * 1000);
+    uint32_t start = MIL_TIME_NOW();
+
+    max_latency = 0;
+    TimerEnable(TIMER0_BASE, TIMER_A);
+
+    while((MIL_TIME_NOW() - start) < test_cycles){
+
+        IntTrigger(INT_UART1);
+
+        //~730us, not a multiple of the timer period so the two drift past each other
+        SysCtlDelay(3900);
+
+    }
+
+    TimerDisable(TIMER0_BASE, TIMER_A);
+
+    return max_latency;
+
+}
+
+void OutResult(const char *pName, uint32_t cycles){
+
+    uint8_t digits[11];
+    int8_t i = 10;
+    uint32_t us = MIL_TIME_ToUs(cycles);
+
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)pName);
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)" worst latency: ");
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (cycles % 10); cycles /= 10; }while(cycles);
+    MIL_UART_OutCString(UART1_BASE, &digits[i]);
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)" cycles ");
+
+    i = 10;
+    do{ digits[--i] = '0' + (us % 10); us /= 10; }while(us);
+    MIL_UART_OutCString(UART1_BASE, &digits[i]);
+    MIL_UART_OutCString(UART1_BASE, (uint8_t *)"us\r\n");
+
+}
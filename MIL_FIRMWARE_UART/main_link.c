@@ -0,0 +1,160 @@
+/*
+ * Name: MIL_UART_Link_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate reliable messages between two boards
+ *       with MIL_LINK
+ *
+ *       Flash both boards with this same program. Each one sends
+ *       numbered messages as fast as the link will take them and checks
+ *       that the other board's messages arrive in order with nothing
+ *       missing. Once a second each board prints how many payload bytes
+ *       per second got through and how many messages had to be resent
+ *       on UART0(the launchpad's USB serial port)
+ *
+ *       Pull a wire out for a moment or run it through a long noisy
+ *       cable, the resend count goes up but "missing" stays at 0
+ *
+ *       To try different loss rates and tether lengths without hardware,
+ *       build and run tools/link_sim.c
+ *
+ * Hardware Notes:
+ * UART 1 on Port B, crossed between the boards
+ * PB0 - UART RX, to the other board's PB1
+ * PB1 - UART TX, to the other board's PB0
+ * connect the grounds
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_LINK.h"
+
+/************************DEFINES******************************/
+
+#define REPORT_US 1000000
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void Deliver(void *pCtx, const uint8_t *pData, uint8_t len);
+void Report(void);
+void OutInt(int32_t value);
+
+/************************GLOBALS******************************/
+
+uint32_t next_expected = 0;
+uint32_t missing = 0;
+uint32_t rx_bytes = 0;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_LINK_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, Deliver, 0);
+
+    IntMasterEnable();
+
+    uint8_t msg[MIL_ARQ_MAX_PAYLOAD];
+    uint32_t count = 0;
+    uint32_t report_cycles = MIL_TIME_FromUs(REPORT_US);
+    uint32_t last_report = MIL_TIME_NOW();
+
+    while(1){
+
+        MIL_LINK_Poll();
+
+        if(MIL_LINK_CanSend()){
+
+            //message count first, the rest is filler
+            for(uint8_t i = 0; i < MIL_ARQ_MAX_PAYLOAD; i++){ msg[i] = (uint8_t)i; }
+            msg[0] = (uint8_t)count;
+            msg[1] = (uint8_t)(count >> 8);
+            msg[2] = (uint8_t)(count >> 16);
+            msg[3] = (uint8_t)(count >> 24);
+
+            if(MIL_LINK_Send(msg, MIL_ARQ_MAX_PAYLOAD)){ count++; }
+
+        }
+
+        if((MIL_TIME_NOW() - last_report) >= report_cycles){
+
+            last_report += report_cycles;
+            Report();
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void Deliver(void *pCtx, const uint8_t *pData, uint8_t len){
+
+    (void)pCtx;
+
+    uint32_t n = (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) |
+                 ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+
+    //MIL_LINK never skips, so this only counts if something is broken
+    if(n != next_expected){ missing++; }
+
+    next_expected = n + 1;
+    rx_bytes += len;
+
+}
+
+void Report(void){
+
+    MIL_LINK_Stats stats;
+    MIL_LINK_StatsGet(&stats);
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"goodput ");
+    OutInt(rx_bytes);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" B/s, resent ");
+    OutInt(stats.arq.retransmits);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)", bad frames ");
+    OutInt(stats.arq.bad_frames);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)", rtt ");
+    OutInt(MIL_TIME_ToUs(stats.arq.srtt));
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"us, missing ");
+    OutInt(missing);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"\r\n");
+
+    rx_bytes = 0;
+
+}
+
+void OutInt(int32_t value){
+
+    uint8_t digits[12];
+    int8_t i = 11;
+    uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (mag % 10); mag /= 10; }while(mag);
+    if(value < 0){ digits[--i] = '-'; }
+
+    MIL_UART_OutCString(UART0_BASE, &digits[i]);
+
+}
@@ -0,0 +1,233 @@
+/*
+ * Name: MIL_UART_Pattern_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate MIL_PATTERN driving pins with exact
+ *       timing while the CPU is free
+ *
+ *       GEN0 streams stepper motor STEP/DIR signals on PB0/PB1 with 10us
+ *       steps. The fill function works out a ramp up to full speed, a
+ *       cruise, a ramp down and a direction change, one half buffer at a
+ *       time. Each STEP pulse is one 10us step high
+ *
+ *       GEN1 loops a color table on the launchpad RGB LED, a quarter
+ *       second per color, set up once and never touched again
+ *
+ *       Once a second UART0 shows how many steps each generator played,
+ *       any stream underruns, and how much CPU the fill function took,
+ *       everything else was free for the main loop
+ *
+ *       Put a scope on PB0 to see the pulse train, the edges don't move
+ *       when the UART output interrupts
+ *
+ * Hardware Notes:
+ * PB0 - STEP
+ * PB1 - DIR
+ * PF1 - red LED
+ * PF2 - blue LED
+ * PF3 - green LED
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_FMT.h"
+#include "MIL_PATTERN.h"
+
+/************************DEFINES******************************/
+
+#define STEP_PIN GPIO_PIN_0
+#define DIR_PIN GPIO_PIN_1
+
+#define RED GPIO_PIN_1
+#define BLUE GPIO_PIN_2
+#define GREEN GPIO_PIN_3
+
+//stepper stream: 10us per step, 256 steps(2.56ms) per half buffer
+#define STEP_US 10
+#define SAMPLES_PER_S (1000000 / STEP_US)
+#define HALF_LEN 256
+
+//motor profile in pulses per second
+#define SPEED_MIN 200
+#define SPEED_MAX 8000
+#define ACCEL 20000         //pulses per second per second
+#define MOVE_PULSES 20000
+
+/************************TYPES******************************/
+
+typedef struct{
+
+    uint32_t speed;         //pulses per second
+    uint32_t pulses;        //into the current move
+    uint32_t gap;           //samples left until the next pulse
+    uint8_t dir;
+    uint32_t fill_cycles;   //CPU spent in Fill
+
+}Motor;
+
+/************************FUNCTION PROTOTYPES******************************/
+
+uint16_t Fill(void *pCtx, uint8_t *pBuf, uint16_t len);
+void Report(void);
+void Flush(void *pCtx, uint8_t *pData, uint16_t len);
+
+/************************GLOBALS******************************/
+
+static const uint8_t COLORS[] = {
+
+    RED, RED | GREEN, GREEN, GREEN | BLUE, BLUE, BLUE | RED, RED | GREEN | BLUE, 0
+
+};
+
+uint8_t half_a[HALF_LEN];
+uint8_t half_b[HALF_LEN];
+Motor motor = {SPEED_MIN, 0, 0, 0, 0};
+
+uint8_t line[96];
+MIL_FMT_Buf out;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_FMT_BufInit(&out, line, sizeof(line), Flush, 0);
+
+    MIL_PATTERN_Init(MIL_PATTERN_GEN0, GPIO_PORTB_BASE, STEP_PIN | DIR_PIN);
+    MIL_PATTERN_Init(MIL_PATTERN_GEN1, GPIO_PORTF_BASE, RED | BLUE | GREEN);
+
+    IntMasterEnable();
+
+    MIL_PATTERN_Stream(MIL_PATTERN_GEN0, half_a, half_b, HALF_LEN,
+                       MIL_TIME_FromUs(STEP_US), Fill, &motor);
+
+    MIL_PATTERN_Play(MIL_PATTERN_GEN1, COLORS, sizeof(COLORS), MIL_TIME_FromUs(250000), 0);
+
+    uint32_t second = MIL_TIME_FromUs(1000000);
+    uint32_t last_report = MIL_TIME_NOW();
+
+    while(1){
+
+        if((MIL_TIME_NOW() - last_report) >= second){
+
+            last_report += second;
+            Report();
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+/*
+ * Desc: next half buffer of the motor profile, from the GEN0 ISR
+ *
+ *       Speeding up by ACCEL/speed each pulse gives a constant
+ *       acceleration(v dv = a dx). The ramp down starts once the
+ *       pulses left are fewer than the ramp up took
+ */
+uint16_t Fill(void *pCtx, uint8_t *pBuf, uint16_t len){
+
+    Motor *pM = (Motor *)pCtx;
+    uint32_t start = MIL_TIME_NOW();
+    uint8_t dir = pM->dir ? DIR_PIN : 0;
+
+    for(uint16_t i = 0; i < len; i++){
+
+        if(pM->gap){
+
+            pBuf[i] = dir;
+            pM->gap--;
+            continue;
+
+        }
+
+        pBuf[i] = dir | STEP_PIN;
+        pM->pulses++;
+
+        uint32_t ramp = (pM->speed * pM->speed - SPEED_MIN * SPEED_MIN) / (2 * ACCEL);
+        uint32_t left = MOVE_PULSES - pM->pulses;
+
+        if(left == 0){
+
+            //turn around, DIR changes on the next step
+            pM->pulses = 0;
+            pM->speed = SPEED_MIN;
+            pM->dir ^= 1;
+            dir = pM->dir ? DIR_PIN : 0;
+
+        }
+        else if(left <= ramp){ pM->speed -= ACCEL / pM->speed; }
+        else if(pM->speed < SPEED_MAX){ pM->speed += ACCEL / pM->speed; }
+
+        if(pM->speed < SPEED_MIN){ pM->speed = SPEED_MIN; }
+        if(pM->speed > SPEED_MAX){ pM->speed = SPEED_MAX; }
+
+        pM->gap = SAMPLES_PER_S / pM->speed - 1;
+
+    }
+
+    pM->fill_cycles += MIL_TIME_NOW() - start;
+
+    return len;
+
+}
+
+void Report(void){
+
+    static uint32_t last_fill;
+    MIL_PATTERN_Stats motor_stats;
+    MIL_PATTERN_Stats led_stats;
+
+    MIL_PATTERN_StatsGet(MIL_PATTERN_GEN0, &motor_stats);
+    MIL_PATTERN_StatsGet(MIL_PATTERN_GEN1, &led_stats);
+
+    uint32_t fill = motor.fill_cycles;
+
+    MIL_FMT_AddStr(&out, "motor steps ");
+    MIL_FMT_AddU32(&out, motor_stats.steps);
+    MIL_FMT_AddStr(&out, " speed ");
+    MIL_FMT_AddU32(&out, motor.speed);
+    MIL_FMT_AddStr(&out, "/s underruns ");
+    MIL_FMT_AddU32(&out, motor_stats.underruns);
+    MIL_FMT_AddStr(&out, " fill CPU ");
+
+    //cycles in the last second out of one second's worth
+    MIL_FMT_AddFloat(&out, 100.0f * (fill - last_fill) / SysCtlClockGet(), 2);
+    MIL_FMT_AddStr(&out, "%, led steps ");
+    MIL_FMT_AddU32(&out, led_stats.steps);
+    MIL_FMT_AddStr(&out, "\r\n");
+    MIL_FMT_Flush(&out);
+
+    last_fill = fill;
+
+}
+
+void Flush(void *pCtx, uint8_t *pData, uint16_t len){
+
+    (void)pCtx;
+
+    MIL_UART_OutArray(UART0_BASE, pData, (uint8_t)len);
+
+}
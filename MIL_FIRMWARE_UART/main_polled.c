@@ -21,17 +21,10 @@
 /* INCLUDES */
 #include <stdbool.h>
 #include <stdint.h>
-#include "inc/hw_can.h"
-#include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
-#include "inc/hw_types.h"
-#include "driverlib/can.h"
 #include "driverlib/gpio.h"
-#include "driverlib/interrupt.h"
-#include "driverlib/pin_map.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
-#include "utils/uartstdio.h"
 
 //MIL includes
 #include "MIL_CLK.h"
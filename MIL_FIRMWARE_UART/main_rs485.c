@@ -0,0 +1,205 @@
+/*
+ * Name: MIL_UART_RS485_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate several boards sharing one RS-485 bus
+ *       with MIL_RS485
+ *
+ *       Flash one board with BUS_ADDRESS set to MIL_BUS_MASTER_ADDR and up
+ *       to three more with BUS_ADDRESS 1, 2 and 3. The master polls each
+ *       node in turn. Every poll tells the node which LED color to show,
+ *       every reply carries the node's button state back. Hold SW1 on a
+ *       node and the master's LED follows that node
+ *
+ *       Once a second the master prints poll, reply and timeout
+ *       counters on UART0(the launchpad's USB serial port). Unplug a node
+ *       and only its timeouts go up
+ *
+ *       To try turnaround times and bus loads without hardware,
+ *       build and run tools/bus_sim.c
+ *
+ * Hardware Notes:
+ * UART 1 on Port B to an RS-485 transceiver(MAX485 or similar) per board
+ * PB0 - UART RX, to RO
+ * PB1 - UART TX, to DI
+ * PB2 - driver enable, to DE(tie RE to ground)
+ * A and B of every transceiver on the same twisted pair
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ *
+ * PF1/PF2/PF3 - RGB LED, PF4 - SW1
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_RS485.h"
+
+/************************DEFINES******************************/
+
+//change for each board
+#define BUS_ADDRESS MIL_BUS_MASTER_ADDR
+
+#define NUM_NODES 3
+
+#define LEDS (GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+#define REPORT_US 1000000
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+uint8_t Fill(void *pCtx, uint8_t to, uint8_t *pPayload);
+void Deliver(void *pCtx, uint8_t from, const uint8_t *pData, uint8_t len);
+void Report(void);
+void OutInt(int32_t value);
+
+/************************GLOBALS******************************/
+
+const uint8_t NODES[NUM_NODES] = {1, 2, 3};
+
+//LED color each node is told to show
+const uint8_t COLORS[NUM_NODES] = {GPIO_PIN_1, GPIO_PIN_3, GPIO_PIN_2};
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    InitGPIO();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_RS485_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, BUS_ADDRESS,
+                   GPIO_PORTB_BASE, GPIO_PIN_2, Fill, Deliver, 0);
+
+    IntMasterEnable();
+
+    if(BUS_ADDRESS == MIL_BUS_MASTER_ADDR){ MIL_RS485_MasterStart(NODES, NUM_NODES); }
+
+    uint32_t report_cycles = MIL_TIME_FromUs(REPORT_US);
+    uint32_t last_report = MIL_TIME_NOW();
+
+    while(1){
+
+        MIL_RS485_Poll();
+
+        if(BUS_ADDRESS == MIL_BUS_MASTER_ADDR && (MIL_TIME_NOW() - last_report) >= report_cycles){
+
+            last_report += report_cycles;
+            Report();
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, LEDS);
+    GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, GPIO_PIN_4);
+    GPIOPadConfigSet(GPIO_PORTF_BASE, GPIO_PIN_4, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+}
+
+//master: the color for that node, node: whether SW1 is held
+uint8_t Fill(void *pCtx, uint8_t to, uint8_t *pPayload){
+
+    (void)pCtx;
+
+    if(BUS_ADDRESS == MIL_BUS_MASTER_ADDR){
+
+        pPayload[0] = COLORS[(to - 1) % NUM_NODES];
+
+    }
+    else{
+
+        pPayload[0] = (GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_4) == 0);
+
+    }
+
+    return 1;
+
+}
+
+void Deliver(void *pCtx, uint8_t from, const uint8_t *pData, uint8_t len){
+
+    (void)pCtx;
+
+    //every payload here is one byte, an empty one carries nothing
+    if(len == 0){ return; }
+
+    if(BUS_ADDRESS != MIL_BUS_MASTER_ADDR){
+
+        GPIOPinWrite(GPIO_PORTF_BASE, LEDS, pData[0] & LEDS);
+
+    }
+    else if(pData[0]){
+
+        //show the color of the node whose button is held
+        GPIOPinWrite(GPIO_PORTF_BASE, LEDS, COLORS[(from - 1) % NUM_NODES]);
+
+    }
+
+}
+
+void Report(void){
+
+    MIL_RS485_Stats stats;
+    MIL_RS485_StatsGet(&stats);
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"polls ");
+    OutInt(stats.bus.polls);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" replies ");
+    OutInt(stats.bus.replies);
+
+    for(uint8_t i = 0; i < NUM_NODES; i++){
+
+        MIL_UART_OutCString(UART0_BASE, (uint8_t *)" timeouts(");
+        OutInt(NODES[i]);
+        MIL_UART_OutCString(UART0_BASE, (uint8_t *)") ");
+        OutInt(stats.bus.node_timeouts[i]);
+
+    }
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" bad ");
+    OutInt(stats.bus.bad_frames);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"\r\n");
+
+}
+
+void OutInt(int32_t value){
+
+    uint8_t digits[12];
+    int8_t i = 11;
+    uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (mag % 10); mag /= 10; }while(mag);
+    if(value < 0){ digits[--i] = '-'; }
+
+    MIL_UART_OutCString(UART0_BASE, &digits[i]);
+
+}
@@ -0,0 +1,126 @@
+/*
+ * Name: MIL_UART_RX_Timestamp_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate MIL_RXTS by checking its timestamps
+ *       against a frame whose send time is known
+ *
+ *       UART3 sends an 8 byte "sensor message" into an empty TX FIFO,
+ *       so the start bit goes out right after MIL_TIME is read. UART1
+ *       receives it with MIL_RXTS and the demo prints how far the start
+ *       of frame stamp was from the send time, in cycles and in bit times
+ *
+ *       The error should stay under one bit time(139 cycles at 115.2k
+ *       and 16MHz). Try different FIFO depths in MIL_RXTS_Init, the error
+ *       should not change
+ *
+ * Hardware Notes:
+ * UART 1 on Port B(receiver, also prints results)
+ * PB0 - UART RX
+ * PB1 - UART TX
+ *
+ * UART 3 on Port C(stand in sensor)
+ * PC7 - UART TX, jumper this to PB0
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_RXTS.h"
+
+/************************DEFINES******************************/
+
+#define MSG_LEN 8
+#define RX_BUF_LEN 32
+
+/************************GLOBALS******************************/
+
+static MIL_RXTS_Byte RX_BUF[RX_BUF_LEN];
+
+static uint8_t MSG[MSG_LEN] = {0xB5, 0x62, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void OutInt(int32_t value);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART3_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_RXTS_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, 4, RX_BUF, RX_BUF_LEN);
+
+    //nothing may delay the timestamp ISR
+    MIL_UART_ISRPrioritySet(UART1_BASE, MIL_INT_PRI_TIMER);
+
+    IntMasterEnable();
+
+    uint32_t bit_cycles = SysCtlClockGet() / MIL_DEFAULT_BAUD_115K;
+
+    while(1){
+
+        //TX FIFO is empty, the start bit follows the first write
+        while(UARTBusy(UART3_BASE));
+        uint32_t sent = MIL_TIME_NOW();
+        MIL_UART_OutArray(UART3_BASE, MSG, MSG_LEN);
+
+        //whole message plus the RX timeout
+        SysCtlDelay(SysCtlClockGet() / 300);
+
+        MIL_RXTS_Byte rx;
+        uint8_t count = 0;
+        int32_t error = 0;
+
+        while(MIL_RXTS_Get(UART1_BASE, &rx)){
+
+            if(rx.sof){ error = (int32_t)(rx.stamp - sent); }
+            count++;
+
+        }
+
+        MIL_UART_OutCString(UART1_BASE, (uint8_t *)"bytes ");
+        OutInt(count);
+        MIL_UART_OutCString(UART1_BASE, (uint8_t *)" sof error ");
+        OutInt(error);
+        MIL_UART_OutCString(UART1_BASE, (uint8_t *)" cycles(");
+        OutInt(error * 100 / (int32_t)bit_cycles);
+        MIL_UART_OutCString(UART1_BASE, (uint8_t *)"% of a bit)\r\n");
+
+        //let the printout finish so the next message starts a new frame
+        SysCtlDelay(SysCtlClockGet() / 30);
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void OutInt(int32_t value){
+
+    uint8_t digits[12];
+    int8_t i = 11;
+    uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (mag % 10); mag /= 10; }while(mag);
+    if(value < 0){ digits[--i] = '-'; }
+
+    MIL_UART_OutCString(UART1_BASE, &digits[i]);
+
+}
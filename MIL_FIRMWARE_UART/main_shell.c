@@ -0,0 +1,137 @@
+/*
+ * Name: MIL_UART_Shell_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate configuring a running board
+ *       from a terminal with MIL_SHELL
+ *
+ *       Commands:
+ *          led on|off   turns the launchpad LEDs on or off
+ *          drops        prints how many lines were thrown away
+ *
+ *       The main loop is left free to show
+ *       that typing never stalls it, put your control loop there
+ *
+ * Hardware Notes:
+ * UART 1 on Port B
+ * PB0 - UART RX
+ * PB1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_UART.h"
+#include "MIL_SHELL.h"
+
+/************************DEFINES******************************/
+
+#define LED_PINS (GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+
+//shell commands
+void LedCmd(uint32_t base, uint8_t argc, char *argv[]);
+void DropsCmd(uint32_t base, uint8_t argc, char *argv[]);
+
+/************************COMMAND TABLE******************************/
+
+static const MIL_SHELL_Cmd COMMANDS[] = {
+
+    {"led",   LedCmd},
+    {"drops", DropsCmd},
+
+};
+
+#define NUM_COMMANDS (sizeof(COMMANDS) / sizeof(COMMANDS[0]))
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+
+    InitGPIO();
+
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_SHELL_Init(UART1_BASE, COMMANDS, NUM_COMMANDS);
+
+    IntMasterEnable();
+
+    while(1){
+
+        //returns right away unless a whole line is waiting
+        MIL_SHELL_Poll();
+
+        /*******CONTROL LOOP GOES HERE*******/
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, LED_PINS);
+
+}
+
+void LedCmd(uint32_t base, uint8_t argc, char *argv[]){
+
+    (void)base;
+
+    if(argc == 2 && strcmp(argv[1], "on") == 0){
+
+        GPIOPinWrite(GPIO_PORTF_BASE, LED_PINS, LED_PINS);
+
+    }
+    else if(argc == 2 && strcmp(argv[1], "off") == 0){
+
+        GPIOPinWrite(GPIO_PORTF_BASE, LED_PINS, 0x00);
+
+    }
+    else{
+
+        MIL_SHELL_Out("usage: led on|off\r\n");
+
+    }
+
+}
+
+void DropsCmd(uint32_t base, uint8_t argc, char *argv[]){
+
+    (void)base;
+    (void)argc;
+    (void)argv;
+
+    //small enough to not need a number formatting library
+    char msg[] = "dropped: 0000000000\r\n";
+    uint32_t value = MIL_SHELL_DroppedGet();
+
+    for(int8_t i = 18; i >= 9; i--){
+
+        msg[i] = '0' + (value % 10);
+        value /= 10;
+
+    }
+
+    MIL_SHELL_Out(msg);
+
+}
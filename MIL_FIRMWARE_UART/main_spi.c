@@ -0,0 +1,278 @@
+/*
+ * Name: MIL_UART_SPI_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will measure MIL_SPI throughput with a loopback wire
+ *
+ *       For each bit rate and transaction size the board runs the same
+ *       bytes two ways:
+ *
+ *          blocking: MIL_SPI_Transfer one at a time, the bus sits idle
+ *                    while the CPU gets the next one going
+ *          queued:   QUEUED transactions submitted at once, the ISR
+ *                    starts each one as the last finishes
+ *
+ *       Every received byte is checked against what was sent. Results go
+ *       out on UART0 as bytes/s and percent of the bit rate, small
+ *       transactions show the setup cost, big ones approach the line
+ *
+ *       After the sweep a 1kHz periodic read runs alongside queued bulk
+ *       traffic for a second, and the overrun count is reported
+ *
+ *       To try setups without hardware, build and run tools/spi_sim.c
+ *
+ * Hardware Notes:
+ * SSI 0 on Port A, jumper PA5 to PA4
+ * PA2 - SSI CLK
+ * PA3 - CS(GPIO, nothing connected)
+ * PA4 - SSI RX
+ * PA5 - SSI TX
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_FMT.h"
+#include "MIL_SPI.h"
+
+/************************DEFINES******************************/
+
+#define MAX_SIZE 1024
+#define QUEUED 8
+#define ROUNDS 4
+
+/************************FUNCTION PROTOTYPES******************************/
+
+uint32_t RunBlocking(uint16_t len, uint32_t *pErrors);
+uint32_t RunQueued(uint16_t len, uint32_t *pErrors);
+void Result(const char *pName, uint16_t len, uint32_t cycles, uint32_t errors);
+void PeriodicTest(void);
+void Flush(void *pCtx, uint8_t *pData, uint16_t len);
+
+/************************GLOBALS******************************/
+
+MIL_SPI_Dev loop = {GPIO_PORTA_BASE, GPIO_PIN_3, 1000000, MIL_SPI_MODE_0};
+
+uint8_t tx_data[MAX_SIZE];
+uint8_t rx_data[QUEUED][MAX_SIZE];
+MIL_SPI_Xfer xfers[QUEUED];
+
+uint8_t line[96];
+MIL_FMT_Buf out;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_FMT_BufInit(&out, line, sizeof(line), Flush, 0);
+
+    MIL_InitSPI(SSI0_BASE);
+    MIL_SPI_DevInit(&loop);
+
+    IntMasterEnable();
+
+    for(uint16_t i = 0; i < MAX_SIZE; i++){ tx_data[i] = (uint8_t)(i * 7 + 1); }
+
+    //the SSI clock tops out at half the system clock
+    const uint32_t RATES[] = {1000000, 4000000, 8000000};
+    const uint16_t SIZES[] = {1, 4, 16, 64, 256, 1024};
+
+    for(uint8_t r = 0; r < sizeof(RATES) / sizeof(RATES[0]); r++){
+
+        loop.bit_rate = RATES[r];
+
+        MIL_FMT_AddStr(&out, "\r\n");
+        MIL_FMT_AddU32(&out, RATES[r]);
+        MIL_FMT_AddStr(&out, " bit/s, line is ");
+        MIL_FMT_AddU32(&out, RATES[r] / 8);
+        MIL_FMT_AddStr(&out, " B/s\r\n");
+        MIL_FMT_Flush(&out);
+
+        for(uint8_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++){
+
+            uint32_t errors;
+            uint32_t cycles;
+
+            cycles = RunBlocking(SIZES[s], &errors);
+            Result("blocking", SIZES[s], cycles, errors);
+
+            cycles = RunQueued(SIZES[s], &errors);
+            Result("queued  ", SIZES[s], cycles, errors);
+
+        }
+
+    }
+
+    PeriodicTest();
+
+    while(1);
+
+}
+
+/************************FUNCTIONS******************************/
+
+static uint32_t Check(const uint8_t *pRx, uint16_t len){
+
+    uint32_t errors = 0;
+
+    for(uint16_t i = 0; i < len; i++){ errors += (pRx[i] != tx_data[i]); }
+
+    return errors;
+
+}
+
+uint32_t RunBlocking(uint16_t len, uint32_t *pErrors){
+
+    *pErrors = 0;
+
+    uint32_t start = MIL_TIME_NOW();
+
+    for(uint8_t n = 0; n < QUEUED * ROUNDS; n++){
+
+        MIL_SPI_Transfer(SSI0_BASE, &loop, tx_data, rx_data[n % QUEUED], len);
+
+    }
+
+    uint32_t cycles = MIL_TIME_NOW() - start;
+
+    for(uint8_t n = 0; n < QUEUED; n++){ *pErrors += Check(rx_data[n], len); }
+
+    return cycles;
+
+}
+
+uint32_t RunQueued(uint16_t len, uint32_t *pErrors){
+
+    *pErrors = 0;
+
+    uint32_t start = MIL_TIME_NOW();
+
+    for(uint8_t round = 0; round < ROUNDS; round++){
+
+        for(uint8_t n = 0; n < QUEUED; n++){
+
+            //wait for this slot's last run before reusing it
+            while(xfers[n].state == MIL_SPI_QUEUED || xfers[n].state == MIL_SPI_ACTIVE);
+
+            xfers[n].pDev = &loop;
+            xfers[n].pTx = tx_data;
+            xfers[n].pRx = rx_data[n];
+            xfers[n].len = len;
+            MIL_SPI_Submit(SSI0_BASE, &xfers[n]);
+
+        }
+
+    }
+
+    while(MIL_SPI_Busy(SSI0_BASE));
+
+    uint32_t cycles = MIL_TIME_NOW() - start;
+
+    for(uint8_t n = 0; n < QUEUED; n++){ *pErrors += Check(rx_data[n], len); }
+
+    return cycles;
+
+}
+
+void Result(const char *pName, uint16_t len, uint32_t cycles, uint32_t errors){
+
+    uint32_t bytes = (uint32_t)len * QUEUED * ROUNDS;
+    uint32_t us = MIL_TIME_ToUs(cycles);
+    uint32_t bytes_per_s = (uint32_t)((uint64_t)bytes * 1000000 / us);
+    uint32_t line_pct = (uint32_t)((uint64_t)bytes_per_s * 800 / loop.bit_rate);
+
+    MIL_FMT_AddStr(&out, pName);
+    MIL_FMT_AddStr(&out, " ");
+    MIL_FMT_AddU32(&out, len);
+    MIL_FMT_AddStr(&out, " B: ");
+    MIL_FMT_AddU32(&out, bytes_per_s);
+    MIL_FMT_AddStr(&out, " B/s ");
+    MIL_FMT_AddU32(&out, line_pct);
+    MIL_FMT_AddStr(&out, "% of line, errors ");
+    MIL_FMT_AddU32(&out, errors);
+    MIL_FMT_AddStr(&out, "\r\n");
+    MIL_FMT_Flush(&out);
+
+}
+
+/*
+ * Desc: a 14 byte read every millisecond while 256 byte bulk transfers
+ *       keep the bus busy, a bulk transfer is about 0.26ms at 8Mbit/s
+ *       so the periodic read should never miss a tick
+ */
+void PeriodicTest(void){
+
+    static MIL_SPI_Xfer sample;
+    static uint8_t sample_rx[14];
+
+    MIL_SPIQ_Stats before;
+    MIL_SPIQ_Stats after;
+
+    sample.pDev = &loop;
+    sample.pTx = tx_data;
+    sample.pRx = sample_rx;
+    sample.len = sizeof(sample_rx);
+
+    MIL_SPI_StatsGet(SSI0_BASE, &before);
+    MIL_SPI_PeriodicStart(SSI0_BASE, &sample, 1000);
+
+    uint32_t start = MIL_TIME_NOW();
+    uint32_t second = MIL_TIME_FromUs(1000000);
+
+    while((MIL_TIME_NOW() - start) < second){
+
+        for(uint8_t n = 0; n < 2; n++){
+
+            if(xfers[n].state != MIL_SPI_QUEUED && xfers[n].state != MIL_SPI_ACTIVE){
+
+                xfers[n].len = 256;
+                MIL_SPI_Submit(SSI0_BASE, &xfers[n]);
+
+            }
+
+        }
+
+    }
+
+    MIL_SPI_PeriodicStop(SSI0_BASE);
+    while(MIL_SPI_Busy(SSI0_BASE));
+
+    MIL_SPI_StatsGet(SSI0_BASE, &after);
+
+    MIL_FMT_AddStr(&out, "\r\n1kHz read with bulk traffic: ");
+    MIL_FMT_AddU32(&out, after.xfers - before.xfers);
+    MIL_FMT_AddStr(&out, " transactions, overruns ");
+    MIL_FMT_AddU32(&out, after.overruns - before.overruns);
+    MIL_FMT_AddStr(&out, ", deepest queue ");
+    MIL_FMT_AddU32(&out, after.queue_max);
+    MIL_FMT_AddStr(&out, "\r\n");
+    MIL_FMT_Flush(&out);
+
+}
+
+void Flush(void *pCtx, uint8_t *pData, uint16_t len){
+
+    (void)pCtx;
+
+    MIL_UART_OutArray(UART0_BASE, pData, (uint8_t)len);
+
+}
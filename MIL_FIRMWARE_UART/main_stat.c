@@ -0,0 +1,133 @@
+/*
+ * Name: MIL_UART_Stats_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate watching driver counters live with MIL_STAT
+ *
+ *       UART3 sends a 64 byte block through MIL_UARTQ every 10ms. UART1
+ *       receives it with MIL_RXTS. Both drivers register with MIL_STAT at
+ *       Init, UART0(the launchpad's USB serial port) answers the PC
+ *
+ *       On the PC:
+ *          python tools/mil_stat.py COM5           (a table every second)
+ *          python tools/mil_stat.py COM5 --plot    (live plot, needs matplotlib)
+ *
+ *       UARTQ0 should show about 6400 tx bytes/s and RXTS1 the same in rx.
+ *       Hold SW1 to stop the main loop reading RXTS, its ring fills and the
+ *       rate moves from rx into dropped. The ISRs still run, so isr/s
+ *       doesn't change
+ *
+ * Hardware Notes:
+ * UART 0 on Port A(USB, MIL_STAT)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ *
+ * UART 1 on Port B(receiver)
+ * PB0 - UART RX
+ *
+ * UART 3 on Port C(sender)
+ * PC7 - UART TX, jumper this to PB0
+ *
+ * PF4 - SW1, stop reading
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_UARTQ.h"
+#include "MIL_RXTS.h"
+#include "MIL_STAT.h"
+
+#if !MIL_STAT_EN
+#error "main_stat.c needs MIL_STAT_EN set to 1 in MIL_CONFIG.h"
+#endif
+
+/************************DEFINES******************************/
+
+#define SW1_PIN GPIO_PIN_4
+
+#define BLOCK_LEN 64
+#define RX_BUF_LEN 128
+
+/************************GLOBALS******************************/
+
+static MIL_RXTS_Byte RX_BUF[RX_BUF_LEN];
+
+static uint8_t BLOCK[BLOCK_LEN];
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    InitGPIO();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART3_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_STAT_Init(UART0_BASE);
+
+    //registered in this order, the PC sees UARTQ0 then RXTS1
+    MIL_UARTQ_Init(UART3_BASE, 0, 0);
+    MIL_RXTS_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, 4, RX_BUF, RX_BUF_LEN);
+
+    IntMasterEnable();
+
+    for(uint8_t i = 0; i < BLOCK_LEN; i++){ BLOCK[i] = i; }
+
+    uint32_t period = MIL_TIME_FromUs(10000);
+    uint32_t next = MIL_TIME_NOW();
+
+    MIL_RXTS_Byte rx;
+
+    while(1){
+
+        if((int32_t)(MIL_TIME_NOW() - next) >= 0){
+
+            MIL_UARTQ_Send(UART3_BASE, 0, BLOCK, BLOCK_LEN);
+            next += period;
+
+        }
+
+        //SW1 pulls PF4 low when pressed
+        if(GPIOPinRead(GPIO_PORTF_BASE, SW1_PIN)){
+
+            while(MIL_RXTS_Get(UART1_BASE, &rx));
+
+        }
+
+        MIL_UARTQ_Poll();
+        MIL_STAT_Poll();
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, SW1_PIN);
+    GPIOPadConfigSet(GPIO_PORTF_BASE, SW1_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+}
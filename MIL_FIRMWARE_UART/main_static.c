@@ -0,0 +1,57 @@
+/*
+ * Name: MIL_UART_Static_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate a compile time UART instance
+ *       from MIL_UART_STATIC
+ *
+ *       Same echo as main_polled.c, but the UART number, clock and baud
+ *       rate are checked by the compiler and the setup is a few register
+ *       writes instead of library calls
+ *
+ *       Try uncommenting the BAD instance below, the build stops
+ *       and says why
+ *
+ * Hardware Notes:
+ * UART 1 on Port B
+ * PB0 - UART RX
+ * PB1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_UART.h"
+#include "MIL_UART_STATIC.h"
+
+/************************UART INSTANCES******************************/
+
+MIL_UART_STATIC(TERM, 1, MIL_16MHz, MIL_DEFAULT_BAUD_115K)
+
+//4M needs a 32MHz clock at least, fails the build
+//MIL_UART_STATIC(BAD, 1, MIL_16MHz, 4000000)
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+
+    TERM_Init();
+
+    TERM_OutCString("By Marquez Jones\r\n");
+
+    while(1){
+
+        if(TERM_Avail()){
+
+            TERM_Put(TERM_Get());
+
+        }
+
+    }
+
+}
@@ -0,0 +1,178 @@
+/*
+ * Name: MIL_UART_Software_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will find how fast MIL_SUART can run on your board
+ *
+ *       SUART0 is wired back to itself. At each baud rate the board
+ *       sends a block of bytes out of TX, reads them back on RX and
+ *       counts every byte that came back wrong or not at all. It also
+ *       adds up the cycles spent in the SUART ISRs, which is the CPU
+ *       time a port costs while it sends and receives at full speed
+ *
+ *       Each rate runs twice. "stream" keeps TX busy back to back, "gaps"
+ *       waits for TX to go idle before every byte, so each byte starts
+ *       right after the previous stop bit. A stop bit cut short only
+ *       shows up in the second run
+ *
+ *       Results go out UART0(the launchpad's USB serial port), two lines
+ *       per baud rate then the fastest rate with no errors in either
+ *
+ *       Run it again with a long MIL_INT critical section or a busy
+ *       timer ISR in the loop to see how much margin real code leaves
+ *
+ * Hardware Notes:
+ * Software UART 0 on Port E, looped back
+ * PE3 - SUART TX, wire to PE2
+ * PE2 - SUART RX
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_SUART.h"
+
+/************************DEFINES******************************/
+
+#define TEST_BYTES 2000
+
+/************************FUNCTION PROTOTYPES******************************/
+
+uint32_t RunBaud(uint32_t baud, bool gaps);
+void OutInt(int32_t value);
+
+/************************GLOBALS******************************/
+
+const uint32_t BAUDS[] = {9600, 14400, 19200, 28800, 38400, 57600, 76800, 115200};
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+
+    //lets MIL_InitUART and the MIL_UART_Char functions take MIL_SUART0_BASE
+    MIL_SUART_Init();
+
+    IntMasterEnable();
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"SUART0 loopback, PE3 to PE2\r\n");
+
+    uint32_t best = 0;
+
+    for(uint8_t i = 0; i < sizeof(BAUDS) / sizeof(BAUDS[0]); i++){
+
+        uint32_t errors = RunBaud(BAUDS[i], false);
+        errors += RunBaud(BAUDS[i], true);
+
+        if(errors == 0){ best = BAUDS[i]; }
+
+    }
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"fastest with no errors: ");
+    OutInt(best);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" baud\r\n");
+
+    while(1);
+
+}
+
+/************************FUNCTIONS******************************/
+
+/*
+ * Desc: sends TEST_BYTES through the loopback at one baud rate,
+ *       prints the results and returns the error count
+ *
+ *       gaps: let TX go idle before each byte instead of streaming
+ */
+uint32_t RunBaud(uint32_t baud, bool gaps){
+
+    MIL_InitUART(MIL_SUART0_BASE, baud);
+
+    uint32_t errors = 0;
+    uint16_t sent = 0;
+    uint16_t received = 0;
+    uint32_t start = MIL_TIME_NOW();
+
+    //3 byte times with nothing received means everything in flight has landed
+    uint32_t quiet = MIL_TIME_FromUs(30000000 / baud);
+    uint32_t last_rx = start;
+
+    while(received < TEST_BYTES && (MIL_TIME_NOW() - last_rx) < quiet){
+
+        //streaming keeps a few bytes ahead so TX never idles, without flooding RX
+        bool ready = gaps ? !MIL_SUART_Busy(MIL_SUART0_BASE) : (uint16_t)(sent - received) < MIL_SUART_BUF_LEN / 2;
+
+        if(sent < TEST_BYTES && ready){
+
+            MIL_UART_CharPut(MIL_SUART0_BASE, (uint8_t)(sent * 7));
+            sent++;
+
+        }
+
+        int32_t data = MIL_UART_CharGetNonBlocking(MIL_SUART0_BASE);
+
+        if(data >= 0){
+
+            if((uint8_t)data != (uint8_t)(received * 7)){ errors++; }
+            received++;
+            last_rx = MIL_TIME_NOW();
+
+        }
+
+    }
+
+    uint32_t elapsed = MIL_TIME_NOW() - start;
+
+    MIL_SUART_Stats stats;
+    MIL_SUART_StatsGet(MIL_SUART0_BASE, &stats);
+
+    //bytes that never came back count too
+    errors += TEST_BYTES - received;
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"baud ");
+    OutInt(baud);
+    MIL_UART_OutCString(UART0_BASE, gaps ? (uint8_t *)" gaps: errors " : (uint8_t *)" stream: errors ");
+    OutInt(errors);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)", framing ");
+    OutInt(stats.framing_errors);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)", glitches ");
+    OutInt(stats.glitches);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)", cpu ");
+    OutInt((uint32_t)((uint64_t)stats.isr_cycles * 100 / elapsed));
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"%\r\n");
+
+    return errors;
+
+}
+
+void OutInt(int32_t value){
+
+    uint8_t digits[12];
+    int8_t i = 11;
+    uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (mag % 10); mag /= 10; }while(mag);
+    if(value < 0){ digits[--i] = '-'; }
+
+    MIL_UART_OutCString(UART0_BASE, &digits[i]);
+
+}
@@ -0,0 +1,151 @@
+/*
+ * Name: MIL_UART_Sync_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate keeping two boards' clocks in step
+ *       with MIL_SYNC
+ *
+ *       Flash one board with SYNC_ROLE set to MIL_SYNC_MASTER and the
+ *       other with MIL_SYNC_SLAVE. Both toggle PF2(blue LED) every time
+ *       the synced clock crosses a 100ms boundary. Put a scope on both PF2
+ *       pins, once the slave syncs the edges line up to within a few
+ *       microseconds even though the two oscillators differ
+ *
+ *       The slave also prints its sync error, link delay and drift
+ *       once a second on UART0(the launchpad's USB serial port)
+ *
+ *       To see the host side of this without hardware, build and
+ *       run tools/sync_sim.c
+ *
+ * Hardware Notes:
+ * UART 1 on Port B, crossed between the boards
+ * PB0 - UART RX, to the other board's PB1
+ * PB1 - UART TX, to the other board's PB0
+ * connect the grounds
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_SYNC.h"
+
+/************************DEFINES******************************/
+
+//change for the second board
+#define SYNC_ROLE MIL_SYNC_MASTER
+
+//100ms in master cycles
+#define TICK_CYCLES 1600000
+
+#define REPORT_TICKS 10
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+void Report(void);
+void OutInt(int32_t value);
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    InitGPIO();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_InitUART(UART1_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_SYNC_Init(UART1_BASE, MIL_DEFAULT_BAUD_115K, SYNC_ROLE);
+
+    IntMasterEnable();
+
+    uint64_t last_tick = 0;
+    uint32_t ticks = 0;
+
+    while(1){
+
+        MIL_SYNC_Poll();
+
+        if(!MIL_SYNC_Synced()){ continue; }
+
+        uint64_t tick = MIL_SYNC_Now() / TICK_CYCLES;
+
+        if(tick != last_tick){
+
+            last_tick = tick;
+
+            GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, (tick & 1) ? GPIO_PIN_2 : 0);
+
+            if(SYNC_ROLE == MIL_SYNC_SLAVE && ++ticks == REPORT_TICKS){
+
+                ticks = 0;
+                Report();
+
+            }
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, GPIO_PIN_2);
+
+}
+
+void Report(void){
+
+    MIL_SYNC_Stats stats;
+    MIL_SYNC_StatsGet(&stats);
+
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"error ");
+    OutInt(stats.clock.offset);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" worst ");
+    OutInt(stats.clock.offset_max);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" delay ");
+    OutInt(stats.clock.delay);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)" cycles, drift ");
+    OutInt(stats.clock.freq_ppb / 1000);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"ppm, timeouts ");
+    OutInt(stats.timeouts);
+    MIL_UART_OutCString(UART0_BASE, (uint8_t *)"\r\n");
+
+}
+
+void OutInt(int32_t value){
+
+    uint8_t digits[12];
+    int8_t i = 11;
+    uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    digits[i] = 0;
+    do{ digits[--i] = '0' + (mag % 10); mag /= 10; }while(mag);
+    if(value < 0){ digits[--i] = '-'; }
+
+    MIL_UART_OutCString(UART0_BASE, &digits[i]);
+
+}
@@ -0,0 +1,206 @@
+/*
+ * Name: MIL_UART_Telem_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate compressing telemetry before it goes out
+ *       the UART with MIL_PACK and MIL_LZ
+ *
+ *       Every SAMPLE_US the board makes one sample of 8 made up channels
+ *       (a timestamp, slow sensors, a noisy IMU, a counter and status
+ *       flags), compresses it with METHOD and sends it as one frame on
+ *       UART0(the launchpad's USB serial port)
+ *
+ *       Once a second it also sends a stats frame with how many raw and
+ *       sent bytes went out and how many cycles compression took
+ *
+ *       Capture the serial port to a file and decode it on the host:
+ *          ./telem decode < capture.bin
+ *
+ *       Try each METHOD, the stats lines show the ratio and cycles per
+ *       byte on the real hardware. ./telem bench shows the same on the host
+ *
+ * Frame Format(must match tools/telem.c):
+ *      [0xA5][kind][len][payload]
+ *
+ *      kind is one of the KIND defines, plus FRAME_RESET on key frames.
+ *      Both ends start a fresh history on a key frame, so a frame lost
+ *      in the capture only costs the samples up to the next one
+ *
+ * Hardware Notes:
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_PACK.h"
+#include "MIL_LZ.h"
+
+/************************DEFINES******************************/
+
+#define CHANNELS      8
+#define SAMPLE_BYTES  (CHANNELS * 4)
+
+#define FRAME_SOF     0xA5
+#define FRAME_RESET   0x80
+#define KIND_RAW      1
+#define KIND_DELTA    2
+#define KIND_LZ       3
+#define KIND_DELTA_LZ 4
+#define KIND_STATS    5
+
+//pick one of the KIND defines above
+#define METHOD KIND_DELTA_LZ
+
+#define SAMPLE_US 5000
+#define KEY_FRAME_SAMPLES 100
+#define STATS_SAMPLES (1000000 / SAMPLE_US)
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void MakeSample(uint32_t n, int32_t *pSamples);
+void SendFrame(uint8_t kind, uint8_t *pPayload, uint8_t len);
+void PutU32(uint8_t *pDst, uint32_t value);
+
+/************************GLOBALS******************************/
+
+MIL_PACK_Delta pack;
+MIL_LZ lz;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+
+    MIL_PACK_DeltaInit(&pack, CHANNELS);
+    MIL_LZ_Init(&lz);
+
+    int32_t samples[CHANNELS];
+    uint8_t packed[SAMPLE_BYTES + MIL_PACK_MAX_OUT(CHANNELS)];
+    uint8_t out[MIL_LZ_MAX_OUT(sizeof(packed))];
+
+    uint32_t raw_bytes = 0;
+    uint32_t sent_bytes = 0;
+    uint32_t cycles = 0;
+
+    uint32_t sample_cycles = MIL_TIME_FromUs(SAMPLE_US);
+    uint32_t next = MIL_TIME_NOW();
+
+    for(uint32_t n = 0; ; n++){
+
+        while((int32_t)(MIL_TIME_NOW() - next) < 0);
+        next += sample_cycles;
+
+        MakeSample(n, samples);
+
+        uint8_t kind = METHOD;
+        if(n % KEY_FRAME_SAMPLES == 0){
+
+            kind |= FRAME_RESET;
+            MIL_PACK_DeltaReset(&pack);
+            MIL_LZ_Init(&lz);
+
+        }
+
+        uint32_t start = MIL_TIME_NOW();
+        uint8_t *pOut = packed;
+        uint16_t len;
+
+        if(METHOD == KIND_DELTA || METHOD == KIND_DELTA_LZ){
+
+            len = MIL_PACK_DeltaEncode(&pack, samples, packed);
+
+        }
+        else{
+
+            for(uint8_t ch = 0; ch < CHANNELS; ch++){ PutU32(&packed[4 * ch], (uint32_t)samples[ch]); }
+            len = SAMPLE_BYTES;
+
+        }
+
+        if(METHOD == KIND_LZ || METHOD == KIND_DELTA_LZ){
+
+            len = MIL_LZ_Encode(&lz, packed, len, out);
+            pOut = out;
+
+        }
+
+        cycles += MIL_TIME_NOW() - start;
+        raw_bytes += SAMPLE_BYTES;
+        sent_bytes += len + 3;
+
+        SendFrame(kind, pOut, (uint8_t)len);
+
+        if(n % STATS_SAMPLES == STATS_SAMPLES - 1){
+
+            uint8_t stats[12];
+
+            PutU32(&stats[0], raw_bytes);
+            PutU32(&stats[4], sent_bytes);
+            PutU32(&stats[8], cycles);
+            SendFrame(KIND_STATS, stats, sizeof(stats));
+
+            raw_bytes = 0;
+            sent_bytes = 0;
+            cycles = 0;
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+//slow sensors, a noisy IMU and counters, no floats
+void MakeSample(uint32_t n, int32_t *pSamples){
+
+    static uint32_t lfsr = 0xACE1u;
+    uint32_t ramp = n % 2000;
+
+    //cheap noise, xorshift
+    lfsr ^= lfsr << 13;
+    lfsr ^= lfsr >> 17;
+    lfsr ^= lfsr << 5;
+
+    pSamples[0] = (int32_t)(n * (SAMPLE_US / 1000));                            //timestamp ms
+    pSamples[1] = 2500 + (int32_t)((ramp < 1000) ? ramp : 2000 - ramp) / 40;    //temperature 0.01C
+    pSamples[2] = 12000 - (int32_t)(n / 50) + (int32_t)(lfsr & 3);              //battery mV
+    pSamples[3] = (int32_t)((lfsr >> 4) % 41) - 20;                             //accel x
+    pSamples[4] = (int32_t)((lfsr >> 10) % 41) - 20;                            //accel y
+    pSamples[5] = 1000 + (int32_t)((lfsr >> 16) % 41) - 20;                     //accel z
+    pSamples[6] = (int32_t)(n / 7);                                             //encoder counts
+    pSamples[7] = (ramp < 1800) ? 0x01 : 0x03;                                  //status flags
+
+}
+
+void SendFrame(uint8_t kind, uint8_t *pPayload, uint8_t len){
+
+    uint8_t header[3] = {FRAME_SOF, kind, len};
+
+    MIL_UART_OutArray(UART0_BASE, header, 3);
+    MIL_UART_OutArray(UART0_BASE, pPayload, len);
+
+}
+
+void PutU32(uint8_t *pDst, uint32_t value){
+
+    pDst[0] = (uint8_t)value;
+    pDst[1] = (uint8_t)(value >> 8);
+    pDst[2] = (uint8_t)(value >> 16);
+    pDst[3] = (uint8_t)(value >> 24);
+
+}
@@ -0,0 +1,211 @@
+/*
+ * Name: MIL_UART_Topic_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate sharing data between an ISR and the
+ *       main loop with MIL_TOPIC instead of a global
+ *
+ *       The SW1 edge ISR publishes every press and release on the
+ *       "button" topic. The main loop has two subscribers:
+ *
+ *          the LED only cares about the newest state(latest value)
+ *          the logger wants every edge in order(queued), and prints each
+ *          one with the time it happened on UART0
+ *
+ *       The main loop also publishes its pass count on "loop" every pass,
+ *       and once a second each topic's publish rate and the logger's lag
+ *       go out on UART0(the launchpad's USB serial port)
+ *
+ *       The logger is slow on purpose(it prints), bounce the button hard
+ *       and watch its lag go up
+ *
+ * Hardware Notes:
+ * PF2 - blue LED, on while SW1 is held
+ * PF4 - SW1
+ *
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_FMT.h"
+#include "MIL_TOPIC.h"
+
+/************************DEFINES******************************/
+
+#define BLUE_LED_PIN GPIO_PIN_2
+#define SW1_PIN GPIO_PIN_4
+#define LOG_DEPTH 16
+
+/************************TYPES******************************/
+
+typedef struct{
+
+    uint8_t pressed;
+    uint32_t cycles;    //MIL_TIME of the edge
+
+}ButtonEvent;
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void InitGPIO(void);
+void ButtonISR(void);
+void Report(void);
+void Flush(void *pCtx, uint8_t *pData, uint16_t len);
+
+/************************GLOBALS******************************/
+
+MIL_TOPIC button_topic;
+uint8_t BUTTON_SLOTS[MIL_TOPIC_SLOTS_LEN(sizeof(ButtonEvent))];
+
+MIL_TOPIC loop_topic;
+uint8_t LOOP_SLOTS[MIL_TOPIC_SLOTS_LEN(sizeof(uint32_t))];
+
+MIL_TOPIC_Sub led_sub;
+MIL_TOPIC_Sub log_sub;
+uint8_t LOG_QUEUE[MIL_TOPIC_QUEUE_LEN(sizeof(ButtonEvent), LOG_DEPTH)];
+
+uint8_t line[64];
+MIL_FMT_Buf out;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_FMT_BufInit(&out, line, sizeof(line), Flush, 0);
+
+    //topics and subscribers before anything can publish
+    MIL_TOPIC_Init(&button_topic, "button", sizeof(ButtonEvent), BUTTON_SLOTS);
+    MIL_TOPIC_Init(&loop_topic, "loop", sizeof(uint32_t), LOOP_SLOTS);
+    MIL_TOPIC_Subscribe(&button_topic, &led_sub, 0, 0);
+    MIL_TOPIC_Subscribe(&button_topic, &log_sub, LOG_QUEUE, LOG_DEPTH);
+
+    InitGPIO();
+
+    IntMasterEnable();
+
+    uint32_t pass = 0;
+    uint32_t second = MIL_TIME_FromUs(1000000);
+    uint32_t last_report = MIL_TIME_NOW();
+    ButtonEvent event;
+
+    while(1){
+
+        pass++;
+        MIL_TOPIC_PUBLISH(&loop_topic, &pass);
+
+        if(MIL_TOPIC_Poll(&led_sub, &event, sizeof(event))){
+
+            GPIOPinWrite(GPIO_PORTF_BASE, BLUE_LED_PIN, event.pressed ? BLUE_LED_PIN : 0);
+
+        }
+
+        //one event per pass, so a burst of bounces backs up in the queue
+        if(MIL_TOPIC_TAKE(&log_sub, &event)){
+
+            MIL_FMT_AddStr(&out, event.pressed ? "press " : "release ");
+            MIL_FMT_AddU32(&out, MIL_TIME_ToUs(event.cycles));
+            MIL_FMT_AddStr(&out, "us\r\n");
+            MIL_FMT_Flush(&out);
+
+        }
+
+        MIL_TOPIC_Tick(MIL_TIME_NOW(), second);
+
+        if((MIL_TIME_NOW() - last_report) >= second){
+
+            last_report += second;
+            Report();
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void InitGPIO(void){
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOF));
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, BLUE_LED_PIN);
+    GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, SW1_PIN);
+    GPIOPadConfigSet(GPIO_PORTF_BASE, SW1_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+    GPIOIntTypeSet(GPIO_PORTF_BASE, SW1_PIN, GPIO_BOTH_EDGES);
+    GPIOIntRegister(GPIO_PORTF_BASE, ButtonISR);
+    MIL_INT_PrioritySet(INT_GPIOF, MIL_INT_PRI_GPIO);
+    GPIOIntEnable(GPIO_PORTF_BASE, SW1_PIN);
+
+}
+
+void ButtonISR(void){
+
+    ButtonEvent event;
+
+    event.cycles = MIL_TIME_NOW();
+    GPIOIntClear(GPIO_PORTF_BASE, SW1_PIN);
+
+    //SW1 pulls the pin low
+    event.pressed = (GPIOPinRead(GPIO_PORTF_BASE, SW1_PIN) == 0);
+
+    MIL_TOPIC_PUBLISH(&button_topic, &event);
+
+}
+
+void Report(void){
+
+    for(MIL_TOPIC *pTopic = MIL_TOPIC_Next(0); pTopic; pTopic = MIL_TOPIC_Next(pTopic)){
+
+        MIL_TOPIC_Stats stats;
+        MIL_TOPIC_StatsGet(pTopic, &stats);
+
+        MIL_FMT_AddStr(&out, MIL_TOPIC_Name(pTopic));
+        MIL_FMT_AddStr(&out, ": ");
+        MIL_FMT_AddU32(&out, stats.rate);
+        MIL_FMT_AddStr(&out, "/s  ");
+
+    }
+
+    MIL_TOPIC_SubStats lag;
+    MIL_TOPIC_SubStatsGet(&log_sub, &lag);
+
+    MIL_FMT_AddStr(&out, "logger lag ");
+    MIL_FMT_AddU32(&out, lag.lag);
+    MIL_FMT_AddStr(&out, " max ");
+    MIL_FMT_AddU32(&out, lag.lag_max);
+    MIL_FMT_AddStr(&out, " dropped ");
+    MIL_FMT_AddU32(&out, lag.dropped);
+    MIL_FMT_AddStr(&out, "\r\n");
+    MIL_FMT_Flush(&out);
+
+}
+
+void Flush(void *pCtx, uint8_t *pData, uint16_t len){
+
+    (void)pCtx;
+
+    MIL_UART_OutArray(UART0_BASE, pData, (uint8_t)len);
+
+}
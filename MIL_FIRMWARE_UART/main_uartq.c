@@ -0,0 +1,173 @@
+/*
+ * Name: MIL_UART_Priority_Demo
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: This will demonstrate control replies getting through a UART
+ *       that is flooded with log output, using MIL_UARTQ
+ *
+ *       The board logs a numbered line as fast as UART0 will take it, in
+ *       MIL_TXQ_BULK. Type any key in a terminal and the board answers
+ *       straight away in MIL_TXQ_CONTROL, the reply cuts in at the next
+ *       log line instead of after everything that was already queued
+ *
+ *       Once a second a report goes out in MIL_TXQ_NORMAL with each
+ *       class's worst and average queue latency. Press l to toggle a
+ *       2000 B/s rate limit on the logs and watch the numbers change
+ *
+ *       To compare setups without hardware, build and run tools/txq_sim.c
+ *
+ * Hardware Notes:
+ * UART 0 on Port A(USB)
+ * PA0 - UART RX
+ * PA1 - UART TX
+ */
+/* INCLUDES */
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+//MIL includes
+#include "MIL_CLK.h"
+#include "MIL_INT.h"
+#include "MIL_TIME.h"
+#include "MIL_UART.h"
+#include "MIL_UARTQ.h"
+
+/************************DEFINES******************************/
+
+#define REPORT_US 1000000
+#define LOG_LIMIT_BPS 2000
+
+/************************FUNCTION PROTOTYPES******************************/
+
+void RxISR(void);
+void Report(void);
+uint8_t FormatInt(uint8_t *pOut, uint32_t value);
+
+/************************GLOBALS******************************/
+
+volatile int16_t key = -1;
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    /*CONFIGURE SYSTEM CLOCK TO INTERNAL 16MHZ*/
+    MIL_ClkSetInt_16MHz();
+    MIL_TIME_Init();
+    MIL_INT_Init();
+
+    MIL_InitUART(UART0_BASE, MIL_DEFAULT_BAUD_115K);
+    MIL_UARTQ_Init(UART0_BASE, MIL_RX_INT_EN | UART_INT_RT, RxISR);
+
+    IntMasterEnable();
+
+    uint8_t line[40];
+    uint32_t count = 0;
+    bool limited = false;
+    uint32_t report_cycles = MIL_TIME_FromUs(REPORT_US);
+    uint32_t last_report = MIL_TIME_NOW();
+
+    while(1){
+
+        MIL_UARTQ_Poll();
+
+        //a key press gets an answer in the control class
+        if(key >= 0){
+
+            uint8_t reply[] = "\r\n>> got x <<\r\n";
+            reply[9] = (uint8_t)key;
+
+            if(key == 'l'){
+
+                limited = !limited;
+                MIL_UARTQ_RateSet(UART0_BASE, MIL_TXQ_BULK, limited ? LOG_LIMIT_BPS : 0, 512);
+
+            }
+
+            key = -1;
+            MIL_UARTQ_Send(UART0_BASE, MIL_TXQ_CONTROL, reply, sizeof(reply) - 1);
+
+        }
+
+        //log as fast as there is room
+        uint8_t n = 0;
+        const char *pText = "log line ";
+        while(*pText){ line[n++] = (uint8_t)*pText++; }
+        n += FormatInt(&line[n], count);
+        line[n++] = '\r';
+        line[n++] = '\n';
+
+        if(MIL_UARTQ_Send(UART0_BASE, MIL_TXQ_BULK, line, n)){ count++; }
+
+        if((MIL_TIME_NOW() - last_report) >= report_cycles){
+
+            last_report += report_cycles;
+            Report();
+
+        }
+
+    }
+
+}
+
+/************************FUNCTIONS******************************/
+
+void RxISR(void){
+
+    UARTIntClear(UART0_BASE, MIL_RX_INT_EN | UART_INT_RT);
+
+    while(UARTCharsAvail(UART0_BASE)){ key = (int16_t)(UARTCharGetNonBlocking(UART0_BASE) & 0xFF); }
+
+}
+
+void Report(void){
+
+    static const char *NAMES[MIL_TXQ_CLASSES] = {"control", "normal", "bulk"};
+
+    uint8_t out[120];
+    uint8_t n = 0;
+
+    for(uint8_t c = 0; c < MIL_TXQ_CLASSES; c++){
+
+        MIL_TXQ_Stats stats;
+        MIL_UARTQ_StatsGet(UART0_BASE, c, &stats);
+        MIL_UARTQ_LatencyReset(UART0_BASE, c);
+
+        const char *pText = NAMES[c];
+        while(*pText){ out[n++] = (uint8_t)*pText++; }
+        out[n++] = ' ';
+        n += FormatInt(&out[n], MIL_TIME_ToUs(stats.lat_max));
+        out[n++] = '/';
+        n += FormatInt(&out[n], MIL_TIME_ToUs(stats.lat_avg));
+        out[n++] = 'u';
+        out[n++] = 's';
+        out[n++] = ' ';
+
+    }
+
+    out[n++] = '\r';
+    out[n++] = '\n';
+
+    MIL_UARTQ_Send(UART0_BASE, MIL_TXQ_NORMAL, out, n);
+
+}
+
+/*
+ * Desc: writes value in decimal, returns how many digits
+ */
+uint8_t FormatInt(uint8_t *pOut, uint32_t value){
+
+    uint8_t digits[10];
+    uint8_t n = 0;
+
+    do{ digits[n++] = '0' + (value % 10); value /= 10; }while(value);
+
+    for(uint8_t i = 0; i < n; i++){ pOut[i] = digits[n - 1 - i]; }
+
+    return n;
+
+}
@@ -0,0 +1,350 @@
+/*
+ * Name: bus_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host simulation of MIL_RS485, runs the real MIL_BUS code on a
+ *       master and several nodes sharing one simulated RS-485 bus
+ *
+ *       The bus is stepped one bit time at a time. A board's driver turns
+ *       on when it starts sending and turns off de_lag after its last
+ *       stop bit(how long its end of transmission ISR takes). If a board
+ *       starts sending while another board is sending or still has its
+ *       driver on, both bytes are damaged(a collision)
+ *
+ *       Address bytes go out with the 9th bit set. With the address
+ *       filter on(the default), a board only sees frames sent to it,
+ *       like the UART's 9 bit address match. Wakeups count the bytes
+ *       each node's CPU had to handle
+ *
+ *       Each board's main loop runs MIL_BUS_Poll at a random interval
+ *       up to loop_us. One node address is polled but missing, so its
+ *       polls always time out
+ *
+ *       With no arguments it sweeps the turnaround time. MIL_BUS raises
+ *       anything under MIL_BUS_GAP_BYTES + 1 byte times, the printed
+ *       turnaround is the one actually used
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o bus_sim bus_sim.c ../MIL_BUS.c ../MIL_CRC.c
+ *
+ * Usage:
+ *      ./bus_sim [turnaround_us] [de_lag_us] [loop_us] [nodes] [baud] [nofilter]
+ *      ./bus_sim 750 600 50 8 115200             the default
+ *      ./bus_sim 750 600 50 8 115200 nofilter    every node sees every byte
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MIL_BUS.h"
+
+//ticks are MIL_TIME cycles at 16MHz
+#define TICKS_PER_US 16
+#define TICKS_PER_S  16000000.0
+
+#define MAX_BOARDS (MIL_BUS_MAX_NODES + 1)
+#define QUEUE_LEN 256
+
+//address of the node that is polled but not there
+#define MISSING_NODE 5
+
+#define SIM_SECONDS 2
+
+/************************SIMULATED BOARDS******************************/
+
+typedef struct{
+
+    MIL_BUS bus;
+    uint8_t address;
+    bool    present;
+
+    //waiting to go out, 9th bit alongside
+    uint8_t  tx[QUEUE_LEN];
+    bool     tx_addr[QUEUE_LEN];
+    uint16_t tx_head, tx_tail;
+
+    //byte on the wire
+    bool     sending;
+    uint8_t  cur;
+    bool     cur_addr;
+    bool     cur_damaged;
+    uint32_t cur_start;
+
+    bool     driver_on;
+    uint32_t driver_off;        //when the EOT ISR turns the driver off
+
+    bool     listening;         //9 bit address matched
+    uint32_t next_loop;         //next main loop pass
+
+    uint32_t wakeups;
+
+    //payload checks
+    uint32_t tx_seq[MAX_BOARDS];
+    uint32_t rx_count[MAX_BOARDS];
+    uint32_t corrupt;
+
+}Board;
+
+static Board BOARDS[MAX_BOARDS];
+static uint8_t num_boards;
+static uint32_t collisions;
+static bool filter;
+
+static void Out(void *pCtx, const uint8_t *pFrame, uint8_t len){
+
+    Board *pB = (Board *)pCtx;
+
+    for(uint8_t i = 0; i < len; i++){
+
+        pB->tx[pB->tx_head % QUEUE_LEN] = pFrame[i];
+        pB->tx_addr[pB->tx_head++ % QUEUE_LEN] = (i == 0);
+
+    }
+
+}
+
+//payload: sender address, then a per destination counter, then filler
+static uint8_t Fill(void *pCtx, uint8_t to, uint8_t *pPayload){
+
+    Board *pB = (Board *)pCtx;
+    uint32_t seq = pB->tx_seq[to % MAX_BOARDS]++;
+    uint8_t len = 4 + (uint8_t)(seq % 12);
+
+    pPayload[0] = pB->address;
+    for(uint8_t i = 1; i < len; i++){ pPayload[i] = (uint8_t)(seq + i); }
+
+    return len;
+
+}
+
+static void Deliver(void *pCtx, uint8_t from, const uint8_t *pData, uint8_t len){
+
+    Board *pB = (Board *)pCtx;
+
+    //counters can skip after a timeout, so only the pattern is checked
+    if(len < 4 || pData[0] != from){ pB->corrupt++; return; }
+    for(uint8_t i = 2; i < len; i++){
+
+        if(pData[i] != (uint8_t)(pData[1] + i - 1)){ pB->corrupt++; return; }
+
+    }
+
+    pB->rx_count[from % MAX_BOARDS]++;
+
+}
+
+static void Receive(Board *pR, uint8_t byte, bool addr, bool damaged, uint32_t now){
+
+    if(!pR->present){ return; }
+
+    if(damaged){ byte ^= (uint8_t)(1u << (rand() % 8)); }
+
+    if(filter){
+
+        //the UART drops everything after an address that isn't ours
+        if(addr){ pR->listening = (byte == pR->address); }
+        if(!pR->listening){ return; }
+
+    }
+
+    pR->wakeups++;
+    MIL_BUS_Rx(&pR->bus, byte, now);
+
+}
+
+/*
+ * Desc: runs one bus for SIM_SECONDS, prints one line of results
+ */
+static void Run(double turnaround_us, double de_lag_us, double loop_us, uint8_t nodes, double baud){
+
+    memset(BOARDS, 0, sizeof(BOARDS));
+    collisions = 0;
+    srand(1);
+
+    uint32_t byte_ticks = (uint32_t)(TICKS_PER_S * 10 / baud);
+    uint32_t bit_ticks = byte_ticks / 10;
+    uint32_t de_lag = (uint32_t)(de_lag_us * TICKS_PER_US);
+    uint32_t loop = (uint32_t)(loop_us * TICKS_PER_US) + 1;
+    uint32_t turnaround = (uint32_t)(turnaround_us * TICKS_PER_US);
+
+    //what MIL_BUS_TimingSet will raise it to
+    if(turnaround < (MIL_BUS_GAP_BYTES + 1) * byte_ticks){ turnaround = (MIL_BUS_GAP_BYTES + 1) * byte_ticks; }
+
+    uint8_t poll_list[MIL_BUS_MAX_NODES];
+
+    num_boards = nodes + 1;
+
+    for(uint8_t i = 0; i < num_boards; i++){
+
+        Board *pB = &BOARDS[i];
+
+        pB->address = i;
+        pB->present = (i != MISSING_NODE);
+
+        MIL_BUS_Init(&pB->bus, i, byte_ticks, Out, Fill, Deliver, pB);
+        //reply timeout covers the node's and the master's main loop delays
+        MIL_BUS_TimingSet(&pB->bus, turnaround, turnaround + 2 * loop + 4 * byte_ticks);
+
+        if(i){ poll_list[i - 1] = i; }
+
+    }
+
+    MIL_BUS_MasterStart(&BOARDS[0].bus, poll_list, nodes, 0);
+
+    uint32_t end = (uint32_t)(SIM_SECONDS * TICKS_PER_S);
+    uint32_t busy = 0;
+
+    for(uint32_t now = 0; now < end; now += bit_ticks){
+
+        bool any = false;
+
+        //bytes finishing
+        for(uint8_t i = 0; i < num_boards; i++){
+
+            Board *pB = &BOARDS[i];
+
+            if(!pB->sending || now - pB->cur_start < byte_ticks){ continue; }
+
+            pB->sending = false;
+            if(pB->tx_tail == pB->tx_head){ pB->driver_off = now + de_lag; }
+
+            for(uint8_t r = 0; r < num_boards; r++){
+
+                if(r != i){ Receive(&BOARDS[r], pB->cur, pB->cur_addr, pB->cur_damaged, now); }
+
+            }
+
+        }
+
+        //bytes starting
+        for(uint8_t i = 0; i < num_boards; i++){
+
+            Board *pB = &BOARDS[i];
+
+            if(pB->sending || pB->tx_tail == pB->tx_head){ continue; }
+
+            pB->cur = pB->tx[pB->tx_tail % QUEUE_LEN];
+            pB->cur_addr = pB->tx_addr[pB->tx_tail++ % QUEUE_LEN];
+            pB->cur_damaged = false;
+            pB->cur_start = now;
+            pB->sending = true;
+
+            for(uint8_t o = 0; o < num_boards; o++){
+
+                Board *pO = &BOARDS[o];
+
+                if(o == i || !pO->driver_on){ continue; }
+
+                //two drivers on at once, both lose
+                pB->cur_damaged = true;
+                if(pO->sending){ pO->cur_damaged = true; }
+                collisions++;
+
+            }
+
+            pB->driver_on = true;
+
+        }
+
+        for(uint8_t i = 0; i < num_boards; i++){
+
+            Board *pB = &BOARDS[i];
+
+            if(pB->driver_on && !pB->sending && pB->tx_tail == pB->tx_head &&
+               (int32_t)(now - pB->driver_off) >= 0){ pB->driver_on = false; }
+
+            if(pB->sending){ any = true; }
+
+            if(pB->present && (int32_t)(now - pB->next_loop) >= 0){
+
+                MIL_BUS_Poll(&pB->bus, now);
+                pB->next_loop = now + (uint32_t)rand() % loop;
+
+            }
+
+        }
+
+        if(any){ busy++; }
+
+    }
+
+    MIL_BUS_Stats st;
+    MIL_BUS_StatsGet(&BOARDS[0].bus, &st);
+
+    uint32_t replies = 0, corrupt = BOARDS[0].corrupt, wakeups = 0, node_bad = 0;
+
+    for(uint8_t i = 1; i < num_boards; i++){
+
+        replies += BOARDS[0].rx_count[i];
+        corrupt += BOARDS[i].corrupt;
+
+        if(!BOARDS[i].present){ continue; }
+
+        MIL_BUS_Stats ns;
+        MIL_BUS_StatsGet(&BOARDS[i].bus, &ns);
+        node_bad += ns.bad_frames;
+        wakeups += BOARDS[i].wakeups;
+
+    }
+
+    //every missed reply from a present node is a failure
+    uint32_t expected_timeouts = st.node_timeouts[MISSING_NODE - 1];
+    bool ok = corrupt == 0 && st.timeouts == expected_timeouts;
+
+    printf("%7.0fus %6.0fus  %7.0f polls/s  busy %4.1f%%  timeouts %5lu(missing node %5lu)  "
+           "collisions %5lu  bad %4lu  stray %4lu  node wakeups %6.0f B/s  %s\n",
+           turnaround / (double)TICKS_PER_US, de_lag_us, st.polls / (double)SIM_SECONDS,
+           100.0 * busy * bit_ticks / end,
+           (unsigned long)st.timeouts, (unsigned long)expected_timeouts,
+           (unsigned long)collisions, (unsigned long)(st.bad_frames + node_bad),
+           (unsigned long)st.stray_frames,
+           wakeups / (double)SIM_SECONDS / (nodes - 1),
+           ok ? "ok" : "FAILED");
+
+    (void)replies;
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    double de_lag_us = (argc > 2) ? atof(argv[2]) : 600.0;
+    double loop_us   = (argc > 3) ? atof(argv[3]) : 50.0;
+    int nodes        = (argc > 4) ? atoi(argv[4]) : 8;
+    double baud      = (argc > 5) ? atof(argv[5]) : 115200.0;
+
+    filter = !((argc > 6) && strcmp(argv[6], "nofilter") == 0);
+
+    if(nodes < MISSING_NODE || nodes > MIL_BUS_MAX_NODES){
+
+        printf("nodes must be %d to %d\n", MISSING_NODE, MIL_BUS_MAX_NODES);
+        return 1;
+
+    }
+
+    printf("%d nodes(node %d missing), %.0f baud, main loop up to %.0fus, address filter %s\n",
+           nodes, MISSING_NODE, baud, loop_us, filter ? "on" : "off");
+    printf("turnaround  de_lag\n");
+
+    if(argc > 1){
+
+        Run(atof(argv[1]), de_lag_us, loop_us, (uint8_t)nodes, baud);
+
+    }
+    else{
+
+        const double sweep[] = {550, 750, 1000, 2000};
+
+        for(unsigned i = 0; i < sizeof(sweep) / sizeof(sweep[0]); i++){
+
+            Run(sweep[i], de_lag_us, loop_us, (uint8_t)nodes, baud);
+
+        }
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,218 @@
+/*
+ * Name: fmt_bench
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host check and benchmark of MIL_FMT against snprintf
+ *
+ *       Check: formats a few million numbers both ways and compares.
+ *       Integers and hex must match exactly. Fixed point and floats must
+ *       match to within one in the last digit, the exact-match share is
+ *       printed too(the rest are values sitting on a rounding tie, where
+ *       MIL_FMT rounds up and printf rounds to even)
+ *
+ *       Bench: nanoseconds per number on this machine. The on-board
+ *       cycle counts against UARTprintf's formatter are in main_fmt.c
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o fmt_bench fmt_bench.c ../MIL_FMT.c
+ *
+ * Usage:
+ *      ./fmt_bench
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MIL_FMT.h"
+
+#define CHECKS 2000000
+#define BENCH  5000000
+
+static uint32_t seed = 1;
+
+//xorshift, the same numbers every run
+static uint32_t Rand(void){
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+
+}
+
+//random value with a random number of digits, so short numbers get tested too
+static uint32_t RandSized(void){
+
+    return Rand() >> (Rand() % 32);
+
+}
+
+static double Now(void){
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+/************************CHECK******************************/
+
+static unsigned long fails;
+
+static void Same(const char *pWhat, const uint8_t *pMine, uint8_t len, const char *pRef){
+
+    if(len != strlen(pRef) || memcmp(pMine, pRef, len) != 0){
+
+        if(fails++ < 10){ printf("  %s: got %.*s want %s\n", pWhat, len, (const char *)pMine, pRef); }
+
+    }
+
+}
+
+//true if the two agree exactly, counts a fail if they differ by more than a last digit
+static int Close(const char *pWhat, const uint8_t *pMine, uint8_t len, const char *pRef, uint8_t decimals){
+
+    char mine[MIL_FMT_MAX_LEN + 1];
+    memcpy(mine, pMine, len);
+    mine[len] = 0;
+
+    if(strcmp(mine, pRef) == 0){ return 1; }
+
+    double unit = 1.0;
+    for(uint8_t i = 0; i < decimals; i++){ unit /= 10.0; }
+
+    double ref = atof(pRef);
+    double diff = atof(mine) - ref;
+    if(diff < 0){ diff = -diff; }
+    if(ref < 0){ ref = -ref; }
+
+    //atof itself is only good to about 16 digits
+    if(diff > unit * 1.001 + ref * 1e-15){
+
+        if(fails++ < 10){ printf("  %s: got %s want %s\n", pWhat, mine, pRef); }
+
+    }
+
+    return 0;
+
+}
+
+static void Check(void){
+
+    uint8_t out[MIL_FMT_MAX_LEN];
+    char ref[64];
+    unsigned long fixed_exact = 0;
+    unsigned long float_exact = 0;
+
+    const uint32_t edges[] = {0, 1, 9, 10, 99, 100, 999999999, 1000000000, 4294967295u, 2147483647u, 2147483648u};
+
+    for(unsigned i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+
+        snprintf(ref, sizeof(ref), "%lu", (unsigned long)edges[i]);
+        Same("u32", out, MIL_FMT_U32(out, edges[i]), ref);
+        snprintf(ref, sizeof(ref), "%ld", (long)(int32_t)edges[i]);
+        Same("i32", out, MIL_FMT_I32(out, (int32_t)edges[i]), ref);
+
+    }
+
+    for(uint32_t i = 0; i < CHECKS; i++){
+
+        uint32_t v = RandSized();
+
+        snprintf(ref, sizeof(ref), "%lu", (unsigned long)v);
+        Same("u32", out, MIL_FMT_U32(out, v), ref);
+
+        snprintf(ref, sizeof(ref), "%ld", (long)(int32_t)Rand());
+        Same("i32", out, MIL_FMT_I32(out, (int32_t)atol(ref)), ref);
+
+        uint8_t digits = Rand() % 9;
+        snprintf(ref, sizeof(ref), "%0*lX", digits, (unsigned long)v);
+        Same("hex", out, MIL_FMT_Hex(out, v, digits), ref);
+
+        int32_t q = (int32_t)RandSized() * ((Rand() & 1) ? -1 : 1);
+        uint8_t frac_bits = Rand() % 32;
+        uint8_t decimals = Rand() % (MIL_FMT_MAX_DECIMALS + 1);
+        snprintf(ref, sizeof(ref), "%.*f", decimals, (double)q / (double)(1ull << frac_bits));
+        fixed_exact += Close("fixed", out, MIL_FMT_Fixed(out, q, frac_bits, decimals), ref, decimals);
+
+        //floats only carry about 7 digits, keep the decimals where they mean something
+        float f = (float)q / (float)(1ull << frac_bits);
+        decimals = Rand() % 4;
+        if(f > -100000.0f && f < 100000.0f){
+
+            snprintf(ref, sizeof(ref), "%.*f", decimals, (double)f);
+            float_exact += Close("float", out, MIL_FMT_Float(out, f, decimals), ref, decimals);
+
+        }
+        else{ float_exact++; }
+
+    }
+
+    printf("check: %lu fails in %d numbers of each kind, fixed exact %.3f%%, float exact %.3f%%\n",
+           fails, CHECKS, 100.0 * fixed_exact / CHECKS, 100.0 * float_exact / CHECKS);
+
+}
+
+/************************BENCH******************************/
+
+static volatile uint32_t sink;
+
+static void Bench(void){
+
+    static uint32_t values[1024];
+    static float floats[1024];
+    uint8_t out[MIL_FMT_MAX_LEN];
+    char ref[64];
+
+    for(int i = 0; i < 1024; i++){
+
+        values[i] = RandSized();
+        floats[i] = (float)(int32_t)RandSized() / 1024.0f;
+
+    }
+
+    double t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += MIL_FMT_U32(out, values[i & 1023]); }
+    double mil_u32 = (Now() - t) * 1e9 / BENCH;
+
+    t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += snprintf(ref, sizeof(ref), "%lu", (unsigned long)values[i & 1023]); }
+    double ref_u32 = (Now() - t) * 1e9 / BENCH;
+
+    t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += MIL_FMT_Hex(out, values[i & 1023], 8); }
+    double mil_hex = (Now() - t) * 1e9 / BENCH;
+
+    t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += snprintf(ref, sizeof(ref), "%08lX", (unsigned long)values[i & 1023]); }
+    double ref_hex = (Now() - t) * 1e9 / BENCH;
+
+    t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += MIL_FMT_Float(out, floats[i & 1023], 3); }
+    double mil_float = (Now() - t) * 1e9 / BENCH;
+
+    t = Now();
+    for(int i = 0; i < BENCH; i++){ sink += snprintf(ref, sizeof(ref), "%.3f", (double)floats[i & 1023]); }
+    double ref_float = (Now() - t) * 1e9 / BENCH;
+
+    printf("bench(ns per number)   MIL_FMT   snprintf\n");
+    printf("  decimal u32          %7.1f   %8.1f\n", mil_u32, ref_u32);
+    printf("  hex 8 digits         %7.1f   %8.1f\n", mil_hex, ref_hex);
+    printf("  float 3 decimals     %7.1f   %8.1f\n", mil_float, ref_float);
+
+}
+
+/************************MAIN******************************/
+int main(void)
+{
+
+    Check();
+    Bench();
+
+    return fails != 0;
+
+}
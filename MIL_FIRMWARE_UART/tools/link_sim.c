@@ -0,0 +1,228 @@
+/*
+ * Name: link_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host simulation of MIL_LINK, runs the real MIL_ARQ code on
+ *       both ends of a simulated lossy UART and measures goodput
+ *       (payload bytes delivered per second, in order and intact)
+ *
+ *       The wire sends one byte per byte time in each direction. Each
+ *       byte is dropped or has a bit flipped with the given probability,
+ *       then arrives after the given latency(the tether)
+ *
+ *       With no loss arguments it sweeps a range of loss rates
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o link_sim link_sim.c ../MIL_ARQ.c ../MIL_CRC.c
+ *
+ *      add -DMIL_ARQ_WINDOW=2 (or 4, 16) to compare window sizes
+ *
+ * Usage:
+ *      ./link_sim [byte_loss_pct] [latency_ms] [baud] [messages] [both]
+ *      ./link_sim 0.1 5 115200 2000       0.1% of bytes lost, 5ms each way
+ *      ./link_sim 0.1 5 115200 2000 both  traffic both ways(acks piggyback)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MIL_ARQ.h"
+
+//ticks are MIL_TIME cycles at 16MHz
+#define TICKS_PER_MS 16000
+#define TICKS_PER_S  16000000.0
+
+#define QUEUE_LEN 65536
+
+/************************SIMULATED WIRE******************************/
+
+typedef struct{
+
+    uint8_t  tx[QUEUE_LEN];         //waiting to go on the wire
+    uint32_t tx_head, tx_tail;
+
+    uint8_t  fly[QUEUE_LEN];        //on the wire
+    uint32_t fly_time[QUEUE_LEN];   //when it arrives
+    uint32_t fly_head, fly_tail;
+
+}Wire;
+
+typedef struct{
+
+    MIL_ARQ arq;
+    Wire *pOut;         //wire this end sends on
+
+    uint32_t next_tx;   //next message number to send
+    uint32_t next_rx;   //next message number expected
+    uint32_t corrupt;   //messages delivered wrong(must stay 0)
+
+}End;
+
+static double loss;
+
+static void Out(void *pCtx, const uint8_t *pFrame, uint16_t len){
+
+    Wire *pW = ((End *)pCtx)->pOut;
+
+    for(uint16_t i = 0; i < len; i++){ pW->tx[pW->tx_head++ % QUEUE_LEN] = pFrame[i]; }
+
+}
+
+//message n is n repeated, so order and content are both checked
+static void Fill(uint8_t *pMsg, uint32_t n){
+
+    for(uint8_t i = 0; i < MIL_ARQ_MAX_PAYLOAD; i++){ pMsg[i] = (uint8_t)(n + i); }
+
+}
+
+static void Deliver(void *pCtx, const uint8_t *pData, uint8_t len){
+
+    End *pE = (End *)pCtx;
+    uint8_t expect[MIL_ARQ_MAX_PAYLOAD];
+
+    Fill(expect, pE->next_rx++);
+
+    if(len != MIL_ARQ_MAX_PAYLOAD || memcmp(expect, pData, len) != 0){ pE->corrupt++; }
+
+}
+
+//moves one byte time of traffic along a wire
+static void WireStep(Wire *pW, End *pTo, uint32_t now, uint32_t latency){
+
+    if(pW->tx_tail != pW->tx_head){
+
+        uint8_t b = pW->tx[pW->tx_tail++ % QUEUE_LEN];
+        double r = (double)rand() / RAND_MAX;
+
+        if(r < loss / 2){ b = 0xFF; }                   //dropped, never arrives
+        else{
+
+            if(r < loss){ b ^= (uint8_t)(1u << (rand() % 8)); }
+
+            pW->fly[pW->fly_head % QUEUE_LEN] = b;
+            pW->fly_time[pW->fly_head++ % QUEUE_LEN] = now + latency;
+
+        }
+
+    }
+
+    while(pW->fly_tail != pW->fly_head && (int32_t)(now - pW->fly_time[pW->fly_tail % QUEUE_LEN]) >= 0){
+
+        uint8_t b = pW->fly[pW->fly_tail++ % QUEUE_LEN];
+        MIL_ARQ_Rx(&pTo->arq, &b, 1, now);
+
+    }
+
+}
+
+static void AppSend(End *pE, uint32_t messages, uint32_t now){
+
+    uint8_t msg[MIL_ARQ_MAX_PAYLOAD];
+
+    while(pE->next_tx < messages && MIL_ARQ_CanSend(&pE->arq)){
+
+        Fill(msg, pE->next_tx++);
+        MIL_ARQ_Send(&pE->arq, msg, MIL_ARQ_MAX_PAYLOAD, now);
+
+    }
+
+}
+
+/*
+ * Desc: runs one transfer, prints one line of results
+ */
+static void Run(double loss_pct, double latency_ms, double baud, uint32_t messages, int both){
+
+    static Wire ab, ba;
+    static End a, b;
+
+    memset(&ab, 0, sizeof(ab));
+    memset(&ba, 0, sizeof(ba));
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+
+    loss = loss_pct / 100.0;
+    srand(1);
+
+    a.pOut = &ab;
+    b.pOut = &ba;
+
+    uint32_t byte_ticks = (uint32_t)(TICKS_PER_S * 10 / baud + 0.5);
+
+    MIL_ARQ_Init(&a.arq, TICKS_PER_MS, byte_ticks, Out, Deliver, &a);
+    MIL_ARQ_Init(&b.arq, TICKS_PER_MS, byte_ticks, Out, Deliver, &b);
+
+    uint32_t latency = (uint32_t)(latency_ms * TICKS_PER_MS);
+    uint32_t now = 0;
+    uint32_t limit = (uint32_t)(250 * TICKS_PER_S);
+
+    while((b.next_rx < messages || (both && a.next_rx < messages)) && now < limit){
+
+        AppSend(&a, messages, now);
+        if(both){ AppSend(&b, messages, now); }
+
+        WireStep(&ab, &b, now, latency);
+        WireStep(&ba, &a, now, latency);
+
+        MIL_ARQ_Poll(&a.arq, now);
+        MIL_ARQ_Poll(&b.arq, now);
+
+        now += byte_ticks;
+
+    }
+
+    MIL_ARQ_Stats st;
+    MIL_ARQ_StatsGet(&a.arq, &st);
+
+    double secs = now / TICKS_PER_S;
+    //bytes per second the simulated wire really carries, byte_ticks is rounded
+    double line = TICKS_PER_S / byte_ticks;
+    double goodput = (double)b.next_rx * MIL_ARQ_MAX_PAYLOAD / secs;
+
+    //best possible: payload share of each frame on the wire
+    double ceiling = (double)MIL_ARQ_MAX_PAYLOAD /
+                     (MIL_ARQ_MAX_PAYLOAD + MIL_ARQ_HEADER_LEN + MIL_ARQ_CRC_LEN + 2);
+
+    printf("%6.2f%%  %6.1fms  %8.0f B/s  %5.1f%% of line(max %4.1f%%)  retx %5lu  bad %5lu  srtt %5.1fms  rto %5.1fms  %s\n",
+           loss_pct, latency_ms, goodput, 100.0 * goodput / line, 100.0 * ceiling,
+           (unsigned long)st.retransmits, (unsigned long)st.bad_frames,
+           st.srtt / (double)TICKS_PER_MS, st.rto / (double)TICKS_PER_MS,
+           (b.next_rx < messages || a.corrupt || b.corrupt) ? "FAILED" : "ok");
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    double latency_ms = (argc > 2) ? atof(argv[2]) : 5.0;
+    double baud       = (argc > 3) ? atof(argv[3]) : 115200.0;
+    uint32_t messages = (argc > 4) ? (uint32_t)atoi(argv[4]) : 2000;
+    int both          = (argc > 5) && strcmp(argv[5], "both") == 0;
+
+    printf("window %d, %d byte messages, %.0f baud, %lu messages%s\n",
+           MIL_ARQ_WINDOW, MIL_ARQ_MAX_PAYLOAD, baud, (unsigned long)messages,
+           both ? ", both ways" : "");
+    printf("  loss   latency   goodput\n");
+
+    if(argc > 1){
+
+        Run(atof(argv[1]), latency_ms, baud, messages, both);
+
+    }
+    else{
+
+        const double sweep[] = {0.0, 0.01, 0.05, 0.1, 0.2, 0.5, 1.0};
+
+        for(unsigned i = 0; i < sizeof(sweep) / sizeof(sweep[0]); i++){
+
+            Run(sweep[i], latency_ms, baud, messages, both);
+
+        }
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+Name: mil_flash
+Author: Marquez Jones
+Date created: 10/18/2026
+Desc: Host side flasher for the MIL_BOOT serial bootloader
+
+      Reset the board(or power it up) right after starting this tool,
+      the bootloader only listens for a short time after reset
+
+      Usage:
+          python mil_flash.py COM5 my_app.bin           delta update(only changed pages)
+          python mil_flash.py COM5 my_app.bin --full    send every page
+          python mil_flash.py --estimate my_app.bin [--old old_app.bin]
+                                                        no board, just model the update time
+
+      my_app.bin is the raw binary of an app linked at 0x4000
+      (in CCS: Project Properties > Build > ARM Hex Utility, output format binary)
+
+      Needs pyserial(pip install pyserial)
+
+Protocol: see MIL_BOOT.h, the constants below must match it
+"""
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+SOF = 0xA5
+ACK = 0x79
+NAK = 0x1F
+
+CMD_PING = 0x01
+CMD_BAUD = 0x02
+CMD_INFO = 0x03
+CMD_CRC = 0x04
+CMD_STREAM = 0x05
+CMD_RUN = 0x06
+CMD_WRITE = 0x10
+CMD_END = 0x11
+
+CMD_LEN = 8
+REPLY_LEN = 4
+MAX_CRC_PAGES = 64
+
+BOOT_BAUD = 115200
+FAST_BAUD = 1000000
+
+STATUS = {0: "ok", 1: "bad crc", 2: "bad address", 3: "flash error", 4: "verify failed", 5: "bad command",
+          6: "bad argument", 7: "stream timeout"}
+
+# flash timing model used by --estimate(TM4C123 datasheet worst case-ish numbers)
+ERASE_MS = 12.0          # one 1KB page
+PROGRAM_MS = 4.0         # one 512 byte chunk through the write buffer
+HOST_TURNAROUND_MS = 1.0 # USB serial adapter latency per reply
+
+
+def crc32(data):
+    return zlib.crc32(data) & 0xFFFFFFFF
+
+
+def pad(image, size):
+    # erased flash reads as 0xFF so padding with it keeps page CRCs comparable
+    return image + b"\xFF" * ((-len(image)) % size)
+
+
+class Bootloader:
+
+    def __init__(self, port):
+        import serial
+        self.ser = serial.Serial(port, BOOT_BAUD, timeout=0.5)
+
+    def send_cmd(self, cmd, arg0=0, arg1=0):
+        self.ser.write(struct.pack("<BBHI", SOF, cmd, arg0, arg1))
+
+    def reply(self):
+        data = self.ser.read(REPLY_LEN)
+        if len(data) != REPLY_LEN:
+            return None
+        return struct.unpack("<BBH", data)
+
+    def command(self, cmd, arg0=0, arg1=0, extra=0):
+        self.send_cmd(cmd, arg0, arg1)
+        rep = self.reply()
+        if rep is None or rep[0] != ACK:
+            raise RuntimeError("command 0x%02X failed: %s" % (cmd, rep))
+        return self.ser.read(extra)
+
+    def connect(self, tries=50):
+        self.ser.timeout = 0.05
+        for _ in range(tries):
+            self.send_cmd(CMD_PING)
+            rep = self.reply()
+            if rep and rep[0] == ACK:
+                self.ser.timeout = 0.5
+                self.ser.reset_input_buffer()
+                return
+        raise RuntimeError("no bootloader found, reset the board and try again")
+
+    def set_baud(self, baud):
+        self.command(CMD_BAUD, 0, baud)
+        time.sleep(0.01)
+        self.ser.baudrate = baud
+        self.connect(tries=10)
+
+    def info(self):
+        return struct.unpack("<IIII", self.command(CMD_INFO, extra=16))
+
+    def page_crcs(self, first, count):
+        crcs = []
+        while count:
+            n = min(count, MAX_CRC_PAGES)
+            data = self.command(CMD_CRC, n, first, extra=4 * n)
+            crcs += list(struct.unpack("<%dI" % n, data))
+            first += n
+            count -= n
+        return crcs
+
+    def resync(self):
+        # a frame lost bytes, dribble zeros until the board's DMA fills up and it NAKs
+        old = self.ser.timeout
+        self.ser.timeout = 0.002
+        for _ in range(4096):
+            self.ser.write(b"\x00")
+            rep = self.reply()
+            if rep:
+                break
+        self.ser.timeout = old
+        self.ser.reset_input_buffer()
+
+    def frame(self, cmd, chunk, crc, data):
+        frame = struct.pack("<BBHI", SOF, cmd, chunk, crc) + data
+        for _ in range(5):
+            self.ser.write(frame)
+            rep = self.reply()
+            if rep is None:
+                self.resync()
+                continue
+            if rep[0] == ACK or cmd == CMD_END:
+                return rep
+        raise RuntimeError("chunk %d failed after retries" % chunk)
+
+
+def changed_pages(image, old_crcs, page_size):
+    pages = []
+    for p in range(len(image) // page_size):
+        page = image[p * page_size:(p + 1) * page_size]
+        if old_crcs is None or crc32(page) != old_crcs[p]:
+            pages.append(p)
+    return pages
+
+
+def flash(args):
+    raw = open(args.image, "rb").read()
+
+    bl = Bootloader(args.port)
+    print("waiting for bootloader...")
+    bl.connect()
+    bl.set_baud(args.baud)
+
+    app_base, app_max, page_size, chunk_size = bl.info()
+    if len(raw) > app_max:
+        raise RuntimeError("image is %d bytes, only %d fit" % (len(raw), app_max))
+
+    image = pad(raw, page_size)
+    num_pages = len(image) // page_size
+    old = None if args.full else bl.page_crcs(0, num_pages)
+    pages = changed_pages(image, old, page_size)
+    print("%d of %d pages changed" % (len(pages), num_pages))
+
+    start = time.time()
+    bl.command(CMD_STREAM)
+
+    halves = page_size // chunk_size
+    for p in pages:
+        for h in range(halves):
+            chunk = p * halves + h
+            data = image[chunk * chunk_size:(chunk + 1) * chunk_size]
+            rep = bl.frame(CMD_WRITE, chunk, crc32(data), data)
+            if rep[1] != 0:
+                print("board reported: %s" % STATUS.get(rep[1], rep[1]))
+
+    end_data = struct.pack("<I", len(raw)) + b"\x00" * (chunk_size - 4)
+    rep = bl.frame(CMD_END, 0, crc32(raw), end_data)
+    elapsed = time.time() - start
+
+    if rep[0] != ACK:
+        raise RuntimeError("update failed: %s" % STATUS.get(rep[1], rep[1]))
+
+    sent = len(pages) * page_size
+    print("wrote %d bytes in %.2fs (%.1f KB/s)" % (sent, elapsed, sent / 1024.0 / max(elapsed, 1e-6)))
+
+    bl.command(CMD_RUN)
+    print("running application")
+
+
+def estimate(args):
+    """
+    Models the update with no board attached
+
+    Each frame costs its wire time plus the reply turnaround. With
+    pipelining the flash work for a chunk overlaps the wire time of
+    the next one, so a chunk only costs extra when flash is slower
+    """
+    page_size, chunk_size = 1024, 512
+    image = pad(open(args.image, "rb").read(), page_size)
+    old_crcs = None
+    if args.old:
+        old = pad(open(args.old, "rb").read(), page_size)
+        old += b"\xFF" * max(0, len(image) - len(old))
+        old_crcs = [crc32(old[p * page_size:(p + 1) * page_size]) for p in range(len(image) // page_size)]
+
+    wire_ms = (CMD_LEN + chunk_size) * 10 * 1000.0 / args.baud + HOST_TURNAROUND_MS
+
+    def model(pages, pipelined):
+        total = 0.0
+        for _ in pages:
+            for h in range(page_size // chunk_size):
+                flash_ms = PROGRAM_MS + (ERASE_MS if h == 0 else 0.0)
+                total += max(wire_ms, flash_ms) if pipelined else wire_ms + flash_ms
+        return total / 1000.0
+
+    full = changed_pages(image, None, page_size)
+    print("full update : %d pages  %.2fs pipelined  %.2fs serial" % (len(full), model(full, True), model(full, False)))
+    if old_crcs is not None:
+        delta = changed_pages(image, old_crcs, page_size)
+        print("delta update: %d pages  %.2fs pipelined  %.2fs serial" % (len(delta), model(delta, True), model(delta, False)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="MIL_BOOT serial flasher")
+    parser.add_argument("port", nargs="?", help="serial port(COM5, /dev/ttyACM0...)")
+    parser.add_argument("image", help="application .bin linked at 0x4000")
+    parser.add_argument("--baud", type=int, default=FAST_BAUD, help="update baud rate")
+    parser.add_argument("--full", action="store_true", help="send every page instead of only changed ones")
+    parser.add_argument("--estimate", action="store_true", help="model the update time, no board needed")
+    parser.add_argument("--old", help="with --estimate, the image currently on the board")
+    args = parser.parse_args()
+
+    try:
+        if args.estimate:
+            estimate(args)
+        else:
+            if not args.port:
+                parser.error("port is required unless using --estimate")
+            flash(args)
+    except RuntimeError as err:
+        print("error: %s" % err)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
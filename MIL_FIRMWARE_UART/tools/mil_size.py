@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+Name: mil_size
+Author: Marquez Jones
+Date created: 10/18/2026
+Desc: Flash and RAM used by each module of a build, and a check that
+      nothing grew since the last saved baseline
+
+      Reads either:
+          the linker map CCS writes(Debug/<project>.map), from its
+          MODULE SUMMARY table
+          object files(.o/.obj/.a), through a GNU size tool
+
+      Flash is code + read only data, RAM is read/write data(.data and
+      .bss). Initialized RAM also costs its starting values in flash,
+      the TI linker reports those once under "Linker Generated"
+
+      Usage:
+          python mil_size.py Debug/my_project.map                   print the table
+          python mil_size.py Debug/my_project.map --save sizes.json remember these sizes
+          python mil_size.py Debug/my_project.map --check sizes.json
+                                                fail if a module grew more than --slack bytes
+          python mil_size.py build/*.o --size-tool arm-none-eabi-size
+
+      As a CCS build step(Project Properties > Build > Steps > Post-build):
+          python ${PROJECT_LOC}/tools/mil_size.py ${ProjName}.map --check ${PROJECT_LOC}/tools/sizes.json
+
+      The post build step runs in the Debug folder, so the map is just
+      ${ProjName}.map there. A failed check fails the build, run it once
+      with --save after a change that is meant to grow. The first build has
+      no baseline yet, --check warns and saves one to the same file then
+"""
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+NUM = re.compile(r"^\s+(.+?)\s+(\d+)\s+(\d+)\s+(\d+)\s*$")
+
+
+class Module:
+    def __init__(self, name, flash, ram):
+        self.name = name
+        self.flash = flash
+        self.ram = ram
+
+
+def read_map(path):
+    """MODULE SUMMARY of a TI linker map: code, ro data and rw data per object"""
+    modules = []
+    group = ""
+    in_summary = False
+
+    with open(path, errors="replace") as f:
+        for line in f:
+            if line.startswith("MODULE SUMMARY"):
+                in_summary = True
+                continue
+            if not in_summary:
+                continue
+            if "Grand Total" in line:
+                break
+
+            m = NUM.match(line)
+            if not m:
+                # a line with no numbers names the folder or library that follows
+                text = line.strip()
+                if text and not text.startswith(("+", "Module", "------")):
+                    group = os.path.basename(text.rstrip("\\/"))
+                continue
+
+            name = m.group(1).rstrip(":")
+            if name == "Total":
+                group = ""
+                continue
+
+            code, ro, rw = (int(m.group(i)) for i in (2, 3, 4))
+
+            # library members keep their library name so driverlib stays together
+            if group.endswith(".lib") or group.endswith(".a"):
+                name = "%s(%s)" % (group, name)
+
+            modules.append(Module(name, code + ro, rw))
+
+    if not in_summary:
+        raise RuntimeError("%s has no MODULE SUMMARY, is it a TI linker map?" % path)
+
+    return modules
+
+
+def read_objects(paths, size_tool):
+    """Berkeley format from a GNU size tool: text data bss dec hex filename"""
+    try:
+        out = subprocess.run([size_tool, "-B"] + paths, capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError) as err:
+        raise RuntimeError("%s failed: %s" % (size_tool, err))
+
+    modules = []
+    for line in out.splitlines()[1:]:
+        fields = line.split()
+        if len(fields) < 6:
+            continue
+        text, data, bss = (int(x) for x in fields[:3])
+        name = " ".join(fields[5:])
+        # archive members come out as "member.o (ex lib.a)"
+        m = re.match(r"(.+) \(ex (.+)\)", name)
+        name = "%s(%s)" % (os.path.basename(m.group(2)), m.group(1)) if m else os.path.basename(name)
+        modules.append(Module(name, text + data, data + bss))
+
+    return modules
+
+
+def report(modules, baseline):
+    width = max([len(m.name) for m in modules] + [6])
+    print("%-*s  %7s  %7s  %s" % (width, "module", "flash", "ram", "change" if baseline else ""))
+
+    for m in sorted(modules, key=lambda m: m.flash, reverse=True):
+        change = ""
+        if baseline is not None:
+            old = baseline.get(m.name)
+            if old is None:
+                change = "new"
+            elif (m.flash, m.ram) != (old["flash"], old["ram"]):
+                change = "flash %+d  ram %+d" % (m.flash - old["flash"], m.ram - old["ram"])
+        print("%-*s  %7d  %7d  %s" % (width, m.name, m.flash, m.ram, change))
+
+    print("%-*s  %7d  %7d" % (width, "total", sum(m.flash for m in modules), sum(m.ram for m in modules)))
+
+
+def check(modules, baseline, slack):
+    """modules that grew by more than slack bytes of flash or RAM"""
+    grew = []
+    for m in modules:
+        old = baseline.get(m.name, {"flash": 0, "ram": 0})
+        if m.flash - old["flash"] > slack or m.ram - old["ram"] > slack:
+            grew.append(m.name)
+    return grew
+
+
+def main():
+    parser = argparse.ArgumentParser(description="flash and RAM per module")
+    parser.add_argument("inputs", nargs="+", help="a TI linker .map, or object files")
+    parser.add_argument("--size-tool", default="arm-none-eabi-size", help="GNU size for object files")
+    parser.add_argument("--save", help="write the sizes to this baseline file")
+    parser.add_argument("--check", help="compare against this baseline, exit 1 if something grew")
+    parser.add_argument("--slack", type=int, default=0, help="bytes a module may grow before --check fails")
+    parser.add_argument("--mil", action="store_true", help="only MIL_ modules and main files")
+    args = parser.parse_args()
+
+    try:
+        if len(args.inputs) == 1 and args.inputs[0].endswith(".map"):
+            modules = read_map(args.inputs[0])
+        else:
+            modules = read_objects(args.inputs, args.size_tool)
+
+        if args.mil:
+            modules = [m for m in modules if m.name.startswith(("MIL_", "main"))]
+
+        baseline = None
+        if args.check:
+            if os.path.exists(args.check):
+                with open(args.check) as f:
+                    baseline = json.load(f)
+            else:
+                # nothing to compare with, this build becomes the baseline
+                print("warning: %s doesn't exist, saving this build as the baseline" % args.check)
+                args.save = args.save or args.check
+
+        report(modules, baseline)
+
+        if args.save:
+            with open(args.save, "w") as f:
+                json.dump({m.name: {"flash": m.flash, "ram": m.ram} for m in modules}, f, indent=1, sort_keys=True)
+                f.write("\n")
+
+        if baseline is not None:
+            grew = check(modules, baseline, args.slack)
+            if grew:
+                print("error: grew past the baseline: %s" % ", ".join(grew))
+                sys.exit(1)
+
+    except (RuntimeError, OSError) as err:
+        print("error: %s" % err)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
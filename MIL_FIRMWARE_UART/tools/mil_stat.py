@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+"""
+Name: mil_stat
+Author: Marquez Jones
+Date created: 10/18/2026
+Desc: Polls the MIL_STAT driver counters on a running board and shows
+      them as rates
+
+      Every interval the board's counters are read and the change since
+      the last read is divided by the time between them, taken from the
+      board's own MIL_TIME stamps so USB latency doesn't move the numbers
+
+      Usage:
+          python mil_stat.py COM5                    table every second
+          python mil_stat.py COM5 --interval 0.2     faster
+          python mil_stat.py COM5 --plot             live plot(needs matplotlib)
+          python mil_stat.py COM5 --log run.csv      also save every read
+          python mil_stat.py COM5 --once             totals since reset, then exit
+
+      Reading the table:
+          overruns/s   the UART FIFO filled before the ISR got to it, raise
+                       the ISR priority or lower the FIFO trigger
+          dropped/s    the driver's ring filled, the main loop isn't reading
+                       fast enough or the ring is too small
+          fifo_high    most bytes one ISR took from the RX FIFO since reset,
+                       16 means the FIFO was full at least once
+
+      Needs pyserial(pip install pyserial)
+
+Protocol: see MIL_STAT.h, the constants below must match it
+"""
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+SOF = 0xA6
+
+CMD_LIST = 0x01
+CMD_READ = 0x02
+
+HEADER_LEN = 5
+CRC_LEN = 4
+
+FIELDS = ("isr", "rx_bytes", "tx_bytes", "overruns", "errors", "dropped", "fifo_high")
+
+# counters shown as per second rates, fifo_high is a high water mark and isn't
+RATES = FIELDS[:-1]
+
+# MIL_TIME is a 32 bit cycle counter
+WRAP = 1 << 32
+
+
+def crc32(data):
+    return zlib.crc32(data) & 0xFFFFFFFF
+
+
+def delta(new, old):
+    # counters are u32 and wrap, unsigned difference still works across it
+    return (new - old) % WRAP
+
+
+class Board:
+
+    def __init__(self, port, baud, timeout=0.5):
+        import serial
+        self.ser = serial.Serial(port, baud, timeout=timeout)
+        self.seq = 0
+
+    def request(self, cmd, tries=3):
+        for _ in range(tries):
+            self.seq = (self.seq + 1) & 0xFF
+            self.ser.reset_input_buffer()
+            self.ser.write(bytes((SOF, cmd, self.seq, SOF ^ cmd ^ self.seq)))
+
+            payload = self.reply(cmd, self.seq)
+            if payload is not None:
+                return payload
+
+        raise RuntimeError("no reply from the board, is MIL_STAT_Poll running on this port?")
+
+    def reply(self, cmd, seq):
+        # skip anything before the SOF, a reply to an old request or noise
+        while True:
+            b = self.ser.read(1)
+            if not b:
+                return None
+            if b[0] == SOF:
+                break
+
+        header = b + self.ser.read(HEADER_LEN - 1)
+        if len(header) != HEADER_LEN:
+            return None
+
+        (length,) = struct.unpack_from("<H", header, 3)
+        rest = self.ser.read(length + CRC_LEN)
+        if len(rest) != length + CRC_LEN:
+            return None
+
+        return parse_reply(header + rest, cmd, seq)
+
+    def list(self):
+        return parse_list(self.request(CMD_LIST))
+
+    def read(self):
+        return parse_read(self.request(CMD_READ))
+
+
+def parse_reply(frame, cmd, seq):
+    """payload of a whole reply frame, None if it is damaged or not the one asked for"""
+    if len(frame) < HEADER_LEN + CRC_LEN:
+        return None
+
+    sof, r_cmd, r_seq, length = struct.unpack_from("<BBBH", frame)
+    if sof != SOF or r_cmd != cmd or r_seq != seq or len(frame) != HEADER_LEN + length + CRC_LEN:
+        return None
+
+    (crc,) = struct.unpack_from("<I", frame, HEADER_LEN + length)
+    if crc != crc32(frame[:HEADER_LEN + length]):
+        return None
+
+    return frame[HEADER_LEN:HEADER_LEN + length]
+
+
+def parse_list(payload):
+    """clock in Hz and {id: name}"""
+    clock, count = struct.unpack_from("<IB", payload)
+    pos = 5
+    names = {}
+
+    for _ in range(count):
+        src, n = struct.unpack_from("<BB", payload, pos)
+        pos += 2
+        names[src] = payload[pos:pos + n].decode("ascii", "replace")
+        pos += n
+
+    return clock, names
+
+
+def parse_read(payload):
+    """MIL_TIME stamp and {id: {field: value}}"""
+    stamp, count = struct.unpack_from("<IB", payload)
+    pos = 5
+    counters = {}
+
+    for _ in range(count):
+        src = payload[pos]
+        values = struct.unpack_from("<%dI" % len(FIELDS), payload, pos + 1)
+        pos += 1 + 4 * len(FIELDS)
+        counters[src] = dict(zip(FIELDS, values))
+
+    return stamp, counters
+
+
+def rates(old, new, seconds):
+    """{id: {field: per second}} for sources in both reads"""
+    out = {}
+
+    for src, c in new.items():
+        if src not in old or seconds <= 0:
+            continue
+        r = {f: delta(c[f], old[src][f]) / seconds for f in RATES}
+        r["fifo_high"] = c["fifo_high"]
+        out[src] = r
+
+    return out
+
+
+def print_totals(names, counters):
+    print("%-10s" % "source" + "".join("%12s" % f for f in FIELDS))
+    for src in sorted(counters):
+        c = counters[src]
+        print("%-10s" % names.get(src, "?%d" % src) + "".join("%12d" % c[f] for f in FIELDS))
+
+
+def print_rates(names, r, seconds):
+    print("\n%.3fs" % seconds)
+    print("%-10s" % "source" + "".join("%12s" % (f + "/s") for f in RATES) + "%12s" % "fifo_high")
+    for src in sorted(r):
+        row = r[src]
+        # anything lost stands out
+        flag = " <" if row["overruns"] or row["errors"] or row["dropped"] else ""
+        print("%-10s" % names.get(src, "?%d" % src) + "".join("%12.1f" % row[f] for f in RATES)
+              + "%12d" % row["fifo_high"] + flag)
+
+
+class Plot:
+
+    # one panel per kind of number, one line per source
+    PANELS = (("bytes/s", ("rx_bytes", "tx_bytes")),
+              ("isr/s", ("isr",)),
+              ("lost/s", ("overruns", "errors", "dropped")))
+
+    def __init__(self, names, window):
+        import matplotlib.pyplot as plt
+        self.plt = plt
+        self.names = names
+        self.window = window
+        self.t = []
+        self.series = {}
+        self.fig, self.axes = plt.subplots(len(self.PANELS), 1, sharex=True)
+        plt.ion()
+
+    def add(self, t, r):
+        self.t.append(t)
+
+        for src, row in r.items():
+            for _, fields in self.PANELS:
+                for f in fields:
+                    key = (src, f)
+                    # sources seen late start with gaps, not zeros
+                    line = self.series.setdefault(key, [None] * (len(self.t) - 1))
+                    line.append(row[f])
+
+        for line in self.series.values():
+            while len(line) < len(self.t):
+                line.append(None)
+            del line[:-self.window]
+        del self.t[:-self.window]
+
+        for ax, (title, fields) in zip(self.axes, self.PANELS):
+            ax.clear()
+            ax.set_ylabel(title)
+            for (src, f), line in sorted(self.series.items()):
+                if f in fields and any(line):
+                    ax.plot(self.t, line, label="%s %s" % (self.names.get(src, src), f))
+            if ax.lines:
+                ax.legend(loc="upper left", fontsize="small")
+
+        self.axes[-1].set_xlabel("seconds")
+        self.plt.pause(0.001)
+
+    def open(self):
+        return self.plt.fignum_exists(self.fig.number)
+
+
+def monitor(args):
+    board = Board(args.port, args.baud)
+
+    clock, names = board.list()
+    print("clock %d Hz, %d sources: %s" % (clock, len(names), " ".join(names[k] for k in sorted(names))))
+
+    stamp, counters = board.read()
+    host = time.monotonic()
+
+    if args.once:
+        print_totals(names, counters)
+        return
+
+    if args.interval * clock >= WRAP / 2:
+        print("interval is over half the MIL_TIME wrap(%.0fs at this clock), using PC time" % (WRAP / clock))
+
+    log = None
+    if args.log:
+        log = open(args.log, "w")
+        log.write("seconds,source," + ",".join(FIELDS) + "\n")
+
+    plot = Plot(names, args.window) if args.plot else None
+    start = host
+
+    try:
+        while plot is None or plot.open():
+            time.sleep(args.interval)
+
+            new_stamp, new_counters = board.read()
+            new_host = time.monotonic()
+
+            # board time unless it may have wrapped more than once
+            host_dt = new_host - host
+            if host_dt * clock < WRAP / 2:
+                seconds = delta(new_stamp, stamp) / clock
+            else:
+                seconds = host_dt
+
+            r = rates(counters, new_counters, seconds)
+
+            if log:
+                for src in sorted(new_counters):
+                    log.write("%.3f,%s," % (new_host - start, names.get(src, src)))
+                    log.write(",".join(str(new_counters[src][f]) for f in FIELDS) + "\n")
+                log.flush()
+
+            if plot:
+                plot.add(new_host - start, r)
+            else:
+                print_rates(names, r, seconds)
+
+            stamp, counters, host = new_stamp, new_counters, new_host
+
+            # a source that registered after the LIST, ask for names again
+            if any(src not in names for src in new_counters):
+                clock, names = board.list()
+                if plot:
+                    plot.names = names
+
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if log:
+            log.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="MIL_STAT live driver counters")
+    parser.add_argument("port", help="serial port(COM5, /dev/ttyACM0...)")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the MIL_STAT UART")
+    parser.add_argument("--interval", type=float, default=1.0, help="seconds between reads")
+    parser.add_argument("--plot", action="store_true", help="live plot instead of a table(needs matplotlib)")
+    parser.add_argument("--window", type=int, default=120, help="with --plot, reads kept on screen")
+    parser.add_argument("--log", help="save every read's raw counters to a CSV file")
+    parser.add_argument("--once", action="store_true", help="print the totals once and exit")
+    args = parser.parse_args()
+
+    try:
+        monitor(args)
+    except RuntimeError as e:
+        print(e)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,324 @@
+/*
+ * Name: pool_stress
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Multi threaded host stress test of MIL_POOL
+ *
+ *       Threads on separate cores hit the same pool at once, which is a
+ *       harsher version of an ISR landing in the middle of the main loop's
+ *       alloc or release. Each thread allocates, fills, checks and
+ *       releases blocks, and passes blocks to the other threads through
+ *       shared handoff slots, sometimes keeping a reference of its own
+ *       (MIL_POOL_Retain) so a block has two owners
+ *
+ *       A block is only written right after it is allocated, so if the
+ *       pool ever hands out a block somebody still owns the new owner
+ *       overwrites it and the old owner's check fails
+ *
+ *       At the end every block has to be back in the pool: in_use is 0
+ *       and allocating everything gives each block exactly once. Then a
+ *       deliberate double release has to be counted as misuse and leave
+ *       the free list intact
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -pthread -I.. -o pool_stress pool_stress.c ../MIL_POOL.c
+ *
+ * Usage:
+ *      ./pool_stress [threads] [seconds]
+ */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MIL_POOL.h"
+
+#define MAX_THREADS 16
+#define HELD_MAX    8
+#define HANDOFFS    32
+#define MIN_SIZE    8
+
+#define TOTAL_BLOCKS (MIL_POOL_SMALL_COUNT + MIL_POOL_MEDIUM_COUNT + MIL_POOL_LARGE_COUNT)
+
+typedef struct{
+
+    uint32_t seed;
+    uint8_t *held[HELD_MAX];
+    uint32_t n_held;
+
+    uint64_t allocs;
+    uint64_t releases;
+    uint64_t handoffs;
+    uint64_t shared;
+    uint64_t bad;
+
+}Worker;
+
+static uint8_t *volatile HANDOFF[HANDOFFS];
+
+static volatile uint32_t next_id = 1;
+static volatile int stop;
+
+/************************HELPERS******************************/
+
+static uint32_t Rand(uint32_t *pSeed){
+
+    //xorshift32, each thread has its own so no locking
+    uint32_t x = *pSeed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    return *pSeed = x;
+
+}
+
+//word 0 is a unique id, word 1 the size, the rest the id's low byte
+static void Fill(uint8_t *pBlock, uint32_t size){
+
+    uint32_t id = __sync_fetch_and_add(&next_id, 1);
+
+    memcpy(pBlock, &id, 4);
+    memcpy(pBlock + 4, &size, 4);
+    memset(pBlock + 8, (uint8_t)id, size - 8);
+
+}
+
+static int Check(const uint8_t *pBlock){
+
+    uint32_t id;
+    uint32_t size;
+
+    memcpy(&id, pBlock, 4);
+    memcpy(&size, pBlock + 4, 4);
+
+    if(size < MIN_SIZE || size > MIL_POOL_BlockSize((uint8_t *)pBlock)){ return 0; }
+
+    for(uint32_t i = 8; i < size; i++){
+
+        if(pBlock[i] != (uint8_t)id){ return 0; }
+
+    }
+
+    return 1;
+
+}
+
+static void Drop(Worker *pW, uint8_t *pBlock){
+
+    if(!Check(pBlock)){ pW->bad++; }
+
+    MIL_POOL_Release(pBlock);
+    pW->releases++;
+
+}
+
+/************************THREADS******************************/
+
+static void *Run(void *pArg){
+
+    Worker *pW = (Worker *)pArg;
+
+    while(!stop){
+
+        uint32_t r = Rand(&pW->seed);
+        uint32_t op = r % 4;
+
+        if(op == 0 && pW->n_held < HELD_MAX){
+
+            uint32_t size = MIN_SIZE + (r >> 8) % (MIL_POOL_LARGE_SIZE - MIN_SIZE + 1);
+            uint8_t *pBlock = MIL_POOL_Alloc(size);
+
+            if(pBlock){
+
+                Fill(pBlock, size);
+                pW->held[pW->n_held++] = pBlock;
+                pW->allocs++;
+
+            }
+
+        }
+        else if(op == 1 && pW->n_held){
+
+            Drop(pW, pW->held[--pW->n_held]);
+
+        }
+        else if(op == 2 && pW->n_held){
+
+            //swap a block into a slot, whatever was there is ours now
+            uint8_t *pBlock = pW->held[--pW->n_held];
+            uint8_t *pOld = __sync_lock_test_and_set(&HANDOFF[(r >> 8) % HANDOFFS], pBlock);
+
+            pW->handoffs++;
+
+            if(pOld){
+
+                if(!Check(pOld)){ pW->bad++; }
+                pW->held[pW->n_held++] = pOld;
+
+            }
+
+        }
+        else if(op == 3 && pW->n_held){
+
+            //second owner: hand one reference over and keep ours
+            uint8_t *pBlock = pW->held[pW->n_held - 1];
+
+            MIL_POOL_Retain(pBlock);
+
+            uint8_t *pOld = __sync_lock_test_and_set(&HANDOFF[(r >> 8) % HANDOFFS], pBlock);
+
+            pW->shared++;
+
+            if(pOld){ Drop(pW, pOld); }
+
+        }
+
+    }
+
+    while(pW->n_held){ Drop(pW, pW->held[--pW->n_held]); }
+
+    return 0;
+
+}
+
+/************************CHECKS******************************/
+
+static uint32_t InUse(uint32_t *pMisuse){
+
+    uint32_t used = 0;
+
+    *pMisuse = 0;
+
+    for(uint8_t c = 0; c < MIL_POOL_NUM_CLASSES; c++){
+
+        MIL_POOL_Stats st;
+        MIL_POOL_StatsGet(c, &st);
+
+        used += st.in_use;
+        *pMisuse += st.misuse;
+
+    }
+
+    return used;
+
+}
+
+//takes every block, each has to come out exactly once, then gives them back
+static int FreeListIntact(void){
+
+    static uint8_t *ALL[TOTAL_BLOCKS + 1];
+    uint32_t n = 0;
+    int ok = 1;
+
+    while(n <= TOTAL_BLOCKS){
+
+        uint8_t *pBlock = MIL_POOL_Alloc(1);
+        if(!pBlock){ break; }
+
+        for(uint32_t i = 0; i < n; i++){
+
+            if(ALL[i] == pBlock){ ok = 0; }
+
+        }
+
+        ALL[n++] = pBlock;
+
+    }
+
+    if(n != TOTAL_BLOCKS){ ok = 0; }
+
+    printf("  free list: %u of %u blocks, %s\n", n, TOTAL_BLOCKS, ok ? "each once" : "BROKEN");
+
+    for(uint32_t i = 0; i < n; i++){ MIL_POOL_Release(ALL[i]); }
+
+    return ok;
+
+}
+
+/************************MAIN******************************/
+
+int main(int argc, char **argv){
+
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    int seconds = argc > 2 ? atoi(argv[2]) : 3;
+
+    if(threads < 1 || threads > MAX_THREADS){ threads = 4; }
+
+    static Worker W[MAX_THREADS];
+    pthread_t tid[MAX_THREADS];
+
+    MIL_POOL_Init();
+
+    printf("%d threads, %d s, %u blocks\n", threads, seconds, TOTAL_BLOCKS);
+
+    for(int i = 0; i < threads; i++){
+
+        W[i].seed = 0x9E3779B9u * (uint32_t)(i + 1);
+        pthread_create(&tid[i], 0, Run, &W[i]);
+
+    }
+
+    struct timespec ts = {seconds, 0};
+    nanosleep(&ts, 0);
+    stop = 1;
+
+    uint64_t allocs = 0, releases = 0, handoffs = 0, shared = 0, bad = 0;
+
+    for(int i = 0; i < threads; i++){
+
+        pthread_join(tid[i], 0);
+
+        allocs += W[i].allocs;
+        releases += W[i].releases;
+        handoffs += W[i].handoffs;
+        shared += W[i].shared;
+        bad += W[i].bad;
+
+    }
+
+    //whatever is still parked in a slot
+    for(int i = 0; i < HANDOFFS; i++){
+
+        if(HANDOFF[i]){
+
+            if(!Check(HANDOFF[i])){ bad++; }
+            MIL_POOL_Release(HANDOFF[i]);
+            releases++;
+
+        }
+
+    }
+
+    uint32_t misuse;
+    uint32_t used = InUse(&misuse);
+    int ok = bad == 0 && used == 0 && misuse == 0;
+
+    printf("  allocs %llu, releases %llu, handoffs %llu, shared %llu\n",
+           (unsigned long long)allocs, (unsigned long long)releases,
+           (unsigned long long)handoffs, (unsigned long long)shared);
+    printf("  corrupted blocks %llu, in use at the end %u, misuse %u\n", (unsigned long long)bad, used, misuse);
+
+    ok &= FreeListIntact();
+
+    //double release: counted, and the block only goes back once
+    printf("double release\n");
+
+    uint8_t *pBlock = MIL_POOL_Alloc(1);
+    MIL_POOL_Release(pBlock);
+    MIL_POOL_Release(pBlock);
+    MIL_POOL_Retain(pBlock);
+
+    used = InUse(&misuse);
+    printf("  misuse %u(expect 2), in use %u\n", misuse, used);
+
+    ok &= misuse == 2 && used == 0;
+    ok &= FreeListIntact();
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+
+}
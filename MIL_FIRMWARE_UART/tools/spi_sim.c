@@ -0,0 +1,399 @@
+/*
+ * Name: spi_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host model of a MIL_SPI bus, runs the real MIL_SPIQ code against
+ *       a simulated SSI+DMA and a register map sensor
+ *
+ *       The bus moves one byte per 8 bit times. Every transaction also
+ *       pays the CPU time MIL_SPI spends around it: the completion ISR,
+ *       starting the DMA, and setting the SSI up again when the rate or
+ *       mode changes. The costs are estimates in cycles at 16MHz, change
+ *       the defines to match a scope trace
+ *
+ *       The sensor answers [0x80 | reg] with the registers from reg on,
+ *       like most IMUs. Its registers change every sample, and every
+ *       read is checked against what the sensor held when it was read
+ *
+ *       Two runs:
+ *
+ *          throughput: blocking(one at a time) vs queued(back to back)
+ *                      for a range of sizes and bit rates
+ *          periodic:   a 1kHz burst read of the sensor sharing the bus
+ *                      with bulk transfers to a slower device, reports
+ *                      overruns and how late each read starts
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o spi_sim spi_sim.c ../MIL_SPIQ.c
+ *
+ * Usage:
+ *      ./spi_sim [bulk_len] [sensor_hz]
+ *      ./spi_sim 256 1000       the default
+ *      ./spi_sim 1024 1000      bulk writes longer than the period, reads overrun
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MIL_SPIQ.h"
+
+#define CLOCK_HZ 16000000.0
+
+//CPU cycles, estimates for driverlib calls at 16MHz
+#define ISR_TICKS    80     //entry, status clear, DMA check, CS high
+#define START_TICKS  120    //two DMA channel setups and CS low
+#define CONFIG_TICKS 200    //SSIDisable, SSIConfigSetExpClk, SSIEnable
+#define CALL_TICKS   60     //MIL_SPI_Transfer's setup and the wait loop noticing DONE
+
+#define MAX_LEN 1024
+#define QUEUED  8
+
+/************************SIMULATED SENSOR******************************/
+
+#define SENSOR_REGS 128
+#define SENSOR_READ 0x80
+#define BURST_REG   0x3B
+#define BURST_LEN   14
+
+static uint8_t regs[SENSOR_REGS];
+static uint32_t sample;
+static uint32_t read_sample;    //sample the last read saw
+
+//a new sample every read so stale data shows up as an error
+static void SensorUpdate(void){
+
+    sample++;
+
+    for(uint8_t i = 0; i < SENSOR_REGS; i++){ regs[i] = (uint8_t)(i * 3 + sample); }
+
+}
+
+//full duplex: first byte is the command, the rest clock out registers
+static void SensorXfer(const uint8_t *pTx, uint8_t *pRx, uint16_t len){
+
+    uint8_t cmd = pTx ? pTx[0] : 0xFF;
+    uint8_t reg = cmd & 0x7F;
+
+    pRx[0] = 0xFF;
+    read_sample = sample;
+
+    for(uint16_t i = 1; i < len; i++){
+
+        if(cmd & SENSOR_READ){ pRx[i] = regs[(reg + i - 1) % SENSOR_REGS]; }
+        else{ regs[(reg + i - 1) % SENSOR_REGS] = pTx ? pTx[i] : 0xFF; }
+
+    }
+
+}
+
+/************************SIMULATED BUS******************************/
+
+typedef struct{
+
+    MIL_SPIQ q;
+    uint32_t bus_end;       //when the running transaction's last byte is in
+    uint32_t configs;
+
+}Bus;
+
+static Bus bus;
+
+static MIL_SPI_Dev sensor  = {0, 0x01, 8000000, MIL_SPI_MODE_3};
+static MIL_SPI_Dev flash   = {0, 0x02, 4000000, MIL_SPI_MODE_0};
+static MIL_SPI_Dev loop    = {0, 0x04, 8000000, MIL_SPI_MODE_0};
+
+static uint32_t ByteTicks(const MIL_SPI_Dev *pDev){
+
+    return (uint32_t)(8 * CLOCK_HZ / pDev->bit_rate);
+
+}
+
+//what MIL_SPI's Start does, at time now
+static void Start(uint32_t now){
+
+    MIL_SPI_Xfer *pX = bus.q.pHead;
+
+    if(MIL_SPIQ_Started(&bus.q, now)){ now += CONFIG_TICKS; bus.configs++; }
+
+    now += START_TICKS;
+
+    //the data moves at once, the time is accounted for in bus_end
+    if(pX->pDev == &sensor){ SensorXfer(pX->pTx, pX->pRx, pX->len); }
+    else if(pX->pRx){ memcpy(pX->pRx, pX->pTx, pX->len); }
+
+    bus.bus_end = now + pX->len * ByteTicks(pX->pDev);
+
+}
+
+static void Submit(MIL_SPI_Xfer *pX, uint32_t now){
+
+    if(MIL_SPIQ_Push(&bus.q, pX, MAX_LEN)){ Start(now); }
+
+}
+
+//the completion ISR, returns when it is finished
+static uint32_t Complete(void){
+
+    uint32_t now = bus.bus_end + ISR_TICKS;
+    MIL_SPI_Xfer *pNext;
+    MIL_SPI_Xfer *pDone = MIL_SPIQ_Complete(&bus.q, now, &pNext);
+
+    if(pNext){ Start(now); }
+
+    if(pDone->pDone){ pDone->pDone(pDone); }
+
+    return now;
+
+}
+
+static void BusReset(void){
+
+    memset(&bus, 0, sizeof(bus));
+    MIL_SPIQ_Init(&bus.q);
+
+}
+
+/************************THROUGHPUT******************************/
+
+static uint8_t tx_data[MAX_LEN];
+static uint8_t rx_data[QUEUED][MAX_LEN];
+
+static uint32_t Errors(uint16_t len){
+
+    uint32_t errors = 0;
+
+    for(uint8_t n = 0; n < QUEUED; n++){
+
+        for(uint16_t i = 0; i < len; i++){ errors += (rx_data[n][i] != tx_data[i]); }
+
+    }
+
+    return errors;
+
+}
+
+static uint32_t RunBlocking(uint16_t len){
+
+    BusReset();
+    memset(rx_data, 0, sizeof(rx_data));
+
+    uint32_t now = 0;
+
+    for(uint8_t n = 0; n < QUEUED; n++){
+
+        MIL_SPI_Xfer x = {&loop, tx_data, rx_data[n], len, 0, 0, MIL_SPI_IDLE, 0};
+
+        Submit(&x, now + CALL_TICKS / 2);
+        now = Complete() + CALL_TICKS / 2;
+
+    }
+
+    return now;
+
+}
+
+static uint32_t RunQueued(uint16_t len){
+
+    static MIL_SPI_Xfer xfers[QUEUED];
+
+    BusReset();
+    memset(rx_data, 0, sizeof(rx_data));
+    memset(xfers, 0, sizeof(xfers));
+
+    uint32_t now = 0;
+
+    for(uint8_t n = 0; n < QUEUED; n++){
+
+        xfers[n].pDev = &loop;
+        xfers[n].pTx = tx_data;
+        xfers[n].pRx = rx_data[n];
+        xfers[n].len = len;
+
+        Submit(&xfers[n], now);
+
+    }
+
+    while(MIL_SPIQ_Active(&bus.q)){ now = Complete(); }
+
+    return now;
+
+}
+
+static void Throughput(void){
+
+    const uint32_t RATES[] = {1000000, 4000000, 8000000};
+    const uint16_t SIZES[] = {1, 4, 16, 64, 256, 1024};
+
+    for(uint16_t i = 0; i < MAX_LEN; i++){ tx_data[i] = (uint8_t)(i * 7 + 1); }
+
+    printf("throughput, %d transactions each, B/s and %% of line\n", QUEUED);
+    printf("  rate     size      blocking            queued       errors\n");
+
+    for(unsigned r = 0; r < sizeof(RATES) / sizeof(RATES[0]); r++){
+
+        loop.bit_rate = RATES[r];
+        double line = RATES[r] / 8.0;
+
+        for(unsigned s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++){
+
+            uint16_t len = SIZES[s];
+            double bytes = (double)len * QUEUED;
+
+            double b = bytes / (RunBlocking(len) / CLOCK_HZ);
+            uint32_t errors = Errors(len);
+            double q = bytes / (RunQueued(len) / CLOCK_HZ);
+            errors += Errors(len);
+
+            printf("%5.0fk  %5u  %8.0f %5.1f%%  %8.0f %5.1f%%  %5lu\n",
+                   RATES[r] / 1000.0, len, b, 100 * b / line, q, 100 * q / line,
+                   (unsigned long)errors);
+
+        }
+
+    }
+
+}
+
+/************************PERIODIC******************************/
+
+static uint8_t burst_tx[BURST_LEN + 1] = {SENSOR_READ | BURST_REG};
+static uint8_t burst_rx[BURST_LEN + 1];
+static uint32_t queued_sample;  //sample that was new when the read was queued
+static uint32_t bad_reads;      //data doesn't match any one sample
+static uint32_t stale_reads;    //a newer sample came before the read started
+
+static void BurstDone(MIL_SPI_Xfer *pX){
+
+    (void)pX;
+
+    for(uint8_t i = 0; i < BURST_LEN; i++){
+
+        if(burst_rx[i + 1] != (uint8_t)((BURST_REG + i) * 3 + read_sample)){ bad_reads++; break; }
+
+    }
+
+    if(read_sample != queued_sample){ stale_reads++; }
+
+}
+
+static void Periodic(uint16_t bulk_len, uint32_t sensor_hz){
+
+    static MIL_SPI_Xfer burst;
+    static MIL_SPI_Xfer bulk[2];
+    static uint8_t bulk_tx[MAX_LEN];
+
+    BusReset();
+    memset(&burst, 0, sizeof(burst));
+    memset(bulk, 0, sizeof(bulk));
+
+    burst.pDev = &sensor;
+    burst.pTx = burst_tx;
+    burst.pRx = burst_rx;
+    burst.len = BURST_LEN + 1;
+    burst.pDone = BurstDone;
+
+    for(uint8_t n = 0; n < 2; n++){
+
+        bulk[n].pDev = &flash;
+        bulk[n].pTx = bulk_tx;
+        bulk[n].len = bulk_len;
+
+    }
+
+    uint32_t period = (uint32_t)(CLOCK_HZ / sensor_hz);
+    uint32_t next_tick = period;
+    uint32_t end = (uint32_t)CLOCK_HZ;
+    uint32_t now = 0;
+    uint32_t tick_time = 0;
+    uint32_t late_max = 0;
+    uint64_t late_sum = 0;
+    uint32_t reads = 0;
+    bool timing = false;
+
+    bad_reads = 0;
+    stale_reads = 0;
+
+    while(now < end){
+
+        //the main loop keeps two bulk transfers waiting
+        for(uint8_t n = 0; n < 2; n++){
+
+            if(bulk[n].state != MIL_SPI_QUEUED && bulk[n].state != MIL_SPI_ACTIVE){ Submit(&bulk[n], now); }
+
+        }
+
+        if(MIL_SPIQ_Active(&bus.q) && (int32_t)(bus.bus_end + ISR_TICKS - next_tick) <= 0){
+
+            now = Complete();
+
+        }
+        else{
+
+            //timer tick: the sensor has a new sample, the read jumps the queue
+            now = next_tick;
+            next_tick += period;
+            SensorUpdate();
+
+            bool waiting = burst.state == MIL_SPI_QUEUED || burst.state == MIL_SPI_ACTIVE;
+
+            if(MIL_SPIQ_Periodic(&bus.q, &burst, MAX_LEN)){ Start(now + ISR_TICKS); }
+
+            //an overrun keeps the earlier tick's read, and its timing
+            if(!waiting){
+
+                queued_sample = sample;
+                tick_time = now;
+                timing = true;
+
+            }
+
+        }
+
+        //how long after its tick the read got the bus
+        if(timing && MIL_SPIQ_Active(&bus.q) == &burst){
+
+            uint32_t late = bus.q.start - tick_time;
+
+            if(late > late_max){ late_max = late; }
+            late_sum += late;
+            reads++;
+            timing = false;
+
+        }
+
+    }
+
+    MIL_SPIQ_Stats st;
+    MIL_SPIQ_StatsGet(&bus.q, &st);
+
+
+    printf("\nperiodic: %u byte sensor read at %luHz(8MHz), %u byte bulk writes(4MHz)\n",
+           BURST_LEN + 1, (unsigned long)sensor_hz, bulk_len);
+    printf("  transactions %lu  bytes %lu  bus busy %.1f%%  reconfigs %lu\n",
+           (unsigned long)st.xfers, (unsigned long)st.bytes,
+           100.0 * st.busy_ticks / CLOCK_HZ, (unsigned long)bus.configs);
+    printf("  read start after tick: avg %.1fus worst %.1fus\n",
+           reads ? late_sum / CLOCK_HZ * 1e6 / reads : 0.0, late_max / CLOCK_HZ * 1e6);
+    printf("  overruns %lu  stale reads %lu  wrong reads %lu  %s\n",
+           (unsigned long)st.overruns, (unsigned long)stale_reads, (unsigned long)bad_reads,
+           bad_reads ? "FAILED" : (st.overruns ? "bus overloaded" : "ok"));
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    uint16_t bulk_len  = (argc > 1) ? (uint16_t)atoi(argv[1]) : 256;
+    uint32_t sensor_hz = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1000;
+
+    if(bulk_len < 1 || bulk_len > MAX_LEN){ bulk_len = 256; }
+
+    Throughput();
+    Periodic(bulk_len, sensor_hz);
+
+    return 0;
+
+}
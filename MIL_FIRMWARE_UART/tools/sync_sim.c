@@ -0,0 +1,125 @@
+/*
+ * Name: sync_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host simulation of MIL_SYNC, runs the real MIL_SYNCCLK code
+ *       against two simulated boards to show the sync converging
+ *
+ *       Each board has its own oscillator error. Every exchange goes
+ *       over a link with a fixed delay plus random jitter, and every
+ *       receive stamp gets up to half a bit of error like MIL_RXTS
+ *
+ *       Prints one line per exchange: the true sync error(slave clock
+ *       minus master clock, measured by the simulation, not by the slave)
+ *       and what the slave thinks its error and drift are
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o sync_sim sync_sim.c ../MIL_SYNCCLK.c
+ *
+ * Usage:
+ *      ./sync_sim [drift_ppm] [delay_us] [jitter_us] [baud] [exchanges]
+ *      ./sync_sim 10000 50 5 115200 40       1% drift, the default
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "MIL_SYNCCLK.h"
+
+//nominal clock, MIL_ClkSetInt_16MHz
+#define CLOCK_HZ 16000000.0
+
+//must match MIL_SYNC.h
+#define PERIOD_S 0.250
+
+//time the master takes to answer, from its main loop
+#define TURNAROUND_S 0.0003
+
+//slave boots this long after the master
+#define BOOT_GAP_S 3.7
+
+/************************SIMULATED BOARDS******************************/
+
+typedef struct{
+
+    double rate;    //actual cycles per second
+    double start;   //true time the board was reset
+
+}Board;
+
+//MIL_TIME of a board at true time t
+static uint32_t Cycles(const Board *pB, double t){
+
+    return (uint32_t)(uint64_t)((t - pB->start) * pB->rate);
+
+}
+
+static double Uniform(double half_width){
+
+    return ((double)rand() / RAND_MAX * 2.0 - 1.0) * half_width;
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    double drift_ppm = (argc > 1) ? atof(argv[1]) : 10000.0;
+    double delay_s   = ((argc > 2) ? atof(argv[2]) : 50.0) * 1e-6;
+    double jitter_s  = ((argc > 3) ? atof(argv[3]) : 5.0) * 1e-6;
+    double baud      = (argc > 4) ? atof(argv[4]) : 115200.0;
+    int exchanges    = (argc > 5) ? atoi(argv[5]) : 40;
+
+    double half_bit_s = 0.5 / baud;
+
+    Board master = { CLOCK_HZ, 0.0 };
+    Board slave  = { CLOCK_HZ * (1.0 - drift_ppm * 1e-6), BOOT_GAP_S };
+
+    MIL_SYNCCLK clk;
+    double t = BOOT_GAP_S + 0.001;
+
+    srand(1);
+    MIL_SYNCCLK_Init(&clk, Cycles(&slave, t));
+
+    printf("drift %.0fppm delay %.0fus jitter %.0fus baud %.0f, 1 bit = %.0f cycles\n",
+           drift_ppm, delay_s * 1e6, jitter_s * 1e6, baud, CLOCK_HZ / baud);
+    printf("  n   true error(cycles)   measured offset   delay   freq(ppb)\n");
+
+    for(int n = 1; n <= exchanges; n++){
+
+        double sent = t;
+        double req_arrive = sent + delay_s + Uniform(jitter_s);
+        double resp_sent = req_arrive + TURNAROUND_S;
+        double resp_arrive = resp_sent + delay_s + Uniform(jitter_s);
+
+        uint32_t t1 = Cycles(&slave, sent);
+        uint32_t t2 = Cycles(&master, req_arrive + Uniform(half_bit_s));
+        uint32_t t3 = Cycles(&master, resp_sent);
+        uint32_t t4 = Cycles(&slave, resp_arrive + Uniform(half_bit_s));
+
+        MIL_SYNCCLK_Update(&clk, t1, t2, t3, t4, Cycles(&slave, resp_arrive + 0.0001));
+
+        //check the clock halfway to the next exchange, the worst spot for drift
+        double check = sent + PERIOD_S / 2;
+        uint32_t slave_says = (uint32_t)MIL_SYNCCLK_Read(&clk, Cycles(&slave, check));
+        int32_t error = (int32_t)(slave_says - Cycles(&master, check));
+
+        MIL_SYNCCLK_Stats stats;
+        MIL_SYNCCLK_StatsGet(&clk, &stats);
+
+        printf("%3d   %18ld   %15ld   %5ld   %9ld\n", n, (long)error,
+               (long)stats.offset, (long)stats.delay, (long)stats.freq_ppb);
+
+        t = sent + PERIOD_S;
+
+    }
+
+    MIL_SYNCCLK_Stats stats;
+    MIL_SYNCCLK_StatsGet(&clk, &stats);
+    printf("steps %lu, worst offset since last step %lu cycles(%.2fus)\n",
+           (unsigned long)stats.steps, (unsigned long)stats.offset_max,
+           stats.offset_max / CLOCK_HZ * 1e6);
+
+    return 0;
+
+}
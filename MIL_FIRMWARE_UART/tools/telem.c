@@ -0,0 +1,471 @@
+/*
+ * Name: telem
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host side of MIL_PACK and MIL_LZ telemetry compression
+ *
+ *       bench:  compresses a made up telemetry stream every way the demo
+ *               can send it, checks it decodes back exactly and prints
+ *               the compression ratio and encode/decode speed of each,
+ *               use it to pick a method per channel
+ *
+ *       decode: reads the byte stream main_telem.c sends(a capture of the
+ *               serial port) and prints one line of values per sample
+ *
+ *       roundtrip: MIL_LZ encode/decode of every packet length up to 300
+ *               with several kinds of data, history carried between
+ *               packets, fails if any packet comes back different
+ *
+ *       Speeds are host nanoseconds per input byte, only good for comparing
+ *       methods. main_telem.c reports the real cycles per byte on the board
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o telem telem.c ../MIL_PACK.c ../MIL_LZ.c -lm
+ *
+ *      add -DMIL_LZ_WINDOW_BITS=6 (or 10) to compare window sizes,
+ *      decode needs the same MIL_LZ settings the board was built with
+ *
+ *      roundtrip over every documented MIL_LZ setting:
+ *      for w in 4 5 6 7 8 9 10 11; do for l in 2 3 4 5 6 7 8; do
+ *          gcc -O2 -I.. -DMIL_LZ_WINDOW_BITS=$w -DMIL_LZ_LENGTH_BITS=$l -o telem telem.c \
+ *              ../MIL_PACK.c ../MIL_LZ.c -lm && ./telem roundtrip || break 2; done; done
+ *
+ * Usage:
+ *      ./telem bench [samples]
+ *      ./telem decode < capture.bin
+ *      ./telem roundtrip
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "MIL_PACK.h"
+#include "MIL_LZ.h"
+
+//must match main_telem.c
+#define CHANNELS      8
+#define FRAME_SOF     0xA5
+#define FRAME_RESET   0x80
+#define KIND_RAW      1
+#define KIND_DELTA    2
+#define KIND_LZ       3
+#define KIND_DELTA_LZ 4
+#define KIND_STATS    5
+
+#define SAMPLE_BYTES (CHANNELS * 4)
+#define BUF_LEN (1 << 20)
+
+/************************COMMON******************************/
+
+static void PutI32(uint8_t *pDst, int32_t value){
+
+    for(int i = 0; i < 4; i++){ pDst[i] = (uint8_t)((uint32_t)value >> (8 * i)); }
+
+}
+
+static int32_t GetI32(const uint8_t *pSrc){
+
+    return (int32_t)((uint32_t)pSrc[0] | ((uint32_t)pSrc[1] << 8) |
+                     ((uint32_t)pSrc[2] << 16) | ((uint32_t)pSrc[3] << 24));
+
+}
+
+static double Seconds(void){
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+/************************BENCH******************************/
+
+//a 100Hz stream like a small robot sends: slow sensors, noisy IMU, counters
+static void MakeSample(uint32_t n, int32_t *pS){
+
+    double t = n * 0.01;
+
+    pS[0] = (int32_t)(n * 10);                                  //timestamp ms
+    pS[1] = (int32_t)(2500 + 30 * sin(t * 0.05) + rand() % 3);  //temperature 0.01C
+    pS[2] = (int32_t)(12000 - n / 50 + rand() % 5);             //battery mV
+    pS[3] = (int32_t)(rand() % 41 - 20);                        //accel x
+    pS[4] = (int32_t)(rand() % 41 - 20);                        //accel y
+    pS[5] = (int32_t)(1000 + rand() % 41 - 20);                 //accel z
+    pS[6] = (int32_t)(n / 7);                                   //encoder counts
+    pS[7] = (n % 1000 < 900) ? 0x01 : 0x03;                     //status flags
+
+}
+
+//a text log, the general payload case
+static uint16_t MakeLogLine(uint32_t n, uint8_t *pOut){
+
+    static const char *STATES[] = {"IDLE", "DRIVE", "DRIVE", "DRIVE", "TURN"};
+
+    return (uint16_t)sprintf((char *)pOut, "t=%lu state=%s temp=%d.%02d bat=%dmV\r\n",
+                             (unsigned long)(n * 10), STATES[(n / 200) % 5],
+                             25 + (int)(n / 3000) % 3, (int)(n % 7) * 11, 12000 - (int)n / 50);
+
+}
+
+typedef struct{
+
+    const char *name;
+    uint32_t in_bytes;
+    uint32_t out_bytes;
+    double enc_s;
+    double dec_s;
+    int errors;
+
+}Result;
+
+static void Print(const Result *pR){
+
+    printf("%-22s %8lu -> %8lu   ratio %5.2f   %6.1f%% of raw   enc %6.1f ns/B   dec %5.1f ns/B  %s\n",
+           pR->name, (unsigned long)pR->in_bytes, (unsigned long)pR->out_bytes,
+           (double)pR->in_bytes / pR->out_bytes, 100.0 * pR->out_bytes / pR->in_bytes,
+           pR->enc_s * 1e9 / pR->in_bytes, pR->dec_s * 1e9 / pR->in_bytes,
+           pR->errors ? "DECODE FAILED" : "ok");
+
+}
+
+/*
+ * Desc: runs one method over every sample(or log line) as its own packet,
+ *       the way the demo sends them, then decodes and compares
+ */
+static void BenchSamples(const char *name, int use_delta, int use_lz, uint32_t samples){
+
+    static uint8_t packets[BUF_LEN];
+    static uint16_t lens[BUF_LEN / 4];
+    static int32_t data[BUF_LEN / 4][CHANNELS];
+
+    Result r = {name, 0, 0, 0, 0, 0};
+    MIL_PACK_Delta pack, unpack;
+    MIL_LZ lz, unlz;
+
+    srand(1);
+    for(uint32_t n = 0; n < samples; n++){ MakeSample(n, data[n]); }
+
+    MIL_PACK_DeltaInit(&pack, CHANNELS);
+    MIL_LZ_Init(&lz);
+
+    double t0 = Seconds();
+    uint32_t pos = 0;
+
+    for(uint32_t n = 0; n < samples; n++){
+
+        uint8_t tmp[SAMPLE_BYTES + MIL_PACK_MAX_OUT(CHANNELS)];
+        uint16_t len;
+
+        if(use_delta){ len = MIL_PACK_DeltaEncode(&pack, data[n], tmp); }
+        else{
+
+            for(int ch = 0; ch < CHANNELS; ch++){ PutI32(&tmp[4 * ch], data[n][ch]); }
+            len = SAMPLE_BYTES;
+
+        }
+
+        if(use_lz){ len = MIL_LZ_Encode(&lz, tmp, len, &packets[pos]); }
+        else{ memcpy(&packets[pos], tmp, len); }
+
+        lens[n] = len;
+        pos += len;
+
+    }
+
+    r.enc_s = Seconds() - t0;
+    r.in_bytes = samples * SAMPLE_BYTES;
+    r.out_bytes = pos;
+
+    MIL_PACK_DeltaInit(&unpack, CHANNELS);
+    MIL_LZ_Init(&unlz);
+
+    t0 = Seconds();
+    pos = 0;
+
+    for(uint32_t n = 0; n < samples; n++){
+
+        uint8_t tmp[SAMPLE_BYTES + MIL_PACK_MAX_OUT(CHANNELS)];
+        uint16_t len = lens[n];
+        int32_t out[CHANNELS];
+
+        if(use_lz){
+
+            if(!MIL_LZ_Decode(&unlz, &packets[pos], lens[n], tmp, sizeof(tmp), &len)){ r.errors++; break; }
+
+        }
+        else{ memcpy(tmp, &packets[pos], len); }
+
+        if(use_delta){
+
+            if(MIL_PACK_DeltaDecode(&unpack, tmp, len, out) != len){ r.errors++; break; }
+
+        }
+        else{
+
+            for(int ch = 0; ch < CHANNELS; ch++){ out[ch] = GetI32(&tmp[4 * ch]); }
+
+        }
+
+        if(memcmp(out, data[n], sizeof(out)) != 0){ r.errors++; }
+
+        pos += lens[n];
+
+    }
+
+    r.dec_s = Seconds() - t0;
+
+    Print(&r);
+
+}
+
+static void BenchLog(uint32_t lines){
+
+    static uint8_t text[BUF_LEN];
+    static uint8_t packets[BUF_LEN * 2];
+    static uint16_t in_lens[BUF_LEN / 16], out_lens[BUF_LEN / 16];
+
+    Result r = {"log text, LZ", 0, 0, 0, 0, 0};
+    MIL_LZ lz, unlz;
+    uint32_t in_pos = 0, out_pos = 0;
+
+    for(uint32_t n = 0; n < lines; n++){
+
+        in_lens[n] = MakeLogLine(n, &text[in_pos]);
+        in_pos += in_lens[n];
+
+    }
+
+    MIL_LZ_Init(&lz);
+
+    double t0 = Seconds();
+
+    for(uint32_t n = 0, p = 0; n < lines; p += in_lens[n++]){
+
+        out_lens[n] = MIL_LZ_Encode(&lz, &text[p], in_lens[n], &packets[out_pos]);
+        out_pos += out_lens[n];
+
+    }
+
+    r.enc_s = Seconds() - t0;
+    r.in_bytes = in_pos;
+    r.out_bytes = out_pos;
+
+    MIL_LZ_Init(&unlz);
+
+    t0 = Seconds();
+
+    for(uint32_t n = 0, p = 0, q = 0; n < lines; p += in_lens[n], q += out_lens[n], n++){
+
+        uint8_t line[128];
+        uint16_t len;
+
+        if(!MIL_LZ_Decode(&unlz, &packets[q], out_lens[n], line, sizeof(line), &len) ||
+           len != in_lens[n] || memcmp(line, &text[p], len) != 0){ r.errors++; break; }
+
+    }
+
+    r.dec_s = Seconds() - t0;
+
+    Print(&r);
+
+}
+
+static int Bench(uint32_t samples){
+
+    if(samples > BUF_LEN / 64){ samples = BUF_LEN / 64; }
+
+    printf("%lu samples of %d channels, one packet per sample, LZ window %u bytes\n",
+           (unsigned long)samples, CHANNELS, MIL_LZ_WINDOW);
+
+    BenchSamples("raw int32", 0, 0, samples);
+    BenchSamples("delta varint", 1, 0, samples);
+    BenchSamples("LZ", 0, 1, samples);
+    BenchSamples("delta varint + LZ", 1, 1, samples);
+    BenchLog(samples);
+
+    return 0;
+
+}
+
+/************************DECODE******************************/
+
+static int Decode(void){
+
+    MIL_PACK_Delta unpack;
+    MIL_LZ unlz;
+    uint8_t payload[256], tmp[256];
+    int32_t out[CHANNELS];
+    int c;
+
+    MIL_PACK_DeltaInit(&unpack, CHANNELS);
+    MIL_LZ_Init(&unlz);
+
+    while((c = getchar()) != EOF){
+
+        if(c != FRAME_SOF){ continue; }
+
+        int kind = getchar();
+        int len = getchar();
+
+        if(kind == EOF || len == EOF){ break; }
+        if(fread(payload, 1, len, stdin) != (size_t)len){ break; }
+
+        if(kind & FRAME_RESET){
+
+            MIL_PACK_DeltaReset(&unpack);
+            MIL_LZ_Init(&unlz);
+
+        }
+
+        kind &= ~FRAME_RESET;
+
+        uint16_t n = (uint16_t)len;
+        const uint8_t *p = payload;
+
+        if(kind == KIND_STATS && len == 12){
+
+            uint32_t raw = (uint32_t)GetI32(&payload[0]);
+            uint32_t sent = (uint32_t)GetI32(&payload[4]);
+            uint32_t cycles = (uint32_t)GetI32(&payload[8]);
+
+            printf("# ratio %.2f, %.1f cycles per raw byte on the board\n",
+                   sent ? (double)raw / sent : 0.0, raw ? (double)cycles / raw : 0.0);
+            continue;
+
+        }
+
+        if(kind == KIND_LZ || kind == KIND_DELTA_LZ){
+
+            if(!MIL_LZ_Decode(&unlz, payload, n, tmp, sizeof(tmp), &n)){
+
+                printf("# bad LZ frame, waiting for a key frame\n");
+                continue;
+
+            }
+
+            p = tmp;
+
+        }
+
+        if(kind == KIND_DELTA || kind == KIND_DELTA_LZ){
+
+            if(MIL_PACK_DeltaDecode(&unpack, p, n, out) != n){
+
+                printf("# bad delta frame, waiting for a key frame\n");
+                continue;
+
+            }
+
+        }
+        else if(n == SAMPLE_BYTES){
+
+            for(int ch = 0; ch < CHANNELS; ch++){ out[ch] = GetI32(&p[4 * ch]); }
+
+        }
+        else{
+
+            printf("# bad frame\n");
+            continue;
+
+        }
+
+        for(int ch = 0; ch < CHANNELS; ch++){ printf(ch ? ",%ld" : "%ld", (long)out[ch]); }
+        printf("\n");
+
+    }
+
+    return 0;
+
+}
+
+/************************ROUNDTRIP******************************/
+
+#define RT_MAX_LEN 300
+#define RT_KINDS   4
+
+//packet n of kind k, each kind stresses a different item mix
+static void MakePacket(int kind, uint32_t n, uint8_t *pOut, uint16_t len){
+
+    for(uint16_t i = 0; i < len; i++){
+
+        switch(kind){
+
+            case 0:  pOut[i] = (uint8_t)rand(); break;                  //mostly literals
+            case 1:  pOut[i] = (uint8_t)('a' + rand() % 3); break;      //short copies
+            case 2:  pOut[i] = (uint8_t)((i / 37) + n); break;          //long runs
+            default: pOut[i] = (uint8_t)"telemetry t=0 "[(i + n) % 14]; break;
+
+        }
+
+    }
+
+}
+
+static int RoundTrip(void){
+
+    uint8_t in[RT_MAX_LEN], packed[MIL_LZ_MAX_OUT(RT_MAX_LEN)], out[RT_MAX_LEN];
+    uint32_t packets = 0, failures = 0;
+
+    srand(1);
+
+    for(int kind = 0; kind < RT_KINDS; kind++){
+
+        MIL_LZ lz, unlz;
+        MIL_LZ_Init(&lz);
+        MIL_LZ_Init(&unlz);
+
+        for(uint16_t len = 0; len <= RT_MAX_LEN; len++){
+
+            uint16_t out_len = 0;
+
+            MakePacket(kind, len, in, len);
+
+            uint16_t n = MIL_LZ_Encode(&lz, in, len, packed);
+            bool ok = MIL_LZ_Decode(&unlz, packed, n, out, sizeof(out), &out_len);
+
+            packets++;
+
+            if(!ok || out_len != len || memcmp(in, out, len) != 0){
+
+                if(failures++ < 5){ printf("  kind %d len %u: ok=%d got %u bytes\n", kind, len, ok, out_len); }
+
+                //both ends start over so one failure doesn't spoil the rest
+                MIL_LZ_Init(&lz);
+                MIL_LZ_Init(&unlz);
+
+            }
+
+        }
+
+    }
+
+    printf("MIL_LZ window %u bits, length %u bits: %lu packets, %lu failed\n",
+           MIL_LZ_WINDOW_BITS, MIL_LZ_LENGTH_BITS, (unsigned long)packets, (unsigned long)failures);
+
+    return failures ? 1 : 0;
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    if(argc > 1 && strcmp(argv[1], "bench") == 0){
+
+        return Bench((argc > 2) ? (uint32_t)atoi(argv[2]) : 10000);
+
+    }
+
+    if(argc > 1 && strcmp(argv[1], "decode") == 0){ return Decode(); }
+
+    if(argc > 1 && strcmp(argv[1], "roundtrip") == 0){ return RoundTrip(); }
+
+    printf("usage: telem bench [samples]\n       telem decode < capture.bin\n       telem roundtrip\n");
+
+    return 1;
+
+}
@@ -0,0 +1,337 @@
+/*
+ * Name: topic_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host test of MIL_TOPIC, a fast interval timer signal stands in
+ *       for an ISR interrupting the main loop at random points
+ *
+ *       Every sample is 16 copies of its own number, a reader that gets
+ *       a mix of two samples(a torn read) spots it straight away
+ *
+ *          isr reads:  main publishes as fast as it can, the "ISR" reads
+ *          isr writes: the "ISR" publishes, main reads as fast as it can
+ *          plain copy: the same as isr reads with a global struct instead
+ *                      of a topic, to show the tearing MIL_TOPIC prevents
+ *          queued:     the "ISR" publishes, a queued subscriber in main has
+ *                      to see every sample, in order, until its queue fills
+ *          blocks:     MIL_POOL blocks through two queued subscribers, every
+ *                      block has to end up back in the pool
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o topic_sim topic_sim.c ../MIL_TOPIC.c ../MIL_POOL.c
+ *
+ * Usage:
+ *      ./topic_sim [seconds_per_test]
+ */
+#define _DEFAULT_SOURCE
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "MIL_POOL.h"
+#include "MIL_TOPIC.h"
+
+#define WORDS 16
+#define TIMER_US 20
+
+typedef struct{
+
+    uint32_t w[WORDS];
+
+}Sample;
+
+static MIL_TOPIC topic;
+static uint8_t SLOTS[MIL_TOPIC_SLOTS_LEN(sizeof(Sample))];
+
+static volatile Sample plain;
+static volatile int mode;
+static volatile uint32_t isr_count;
+static volatile uint32_t isr_torn;
+static volatile uint32_t isr_n;
+
+/************************HELPERS******************************/
+
+static void Fill(Sample *pS, uint32_t n){
+
+    for(int i = 0; i < WORDS; i++){ pS->w[i] = n; }
+
+}
+
+static int Torn(const Sample *pS){
+
+    for(int i = 1; i < WORDS; i++){
+
+        if(pS->w[i] != pS->w[0]){ return 1; }
+
+    }
+
+    return 0;
+
+}
+
+static double Now(void){
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+/************************"ISR"******************************/
+
+static void Isr(int sig){
+
+    (void)sig;
+    Sample s;
+
+    isr_count++;
+
+    if(mode == 0){
+
+        if(MIL_TOPIC_READ(&topic, &s) && Torn(&s)){ isr_torn++; }
+
+    }
+    else if(mode == 1){
+
+        Fill(&s, ++isr_n);
+        MIL_TOPIC_PUBLISH(&topic, &s);
+
+    }
+    else if(mode == 2){
+
+        Sample copy;
+        memcpy(&copy, (const void *)&plain, sizeof(copy));
+        if(Torn(&copy)){ isr_torn++; }
+
+    }
+
+}
+
+static void TimerSet(int us){
+
+    struct itimerval t;
+
+    t.it_interval.tv_sec = 0;
+    t.it_interval.tv_usec = us;
+    t.it_value = t.it_interval;
+
+    setitimer(ITIMER_REAL, &t, 0);
+
+}
+
+/************************TESTS******************************/
+
+static int failed;
+
+static void Report(const char *pName, uint32_t checked, uint32_t torn, int want_torn){
+
+    int ok = want_torn ? 1 : torn == 0;
+
+    printf("%-11s %10lu checks  %6lu torn  %s\n", pName, (unsigned long)checked,
+           (unsigned long)torn, want_torn ? "(expected, no protection)" : (ok ? "ok" : "FAILED"));
+
+    if(!ok){ failed = 1; }
+
+}
+
+static void IsrReads(double secs){
+
+    Sample s;
+    uint32_t n = 0;
+
+    MIL_TOPIC_Init(&topic, "test", sizeof(Sample), SLOTS);
+    mode = 0;
+    isr_count = 0;
+    isr_torn = 0;
+    TimerSet(TIMER_US);
+
+    for(double end = Now() + secs; Now() < end;){
+
+        for(int i = 0; i < 1000; i++){ Fill(&s, ++n); MIL_TOPIC_PUBLISH(&topic, &s); }
+
+    }
+
+    TimerSet(0);
+    Report("isr reads", isr_count, isr_torn, 0);
+
+}
+
+static void IsrWrites(double secs){
+
+    Sample s;
+    uint32_t checked = 0;
+    uint32_t torn = 0;
+    uint32_t backwards = 0;
+    uint32_t last = 0;
+
+    MIL_TOPIC_Init(&topic, "test", sizeof(Sample), SLOTS);
+    mode = 1;
+    isr_n = 0;
+    TimerSet(TIMER_US);
+
+    for(double end = Now() + secs; Now() < end;){
+
+        for(int i = 0; i < 1000; i++){
+
+            uint32_t n = MIL_TOPIC_READ(&topic, &s);
+            if(!n){ continue; }
+
+            checked++;
+            if(Torn(&s) || s.w[0] != n){ torn++; }
+            if(n < last){ backwards++; }
+            last = n;
+
+        }
+
+    }
+
+    TimerSet(0);
+    Report("isr writes", checked, torn + backwards, 0);
+
+}
+
+static void PlainCopy(double secs){
+
+    uint32_t n = 0;
+
+    mode = 2;
+    isr_count = 0;
+    isr_torn = 0;
+    TimerSet(TIMER_US);
+
+    for(double end = Now() + secs; Now() < end;){
+
+        for(int i = 0; i < 1000; i++){
+
+            n++;
+            for(int w = 0; w < WORDS; w++){ plain.w[w] = n; }
+
+        }
+
+    }
+
+    TimerSet(0);
+    Report("plain copy", isr_count, isr_torn, 1);
+
+}
+
+static void Queued(double secs){
+
+    enum{ DEPTH = 64 };
+    static uint8_t QUEUE[MIL_TOPIC_QUEUE_LEN(sizeof(Sample), DEPTH)];
+    MIL_TOPIC_Sub sub;
+    Sample s;
+    uint32_t expect = 1;
+    uint32_t taken = 0;
+    uint32_t bad = 0;
+
+    MIL_TOPIC_Init(&topic, "test", sizeof(Sample), SLOTS);
+    MIL_TOPIC_Subscribe(&topic, &sub, QUEUE, DEPTH);
+    mode = 1;
+    isr_n = 0;
+    TimerSet(TIMER_US);
+
+    for(double end = Now() + secs; Now() < end;){
+
+        while(MIL_TOPIC_TAKE(&sub, &s)){
+
+            //a full queue skips samples, after that they have to run in order again
+            if(Torn(&s) || s.w[0] < expect){ bad++; }
+            expect = s.w[0] + 1;
+            taken++;
+
+        }
+
+        //a slow consumer now and then so the queue fills up(spins, signals cut sleeps short)
+        if((taken & 0xFFF) == 0){ for(double busy = Now() + 0.003; Now() < busy;); }
+
+    }
+
+    TimerSet(0);
+
+    MIL_TOPIC_SubStats st;
+    MIL_TOPIC_SubStatsGet(&sub, &st);
+    Report("queued", taken, bad, 0);
+    printf("            lag max %lu of %d, dropped %lu\n", (unsigned long)st.lag_max, DEPTH,
+           (unsigned long)st.dropped);
+
+}
+
+static void Blocks(void){
+
+    enum{ DEPTH = 4 };
+    static uint8_t Q1[MIL_TOPIC_QUEUE_LEN(sizeof(uint8_t *), DEPTH)];
+    static uint8_t Q2[MIL_TOPIC_QUEUE_LEN(sizeof(uint8_t *), DEPTH)];
+    MIL_TOPIC blocks;
+    MIL_TOPIC_Sub a, b;
+    uint32_t bad = 0;
+    uint32_t checked = 0;
+
+    MIL_POOL_Init();
+    MIL_TOPIC_InitBlocks(&blocks, "blocks");
+    MIL_TOPIC_Subscribe(&blocks, &a, Q1, DEPTH);
+    MIL_TOPIC_Subscribe(&blocks, &b, Q2, DEPTH);
+
+    for(uint32_t n = 0; n < 100000; n++){
+
+        uint8_t *pBlock = MIL_POOL_Alloc(MIL_POOL_MEDIUM_SIZE);
+        if(!pBlock){ bad++; continue; }
+
+        memset(pBlock, (int)(n & 0xFF), MIL_POOL_MEDIUM_SIZE);
+        MIL_TOPIC_PublishBlock(&blocks, pBlock);
+
+        //b falls behind, its queue fills and drops without leaking blocks
+        uint8_t *pGot;
+        while(MIL_TOPIC_TAKE(&a, &pGot)){
+
+            if(pGot[0] != (uint8_t)n || pGot[MIL_POOL_MEDIUM_SIZE - 1] != (uint8_t)n){ bad++; }
+            checked++;
+            MIL_POOL_Release(pGot);
+
+        }
+
+        if((n % 10) == 0){
+
+            while(MIL_TOPIC_TAKE(&b, &pGot)){ checked++; MIL_POOL_Release(pGot); }
+
+        }
+
+    }
+
+    uint8_t *pGot;
+    while(MIL_TOPIC_TAKE(&b, &pGot)){ checked++; MIL_POOL_Release(pGot); }
+
+    MIL_POOL_Stats ps;
+    MIL_POOL_StatsGet(MIL_POOL_MEDIUM, &ps);
+
+    MIL_TOPIC_SubStats st;
+    MIL_TOPIC_SubStatsGet(&b, &st);
+
+    Report("blocks", checked, bad + ps.in_use, 0);
+    printf("            slow subscriber dropped %lu, pool blocks still out %lu, high water %lu\n",
+           (unsigned long)st.dropped, (unsigned long)ps.in_use, (unsigned long)ps.high_water);
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    double secs = (argc > 1) ? atof(argv[1]) : 1.0;
+
+    signal(SIGALRM, Isr);
+
+    IsrReads(secs);
+    IsrWrites(secs);
+    PlainCopy(secs);
+    Queued(secs);
+    Blocks();
+
+    return failed;
+
+}
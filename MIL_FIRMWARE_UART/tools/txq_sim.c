@@ -0,0 +1,122 @@
+/*
+ * Name: txq_sim
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Host simulation of MIL_UARTQ, runs the real MIL_TXQ code
+ *       against a UART that is flooded with log frames while a short
+ *       control frame is sent every few milliseconds
+ *
+ *       Runs three setups and prints the control frames' queue latency
+ *       for each, plus how much of the line the logs got:
+ *
+ *          fifo:      everything in one class, how MIL_UART_OutArray behaves
+ *          priority:  control in MIL_TXQ_CONTROL, logs in MIL_TXQ_BULK
+ *          limited:   priority, with logs rate limited
+ *
+ *       The UART is modeled with its 16 byte TX FIFO, refilled whenever
+ *       it has room, one byte leaves per byte time
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o txq_sim txq_sim.c ../MIL_TXQ.c
+ *
+ * Usage:
+ *      ./txq_sim [baud] [log_frame_len] [control_period_ms] [log_limit_Bps]
+ *      ./txq_sim 115200 200 10 4000       the defaults
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "MIL_TXQ.h"
+
+//ticks are MIL_TIME cycles at 16MHz
+#define TICKS_PER_S  16000000.0
+#define TICKS_PER_US 16.0
+
+#define FIFO_LEN 16
+#define CONTROL_LEN 16
+#define RUN_S 5.0
+
+static MIL_TXQ Q;
+
+/*
+ * Desc: runs one setup, prints one line of results
+ */
+static void Run(const char *pName, double baud, uint16_t log_len, double control_ms,
+                uint8_t control_cls, uint32_t log_limit){
+
+    uint8_t log_frame[MIL_TXQ_MAX_FRAME];
+    uint8_t control_frame[CONTROL_LEN];
+
+    for(uint16_t i = 0; i < log_len; i++){ log_frame[i] = (uint8_t)i; }
+    for(uint16_t i = 0; i < CONTROL_LEN; i++){ control_frame[i] = (uint8_t)i; }
+
+    uint32_t byte_ticks = (uint32_t)(TICKS_PER_S * 10 / baud);
+    uint32_t control_ticks = (uint32_t)(control_ms * TICKS_PER_S / 1000);
+    uint32_t end = (uint32_t)(RUN_S * TICKS_PER_S);
+
+    MIL_TXQ_Init(&Q, 0);
+
+    if(log_limit){ MIL_TXQ_RateSet(&Q, MIL_TXQ_BULK, (uint32_t)(TICKS_PER_S / log_limit), 512, 0); }
+
+    uint16_t fifo = 0;
+    uint32_t next_control = control_ticks / 3;
+
+    for(uint32_t now = 0; now < end; now += byte_ticks){
+
+        //log code fills every bit of space it is given
+        while(MIL_TXQ_Space(&Q, MIL_TXQ_BULK) >= log_len + MIL_TXQ_HEADER_LEN){
+
+            MIL_TXQ_Push(&Q, MIL_TXQ_BULK, log_frame, log_len, now);
+
+        }
+
+        if((int32_t)(now - next_control) >= 0){
+
+            MIL_TXQ_Push(&Q, control_cls, control_frame, CONTROL_LEN, now);
+            next_control += control_ticks;
+
+        }
+
+        //one byte leaves, the ISR tops the FIFO back up
+        if(fifo){ fifo--; }
+        while(fifo < FIFO_LEN && MIL_TXQ_Next(&Q, now) >= 0){ fifo++; }
+
+    }
+
+    MIL_TXQ_Stats control;
+    MIL_TXQ_Stats logs;
+    MIL_TXQ_StatsGet(&Q, control_cls, &control);
+    MIL_TXQ_StatsGet(&Q, MIL_TXQ_BULK, &logs);
+
+    //in fifo mode both share a class, take the logs out again
+    uint32_t log_bytes = logs.bytes;
+    if(control_cls == MIL_TXQ_BULK){ log_bytes -= (uint32_t)(RUN_S * 1000 / control_ms) * CONTROL_LEN; }
+
+    printf("%-9s  control latency avg %8.0fus  max %8.0fus   logs %6.1f%% of line  throttled %lu\n",
+           pName, control.lat_avg / TICKS_PER_US, control.lat_max / TICKS_PER_US,
+           100.0 * log_bytes / (RUN_S * baud / 10), (unsigned long)logs.throttled);
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    double baud        = (argc > 1) ? atof(argv[1]) : 115200.0;
+    uint16_t log_len   = (argc > 2) ? (uint16_t)atoi(argv[2]) : 200;
+    double control_ms  = (argc > 3) ? atof(argv[3]) : 10.0;
+    uint32_t log_limit = (argc > 4) ? (uint32_t)atoi(argv[4]) : 4000;
+
+    if(log_len == 0 || log_len > MIL_TXQ_MAX_FRAME){ log_len = 200; }
+
+    printf("%.0f baud, %u byte log frames as fast as they fit, %d byte control frame every %.1fms\n",
+           baud, log_len, CONTROL_LEN, control_ms);
+
+    Run("fifo", baud, log_len, control_ms, MIL_TXQ_BULK, 0);
+    Run("priority", baud, log_len, control_ms, MIL_TXQ_CONTROL, 0);
+    Run("limited", baud, log_len, control_ms, MIL_TXQ_CONTROL, log_limit);
+
+    return 0;
+
+}
@@ -0,0 +1,715 @@
+/*
+ * Name: uart_replay
+ * Author: Marquez Jones
+ * Date created: 10/18/2026
+ * Desc: Plays a MIL_CAP capture back into a host model of MIL_UART
+ *       with the original byte timing, so the same field traffic can be
+ *       run again and again against different receive code
+ *
+ *       The received bytes of one port arrive at the times they were
+ *       captured(never closer together than one byte time at the baud
+ *       rate). The model receives them one of two ways:
+ *
+ *          poll: main_polled.c, the main loop checks the UART every
+ *                loop_us and reads one byte per pass
+ *          isr:  MIL_UART_InitISR, the RX interrupt(FIFO trigger level or
+ *                receive timeout) empties the FIFO into a RAM ring and the
+ *                main loop takes bytes from the ring
+ *
+ *       and hands each byte to one of three applications:
+ *
+ *          echo: sends it back with MIL_UART_CharPut, which waits while
+ *                the TX side is full(main_polled.c again)
+ *          sink: does nothing with it, the fastest possible reader
+ *          link: feeds it to the real MIL_ARQ receiver(MIL_LINK traffic)
+ *
+ *       The FIFO is off(one byte deep) unless a trigger level is given,
+ *       in eighths like MIL_UART_FIFOEn. CPU costs are estimates in cycles,
+ *       change the defines to match a scope trace
+ *
+ *       Without a loop time it replays the capture with main loops from
+ *       2us to 500us, to show how slow the loop can get before bytes are
+ *       lost. With one it replays at 1 to 16 times the captured speed, to
+ *       show how much more traffic the code could take. Nothing is random,
+ *       the same capture and settings always give the same numbers
+ *
+ *       Without a board, synth writes a capture to try it on:
+ *          type: someone typing into main_polled.c, with a long paste
+ *          link: a MIL_LINK sender sending bursts of messages
+ *
+ * Build(from the tools folder):
+ *      gcc -O2 -I.. -o uart_replay uart_replay.c ../MIL_ARQ.c ../MIL_CRC.c
+ *
+ * Usage:
+ *      ./uart_replay capture [poll|isr] [fifo] [echo|sink|link] [baud] [loop_us] [speed] [port]
+ *      ./uart_replay echo.cap                          polled echo, no FIFO(main_polled.c)
+ *      ./uart_replay echo.cap poll 4                   the same with the FIFO on
+ *      ./uart_replay echo.cap isr 4 sink               interrupts at half full
+ *      ./uart_replay echo.cap poll 0 echo 115200 20    a 20us loop, at 1x to 16x
+ *      ./uart_replay synth type typing.cap
+ *      ./uart_replay synth link link.cap
+ *
+ *      port is the MIL_CAP port number(1 for UART1), the default is
+ *      the port that received the most bytes
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MIL_ARQ.h"
+#include "MIL_CAP.h"
+
+#define FIFO_DEPTH       16
+#define RX_TIMEOUT_BITS  32     //idle time before the receive timeout interrupt
+#define RING_LEN         64     //RAM ring between the RX ISR and the main loop
+
+#define READ_CYCLES      30     //MIL_UART_CharGet of a byte that is waiting
+#define PUT_CYCLES       30     //MIL_UART_CharPut when there is room
+#define ISR_ENTRY_CYCLES 40     //interrupt entry and the ISR getting to the FIFO
+
+#define MAX_PORTS 16
+
+enum{ APP_ECHO, APP_SINK, APP_LINK };
+
+/************************CAPTURE******************************/
+
+typedef struct{
+
+    double t;           //cycles since the capture started
+    uint8_t flags;
+    uint8_t data;
+
+}Record;
+
+static Record *recs;
+static uint32_t n_recs;
+static double clock_hz = 16000000.0;
+static uint32_t lost;
+static uint32_t bad_bytes;
+static uint32_t restarts;
+
+/*
+ * Desc: reads a capture file, skipping anything that isn't
+ *       a good record(noise, a record cut in half)
+ */
+static int Load(const char *path){
+
+    FILE *f = fopen(path, "rb");
+    if(!f){ perror(path); return -1; }
+
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t *pBuf = malloc(len > 0 ? (size_t)len : 1);
+    recs = malloc(sizeof(Record) * (size_t)(len / MIL_CAP_RECORD_LEN + 1));
+
+    if(!pBuf || !recs || fread(pBuf, 1, (size_t)len, f) != (size_t)len){
+
+        fprintf(stderr, "can't read %s\n", path);
+        fclose(f);
+        return -1;
+
+    }
+
+    fclose(f);
+
+    double t = 0;
+    uint32_t last = 0;
+    int first = 1;
+
+    for(long i = 0; i < len;){
+
+        const uint8_t *p = &pBuf[i];
+
+        if(p[0] != MIL_CAP_SYNC || i + MIL_CAP_RECORD_LEN > len ||
+           (p[1] ^ p[2] ^ p[3] ^ p[4] ^ p[5] ^ p[6]) != p[7]){
+
+            bad_bytes++;
+            i++;
+            continue;
+
+        }
+
+        i += MIL_CAP_RECORD_LEN;
+
+        uint32_t stamp = p[3] | (p[4] << 8) | (p[5] << 16) | ((uint32_t)p[6] << 24);
+
+        if(p[1] == MIL_CAP_CLOCK){
+
+            //MIL_CAP_Init ran again, its stamps don't follow on from the last ones
+            if(!first){ restarts++; }
+            clock_hz = stamp;
+            first = 1;
+            continue;
+
+        }
+
+        if(p[1] == MIL_CAP_LOST){ lost += stamp; continue; }
+
+        //stamps are a free running 32 bit count, only the difference matters
+        if(!first){ t += (uint32_t)(stamp - last); }
+        first = 0;
+        last = stamp;
+
+        recs[n_recs++] = (Record){ t, p[1], p[2] };
+
+    }
+
+    free(pBuf);
+
+    return 0;
+
+}
+
+static const char *PortName(uint8_t port){
+
+    static char name[8];
+
+    snprintf(name, sizeof(name), port < 8 ? "UART%u" : "SUART%u", port < 8 ? port : port - 8);
+
+    return name;
+
+}
+
+/*
+ * Desc: what the capture itself says, before any replay
+ */
+static uint8_t Summary(void){
+
+    uint32_t rx[MAX_PORTS] = {0}, tx[MAX_PORTS] = {0};
+    double turn_sum = 0, turn_max = 0;
+    uint32_t turns = 0;
+    double last_rx[MAX_PORTS];
+    int rx_waiting[MAX_PORTS] = {0};
+
+    for(uint32_t i = 0; i < n_recs; i++){
+
+        uint8_t port = recs[i].flags & MIL_CAP_PORT;
+
+        if(recs[i].flags & MIL_CAP_TX){
+
+            tx[port]++;
+
+            //how long the code took to answer what it received
+            if(rx_waiting[port]){
+
+                double us = (recs[i].t - last_rx[port]) * 1e6 / clock_hz;
+                turn_sum += us;
+                if(us > turn_max){ turn_max = us; }
+                turns++;
+                rx_waiting[port] = 0;
+
+            }
+
+        }
+        else{
+
+            rx[port]++;
+            last_rx[port] = recs[i].t;
+            rx_waiting[port] = 1;
+
+        }
+
+    }
+
+    double secs = n_recs ? recs[n_recs - 1].t / clock_hz : 0;
+
+    printf("capture: %.0f Hz clock, %.3f s, %lu records, %lu lost, %lu bad bytes, %lu restarts\n",
+           clock_hz, secs, (unsigned long)n_recs, (unsigned long)lost,
+           (unsigned long)bad_bytes, (unsigned long)restarts);
+
+    uint8_t busiest = 0;
+
+    for(uint8_t p = 0; p < MAX_PORTS; p++){
+
+        if(!rx[p] && !tx[p]){ continue; }
+
+        printf("  %-6s rx %7lu  tx %7lu\n", PortName(p), (unsigned long)rx[p], (unsigned long)tx[p]);
+        if(rx[p] > rx[busiest]){ busiest = p; }
+
+    }
+
+    if(turns){
+
+        printf("  RX to next TX on the same port: avg %.1fus  max %.1fus\n", turn_sum / turns, turn_max);
+
+    }
+
+    if(lost){ printf("  warning: the capture lost records, the replay has gaps\n"); }
+
+    return busiest;
+
+}
+
+/************************MIL_UART MODEL******************************/
+
+typedef struct{
+
+    //settings
+    int isr;
+    int fifo;           //trigger level in eighths, 0 for no FIFO
+    int app;
+    double byte_ticks;
+    double loop;
+
+    //received bytes
+    double *pArrive;
+    uint8_t *pData;
+    uint32_t n;
+
+    //hardware RX FIFO, holds indexes into pArrive
+    uint32_t hw[FIFO_DEPTH];
+    uint8_t hw_head, hw_count, depth;
+    uint32_t next;      //next byte to arrive
+
+    //software ring(isr), when each byte in it leaves
+    double ring_out[RING_LEN];
+    uint32_t ring_head, ring_count;
+    double main_free;   //when the main loop can take the next byte
+
+    double tx_done;     //when the last byte sent finishes leaving
+
+    //results
+    uint32_t consumed;
+    uint32_t overruns;
+    uint32_t ring_drops;
+    double stall;
+    double *pLatency;
+
+    MIL_ARQ arq;
+    uint32_t messages;
+
+}Model;
+
+static void ArqOut(void *pCtx, const uint8_t *pFrame, uint16_t len){ (void)pCtx; (void)pFrame; (void)len; }
+
+static void ArqDeliver(void *pCtx, const uint8_t *pData, uint8_t len){
+
+    (void)pData; (void)len;
+    ((Model *)pCtx)->messages++;
+
+}
+
+//bytes arriving up to time t go into the FIFO, or are lost when it's full
+static void Arrive(Model *pM, double t){
+
+    while(pM->next < pM->n && pM->pArrive[pM->next] <= t){
+
+        if(pM->hw_count < pM->depth){
+
+            pM->hw[(pM->hw_head + pM->hw_count) % FIFO_DEPTH] = pM->next;
+            pM->hw_count++;
+
+        }
+        else{ pM->overruns++; }
+
+        pM->next++;
+
+    }
+
+}
+
+static uint32_t HwPop(Model *pM){
+
+    uint32_t i = pM->hw[pM->hw_head];
+
+    pM->hw_head = (uint8_t)((pM->hw_head + 1) % FIFO_DEPTH);
+    pM->hw_count--;
+
+    return i;
+
+}
+
+//MIL_UART_CharPut, returns when it's done
+static double TxPut(Model *pM, double t){
+
+    //room once no more than depth bytes are still waiting to leave
+    double room = pM->tx_done - pM->depth * pM->byte_ticks;
+
+    if(room > t){ pM->stall += room - t; t = room; }
+
+    pM->tx_done = (pM->tx_done > t ? pM->tx_done : t) + pM->byte_ticks;
+
+    return t + PUT_CYCLES;
+
+}
+
+//the application gets byte i at time t, returns when it's done with it
+static double Consume(Model *pM, uint32_t i, double t){
+
+    pM->pLatency[pM->consumed++] = t - pM->pArrive[i];
+
+    if(pM->app == APP_ECHO){ t = TxPut(pM, t); }
+    else if(pM->app == APP_LINK){ MIL_ARQ_Rx(&pM->arq, &pM->pData[i], 1, (uint32_t)t); }
+
+    return t;
+
+}
+
+static void RunPoll(Model *pM){
+
+    double t = pM->pArrive[0];
+
+    while(pM->next < pM->n || pM->hw_count){
+
+        Arrive(pM, t);
+
+        if(!pM->hw_count){
+
+            //idle passes until the next byte is there
+            double passes = (pM->pArrive[pM->next] - t) / pM->loop;
+            t += pM->loop * (passes > 1 ? (double)(uint64_t)passes : 1);
+            continue;
+
+        }
+
+        uint32_t i = HwPop(pM);
+        t = Consume(pM, i, t + READ_CYCLES);
+        t += pM->loop;
+
+    }
+
+}
+
+//the ISR puts byte i in the ring at time t, the main loop takes it when it can
+static void RingPush(Model *pM, uint32_t i, double t){
+
+    while(pM->ring_count && pM->ring_out[pM->ring_head] <= t){
+
+        pM->ring_head = (pM->ring_head + 1) % RING_LEN;
+        pM->ring_count--;
+
+    }
+
+    if(pM->ring_count == RING_LEN){ pM->ring_drops++; return; }
+
+    double start = (pM->main_free > t) ? pM->main_free : t;
+
+    pM->ring_out[(pM->ring_head + pM->ring_count) % RING_LEN] = start;
+    pM->ring_count++;
+
+    pM->main_free = Consume(pM, i, start + READ_CYCLES) + pM->loop;
+
+}
+
+static void RunIsr(Model *pM){
+
+    const double never = 1e300;
+
+    //MIL_UART_FIFOEn levels are eighths of the 16 byte FIFO
+    uint8_t trigger = pM->fifo ? (uint8_t)(pM->fifo * FIFO_DEPTH / 8) : 1;
+    double timeout_ticks = pM->byte_ticks * RX_TIMEOUT_BITS / 10;
+
+    double trig_at = never, timeout_at = never;
+
+    while(1){
+
+        double isr_at = (trig_at < timeout_at) ? trig_at : timeout_at;
+        double arrive = (pM->next < pM->n) ? pM->pArrive[pM->next] : never;
+
+        if(isr_at == never && arrive == never){ break; }
+
+        if(isr_at <= arrive){
+
+            //the ISR empties the FIFO
+            double t = isr_at;
+            while(pM->hw_count){ t += READ_CYCLES; RingPush(pM, HwPop(pM), t); }
+
+            trig_at = timeout_at = never;
+            continue;
+
+        }
+
+        Arrive(pM, arrive);
+
+        if(pM->hw_count >= trigger && trig_at == never){ trig_at = arrive + ISR_ENTRY_CYCLES; }
+
+        //the receive timeout restarts with every byte
+        if(pM->fifo && pM->hw_count){ timeout_at = arrive + timeout_ticks + ISR_ENTRY_CYCLES; }
+
+    }
+
+}
+
+static int CompareDouble(const void *pA, const void *pB){
+
+    double a = *(const double *)pA, b = *(const double *)pB;
+
+    return (a > b) - (a < b);
+
+}
+
+/*
+ * Desc: one replay, prints one line of results
+ */
+static void Run(Model *pSetup, uint8_t port, double baud, double loop_us, double speed){
+
+    Model m = *pSetup;
+
+    m.loop = loop_us * clock_hz / 1e6;
+
+    m.pArrive = malloc(sizeof(double) * (n_recs + 1));
+    m.pData = malloc(n_recs + 1);
+    m.pLatency = malloc(sizeof(double) * (n_recs + 1));
+
+    //bytes keep their spacing(divided by speed) but can't beat the wire
+    double start = -1;
+
+    for(uint32_t i = 0; i < n_recs; i++){
+
+        if((recs[i].flags & MIL_CAP_TX) || (recs[i].flags & MIL_CAP_PORT) != port){ continue; }
+
+        if(start < 0){ start = recs[i].t; }
+
+        double t = start + (recs[i].t - start) / speed;
+
+        if(m.n && t < m.pArrive[m.n - 1] + m.byte_ticks){ t = m.pArrive[m.n - 1] + m.byte_ticks; }
+
+        m.pArrive[m.n] = t;
+        m.pData[m.n++] = recs[i].data;
+
+    }
+
+    if(!m.n){ printf("nothing received on %s\n", PortName(port)); exit(1); }
+
+    MIL_ARQ_Init(&m.arq, (uint32_t)(clock_hz / 1000), (uint32_t)m.byte_ticks, ArqOut, ArqDeliver, &m);
+
+    if(m.isr){ RunIsr(&m); }
+    else{ RunPoll(&m); }
+
+    double secs = (m.pArrive[m.n - 1] - m.pArrive[0] + m.byte_ticks) / clock_hz;
+    double to_us = 1e6 / clock_hz;
+
+    double sum = 0;
+    for(uint32_t i = 0; i < m.consumed; i++){ sum += m.pLatency[i]; }
+    qsort(m.pLatency, m.consumed, sizeof(double), CompareDouble);
+
+    double avg = m.consumed ? sum / m.consumed * to_us : 0;
+    double p99 = m.consumed ? m.pLatency[(uint32_t)(m.consumed * 0.99)] * to_us : 0;
+    double max = m.consumed ? m.pLatency[m.consumed - 1] * to_us : 0;
+
+    printf("%6.1fus %5.0fx  %8.0f B/s  %5.1f%% of line  lost %6lu + %6lu  latency avg %8.1fus  p99 %8.1fus  max %9.1fus  tx wait %7.1fms",
+           loop_us, speed, m.n / secs, 100.0 * m.n / secs / (baud / 10),
+           (unsigned long)m.overruns, (unsigned long)m.ring_drops,
+           avg, p99, max, m.stall * 1e3 / clock_hz);
+
+    if(m.app == APP_LINK){
+
+        MIL_ARQ_Stats st;
+        MIL_ARQ_StatsGet(&m.arq, &st);
+        printf("  messages %5lu  bad frames %5lu  duplicates %5lu",
+               (unsigned long)m.messages, (unsigned long)st.bad_frames, (unsigned long)st.duplicates);
+
+    }
+
+    printf("\n");
+
+    free(m.pArrive);
+    free(m.pData);
+    free(m.pLatency);
+
+}
+
+/************************SYNTHETIC CAPTURES******************************/
+
+#define SYNTH_HZ   16000000.0
+#define SYNTH_BAUD 115200.0
+#define SYNTH_PORT 1
+
+static FILE *synth_f;
+static double synth_t;
+static uint32_t lcg = 1;
+
+static uint32_t Random(uint32_t range){
+
+    lcg = lcg * 1103515245u + 12345u;
+
+    return (lcg >> 16) % range;
+
+}
+
+//writes one record the way MIL_CAP_Poll sends it
+static void Emit(uint8_t flags, uint8_t data, uint32_t stamp){
+
+    uint8_t r[MIL_CAP_RECORD_LEN] = { MIL_CAP_SYNC, flags, data,
+                                      (uint8_t)stamp, (uint8_t)(stamp >> 8),
+                                      (uint8_t)(stamp >> 16), (uint8_t)(stamp >> 24), 0 };
+
+    r[7] = r[1] ^ r[2] ^ r[3] ^ r[4] ^ r[5] ^ r[6];
+    fwrite(r, 1, sizeof(r), synth_f);
+
+}
+
+//main_polled.c echoing typing, then a paste, then more typing
+static void SynthType(void){
+
+    double byte_ticks = SYNTH_HZ * 10 / SYNTH_BAUD;
+    const char *pText = "The quick brown fox jumps over the lazy dog. ";
+
+    for(int i = 0; i < 300; i++){
+
+        int paste = (i >= 100 && i < 200);
+        uint8_t c = (uint8_t)pText[i % strlen(pText)];
+
+        //typing is 50 to 300ms a key, a paste is back to back
+        synth_t += paste ? byte_ticks : SYNTH_HZ * (50 + Random(250)) / 1000;
+
+        Emit(SYNTH_PORT, c, (uint32_t)synth_t);
+        Emit(MIL_CAP_TX | SYNTH_PORT, c, (uint32_t)(synth_t + 60));
+
+    }
+
+}
+
+static MIL_ARQ synth_a, synth_b;
+
+static void SynthOutA(void *pCtx, const uint8_t *pFrame, uint16_t len){
+
+    double byte_ticks = SYNTH_HZ * 10 / SYNTH_BAUD;
+
+    (void)pCtx;
+
+    //frames go out back to back, each byte is received one byte time later
+    for(uint16_t i = 0; i < len; i++){
+
+        synth_t += byte_ticks;
+        Emit(SYNTH_PORT, pFrame[i], (uint32_t)synth_t);
+        MIL_ARQ_Rx(&synth_b, &pFrame[i], 1, (uint32_t)synth_t);
+
+    }
+
+}
+
+//acks come straight back, this capture only records one direction
+static void SynthOutB(void *pCtx, const uint8_t *pFrame, uint16_t len){
+
+    (void)pCtx;
+    MIL_ARQ_Rx(&synth_a, pFrame, len, (uint32_t)synth_t);
+
+}
+
+static void SynthDeliver(void *pCtx, const uint8_t *pData, uint8_t len){ (void)pCtx; (void)pData; (void)len; }
+
+//a MIL_LINK sender: bursts of 8 messages every 20ms
+static void SynthLink(void){
+
+    uint32_t byte_ticks = (uint32_t)(SYNTH_HZ * 10 / SYNTH_BAUD);
+    uint8_t msg[MIL_ARQ_MAX_PAYLOAD];
+
+    MIL_ARQ_Init(&synth_a, (uint32_t)(SYNTH_HZ / 1000), byte_ticks, SynthOutA, SynthDeliver, 0);
+    MIL_ARQ_Init(&synth_b, (uint32_t)(SYNTH_HZ / 1000), byte_ticks, SynthOutB, SynthDeliver, 0);
+
+    for(int burst = 0; burst < 50; burst++){
+
+        int waiting = 8;
+        double end = synth_t + SYNTH_HZ * 20 / 1000;
+
+        while(synth_t < end){
+
+            if(waiting && MIL_ARQ_CanSend(&synth_a)){
+
+                uint8_t len = (uint8_t)(8 + Random(MIL_ARQ_MAX_PAYLOAD - 8));
+                for(uint8_t k = 0; k < len; k++){ msg[k] = (uint8_t)Random(256); }
+
+                MIL_ARQ_Send(&synth_a, msg, len, (uint32_t)synth_t);
+                waiting--;
+
+            }
+
+            MIL_ARQ_Poll(&synth_a, (uint32_t)synth_t);
+            MIL_ARQ_Poll(&synth_b, (uint32_t)synth_t);
+            synth_t += SYNTH_HZ / 10000;
+
+        }
+
+    }
+
+}
+
+static int Synth(const char *pKind, const char *pPath){
+
+    synth_f = fopen(pPath, "wb");
+    if(!synth_f){ perror(pPath); return 1; }
+
+    Emit(MIL_CAP_CLOCK, 0, (uint32_t)SYNTH_HZ);
+
+    if(strcmp(pKind, "link") == 0){ SynthLink(); }
+    else{ SynthType(); }
+
+    fclose(synth_f);
+    printf("wrote %s\n", pPath);
+
+    return 0;
+
+}
+
+/************************MAIN******************************/
+int main(int argc, char *argv[])
+{
+
+    if(argc < 2){
+
+        printf("usage: uart_replay capture [poll|isr] [fifo] [echo|sink|link] [baud] [loop_us] [speed] [port]\n"
+               "       uart_replay synth type|link file\n");
+        return 1;
+
+    }
+
+    if(strcmp(argv[1], "synth") == 0){ return (argc > 3) ? Synth(argv[2], argv[3]) : 1; }
+
+    Model setup;
+    memset(&setup, 0, sizeof(setup));
+
+    setup.isr      = (argc > 2) && strcmp(argv[2], "isr") == 0;
+    setup.fifo     = (argc > 3) ? atoi(argv[3]) : 0;
+    setup.app      = (argc > 4) ? (strcmp(argv[4], "sink") == 0 ? APP_SINK :
+                                   strcmp(argv[4], "link") == 0 ? APP_LINK : APP_ECHO) : APP_ECHO;
+    double baud    = (argc > 5) ? atof(argv[5]) : 115200.0;
+    double loop_us = (argc > 6) ? atof(argv[6]) : 0;
+    double speed   = (argc > 7) ? atof(argv[7]) : 1.0;
+
+    if(Load(argv[1]) != 0){ return 1; }
+
+    uint8_t port = Summary();
+    if(argc > 8){ port = (uint8_t)atoi(argv[8]); }
+
+    if(setup.fifo > 7){ setup.fifo = 7; }
+
+    setup.depth = setup.fifo ? FIFO_DEPTH : 1;
+    setup.byte_ticks = clock_hz * 10 / baud;
+
+    printf("\nreplaying %s: %s, %s, %s, %.0f baud\n", PortName(port),
+           setup.isr ? "interrupts" : "polled",
+           setup.fifo ? "FIFO on" : "no FIFO",
+           setup.app == APP_ECHO ? "echo" : setup.app == APP_SINK ? "sink" : "MIL_ARQ receiver",
+           baud);
+    printf("  loop  speed   average rate           lost(FIFO + ring)\n");
+
+    if(loop_us > 0){
+
+        const double speeds[] = {1, 2, 4, 8, 16};
+
+        for(unsigned i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++){
+
+            Run(&setup, port, baud, loop_us, speeds[i]);
+
+        }
+
+    }
+    else{
+
+        const double loops[] = {2, 10, 50, 100, 200, 500};
+
+        for(unsigned i = 0; i < sizeof(loops) / sizeof(loops[0]); i++){
+
+            Run(&setup, port, baud, loops[i], speed);
+
+        }
+
+    }
+
+    return 0;
+
+}